@@ -0,0 +1,41 @@
+#include <map>
+#include <string>
+#include <vector>
+
+#include "danejoe/stringify/stringify_to_string.hpp"
+
+/**
+ * @brief 模拟典型调用方：只使用预编译类型
+ * @return 输出总长度
+ * @note 定义DANEJOE_STRINGIFY_NO_PREBUILT时所有实例在本翻译单元内隐式生成
+ */
+std::size_t stringify_prebuilt_types()
+{
+    std::size_t size = 0;
+    size += DaneJoe::to_string(1).size();
+    size += DaneJoe::to_string(1L).size();
+    size += DaneJoe::to_string(1LL).size();
+    size += DaneJoe::to_string(1U).size();
+    size += DaneJoe::to_string(1UL).size();
+    size += DaneJoe::to_string(1ULL).size();
+    size += DaneJoe::to_string(1.0F).size();
+    size += DaneJoe::to_string(1.0).size();
+    size += DaneJoe::to_string(true).size();
+    size += DaneJoe::to_string('c').size();
+    size += DaneJoe::to_string(std::string("text")).size();
+    size += DaneJoe::to_string(std::vector<int>{ 1 }).size();
+    size += DaneJoe::to_string(std::vector<long>{ 1 }).size();
+    size += DaneJoe::to_string(std::vector<long long>{ 1 }).size();
+    size += DaneJoe::to_string(std::vector<unsigned int>{ 1 }).size();
+    size += DaneJoe::to_string(std::vector<unsigned long>{ 1 }).size();
+    size += DaneJoe::to_string(std::vector<unsigned long long>{ 1 }).size();
+    size += DaneJoe::to_string(std::vector<float>{ 1.0F }).size();
+    size += DaneJoe::to_string(std::vector<double>{ 1.0 }).size();
+    size += DaneJoe::to_string(std::vector<bool>{ true }).size();
+    size += DaneJoe::to_string(std::vector<std::string>{ "text" }).size();
+    size += DaneJoe::to_string(std::map<int, int>{ { 1, 1 } }).size();
+    size += DaneJoe::to_string(std::map<std::string, int>{ { "key", 1 } }).size();
+    size += DaneJoe::to_string(std::map<std::string, double>{ { "key", 1.0 } }).size();
+    size += DaneJoe::to_string(std::map<std::string, std::string>{ { "key", "value" } }).size();
+    return size;
+}
@@ -0,0 +1,36 @@
+# 比较预编译实例开启与关闭时同一翻译单元的编译耗时
+# 参数：COMPILER、SOURCE、INCLUDE_DIRS（以|分隔）、OUTPUT_DIR、RUN_COUNT
+
+string(REPLACE "|" ";" _include_dirs "${INCLUDE_DIRS}")
+set(_include_flags "")
+foreach(_dir IN LISTS _include_dirs)
+  if(_dir)
+    list(APPEND _include_flags "-I${_dir}")
+  endif()
+endforeach()
+
+file(MAKE_DIRECTORY "${OUTPUT_DIR}")
+
+foreach(_variant IN ITEMS prebuilt implicit)
+  set(_defines "")
+  if(_variant STREQUAL "implicit")
+    set(_defines "-DDANEJOE_STRINGIFY_NO_PREBUILT")
+  endif()
+  set(_total_us 0)
+  foreach(_run RANGE 1 ${RUN_COUNT})
+    string(TIMESTAMP _start "%s%f" UTC)
+    execute_process(
+      COMMAND "${COMPILER}" -std=c++20 -O2 ${_defines} ${_include_flags}
+              -c "${SOURCE}" -o "${OUTPUT_DIR}/${_variant}.o"
+      RESULT_VARIABLE _result
+    )
+    string(TIMESTAMP _end "%s%f" UTC)
+    if(NOT _result EQUAL 0)
+      message(FATAL_ERROR "compile failed for variant ${_variant}")
+    endif()
+    math(EXPR _total_us "${_total_us} + ${_end} - ${_start}")
+  endforeach()
+  math(EXPR _average_ms "${_total_us} / ${RUN_COUNT} / 1000")
+  file(SIZE "${OUTPUT_DIR}/${_variant}.o" _object_size)
+  message(STATUS "${_variant}: ${_average_ms} ms per compile, object ${_object_size} bytes")
+endforeach()
@@ -0,0 +1,95 @@
+#include <ostream>
+#include <string>
+#include <vector>
+#include <cstddef>
+
+#include "danejoe/stringify/stringify_to_string.hpp"
+
+#include "bench_common.hpp"
+
+namespace Sample
+{
+    /// @brief 通过to_string成员输出
+    struct MemberPoint
+    {
+        int x;
+        int y;
+        std::string to_string() const
+        {
+            return "(" + std::to_string(x) + ", " + std::to_string(y) + ")";
+        }
+    };
+    /// @brief 通过operator<<输出
+    struct StreamPoint
+    {
+        int x;
+        int y;
+    };
+    inline std::ostream& operator<<(std::ostream& os, const StreamPoint& point)
+    {
+        return os << "(" << point.x << ", " << point.y << ")";
+    }
+    /// @brief 通过自定义追加函数输出
+    struct AppendPoint
+    {
+        int x;
+        int y;
+    };
+    template<class Out>
+    void stringify_append(DaneJoe::StringifyWriter<Out>& writer, const AppendPoint& point)
+    {
+        writer.push_back('(');
+        writer.write(point.x);
+        writer.append(", ");
+        writer.write(point.y);
+        writer.push_back(')');
+    }
+}
+
+namespace
+{
+    /**
+     * @brief 渲染整个容器，输出每个元素的平均耗时
+     * @tparam T 元素类型
+     * @param name 用例名
+     * @param values 输入
+     */
+    template<class T>
+    void run_case(const char* name, const std::vector<T>& values)
+    {
+        const auto config = DaneJoe::StringifyConfigManager::get_config_snapshot();
+        DaneJoe::run_bench_case(name, values.size(), "value", [&]()
+            {
+                std::string output;
+                DaneJoe::append_to_string(output, values, *config);
+                return output.size();
+            });
+    }
+    /**
+     * @brief 生成测试数据
+     * @tparam T 元素类型
+     * @param count 数量
+     * @return 测试数据
+     */
+    template<class T>
+    std::vector<T> make_points(std::size_t count)
+    {
+        std::vector<T> values;
+        values.reserve(count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const int value = static_cast<int>(i * 2654435761u);
+            values.push_back({ value, -value });
+        }
+        return values;
+    }
+}
+
+int main()
+{
+    constexpr std::size_t value_count = 2000000;
+    run_case("to_string member", make_points<Sample::MemberPoint>(value_count));
+    run_case("operator<<", make_points<Sample::StreamPoint>(value_count));
+    run_case("stringify_append", make_points<Sample::AppendPoint>(value_count));
+    return 0;
+}
@@ -0,0 +1,69 @@
+#include <bitset>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <memory>
+#include <vector>
+#include <cstddef>
+
+#include "danejoe/stringify/stringify_to_string.hpp"
+
+#include "bench_common.hpp"
+
+namespace
+{
+    /**
+     * @brief 运行一次并输出每位的平均耗时
+     * @tparam T 位序列类型
+     * @param name 用例名
+     * @param value 位序列
+     * @param bit_count 位数
+     * @param config 配置
+     */
+    template<class T>
+    void run_case(const char* name, const T& value, std::size_t bit_count, const DaneJoe::StringifyConfig& config)
+    {
+        DaneJoe::run_bench_case(name, bit_count, "bit", [&]()
+            {
+                std::string out;
+                DaneJoe::append_to_string(out, value, config);
+                return out.size();
+            });
+    }
+}
+
+int main()
+{
+    constexpr std::size_t bit_count = 10000000;
+    std::mt19937_64 engine(20261018);
+    std::vector<uint64_t> words((bit_count + 63) / 64);
+    for (auto& word : words)
+    {
+        word = engine();
+    }
+    std::vector<bool> bits(bit_count);
+    for (std::size_t i = 0; i < bit_count; ++i)
+    {
+        bits[i] = (words[i / 64] >> (i % 64)) & 1;
+    }
+    const DaneJoe::BitSpan<> span(words.data(), bit_count);
+    auto bitset = std::make_unique<std::bitset<bit_count>>();
+    for (std::size_t i = 0; i < bit_count; ++i)
+    {
+        (*bitset)[i] = bits[i];
+    }
+
+    DaneJoe::StringifyConfig config;
+    run_case("vector<bool> element", bits, bit_count, config);
+    config.bit_format = DaneJoe::BitFormat::Binary;
+    run_case("vector<bool> binary", bits, bit_count, config);
+    run_case("bitset binary", *bitset, bit_count, config);
+    run_case("BitSpan binary", span, bit_count, config);
+    config.bit_group_symbol = " ";
+    run_case("BitSpan binary grouped", span, bit_count, config);
+    config.bit_group_symbol = "";
+    config.bit_format = DaneJoe::BitFormat::Hexadecimal;
+    run_case("vector<bool> hexadecimal", bits, bit_count, config);
+    run_case("BitSpan hexadecimal", span, bit_count, config);
+    return 0;
+}
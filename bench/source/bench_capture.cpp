@@ -0,0 +1,65 @@
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <cstddef>
+#include <cstdint>
+
+#include "danejoe/stringify/stringify_capture.hpp"
+#include "danejoe/stringify/stringify_to_string.hpp"
+
+namespace
+{
+    /// @brief 每轮记录数
+    constexpr std::size_t batch_size = 10000;
+    /// @brief 轮数
+    constexpr std::size_t round_count = 200;
+
+    /**
+     * @brief 对比内联渲染与延迟捕获的单条耗时
+     * @param capture 捕获会话
+     */
+    void run(DaneJoe::StringifyCapture& capture)
+    {
+        const std::string symbol = "ES";
+        const std::chrono::microseconds latency(17);
+        double capture_seconds = 0.0;
+        double render_seconds = 0.0;
+        std::size_t rendered_bytes = 0;
+        for (std::size_t round = 0; round < round_count; ++round)
+        {
+            auto start = std::chrono::steady_clock::now();
+            for (std::size_t i = 0; i < batch_size; ++i)
+            {
+                capture.capture(symbol, ' ', static_cast<int64_t>(i), ' ', 4321.25, ' ', latency);
+            }
+            capture_seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+            start = std::chrono::steady_clock::now();
+            for (std::size_t i = 0; i < batch_size; ++i)
+            {
+                std::string text = DaneJoe::to_string(symbol);
+                text += ' ';
+                text += DaneJoe::to_string(static_cast<int64_t>(i));
+                text += ' ';
+                text += DaneJoe::to_string(4321.25);
+                text += ' ';
+                text += DaneJoe::to_string(latency);
+                rendered_bytes += text.size();
+            }
+            render_seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            // 渲染在热路径之外进行，不计入捕获耗时
+            capture.drain([](std::string_view) {});
+        }
+        const double record_count = static_cast<double>(batch_size * round_count);
+        std::printf("capture  %8.1f ns/record\n", capture_seconds * 1e9 / record_count);
+        std::printf("to_string%8.1f ns/record (%zu bytes)\n", render_seconds * 1e9 / record_count, rendered_bytes);
+        std::printf("dropped  %8llu\n", static_cast<unsigned long long>(capture.get_dropped_count()));
+    }
+}
+
+int main()
+{
+    DaneJoe::StringifyCapture capture(1 << 22);
+    run(capture);
+    return 0;
+}
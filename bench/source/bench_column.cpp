@@ -0,0 +1,65 @@
+#include <cstdio>
+#include <cstdint>
+#include <random>
+#include <span>
+#include <string>
+#include <vector>
+#include <cstddef>
+
+#include "danejoe/stringify/stringify_column.hpp"
+#include "danejoe/stringify/stringify_to_string.hpp"
+
+#include "bench_common.hpp"
+
+namespace
+{
+    /**
+     * @brief 对比逐个to_string与列式输出
+     * @tparam T 值类型
+     * @param label 类型名
+     * @param values 值
+     */
+    template<class T>
+    void run_type(const char* label, const std::vector<T>& values)
+    {
+        std::printf("%s\n", label);
+        DaneJoe::run_bench_case("  to_string per value", values.size(), "value", [&]()
+            {
+                std::vector<std::string> column;
+                column.reserve(values.size());
+                std::size_t total_size = 0;
+                for (const T& value : values)
+                {
+                    column.push_back(DaneJoe::to_string(value));
+                    total_size += column.back().size();
+                }
+                return total_size;
+            });
+        DaneJoe::run_bench_case("  stringify_column", values.size(), "value", [&]()
+            {
+                std::string buffer;
+                std::vector<int64_t> offsets;
+                DaneJoe::stringify_column(std::span<const T>(values), buffer, offsets);
+                return buffer.size();
+            });
+    }
+}
+
+int main()
+{
+    constexpr std::size_t value_count = 5000000;
+    std::mt19937_64 engine(20261018);
+    std::vector<int64_t> integers;
+    std::vector<double> doubles;
+    integers.reserve(value_count);
+    doubles.reserve(value_count);
+    std::uniform_real_distribution<double> distribution(-1e6, 1e6);
+    for (std::size_t i = 0; i < value_count; ++i)
+    {
+        integers.push_back(static_cast<int64_t>(engine() >> (engine() % 64)));
+        doubles.push_back(distribution(engine));
+    }
+    run_type("int64_t", integers);
+    run_type("double", doubles);
+    return 0;
+}
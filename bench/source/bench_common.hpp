@@ -0,0 +1,67 @@
+/**
+ * @file bench_common.hpp
+ * @brief 运行期基准共用的计时与输出
+ * @author DaneJoe001
+ * @version 0.2.0
+ * @date 2026-10-19
+ * @details 各基准只提供被测函数与折算单位，计时方式与输出格式统一，
+ *          不同基准的结果可直接对照。
+ */
+#pragma once
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <cstddef>
+
+/**
+ * @namespace DaneJoe
+ * @brief DaneJoe 命名空间
+ */
+namespace DaneJoe
+{
+    /**
+     * @brief 计时运行一个用例，输出每单位耗时、每单位输出字节数与输出总字节数
+     * @tparam Function 被测函数类型
+     * @param name 用例名
+     * @param unit_count 单位数量（值、行、位或迭代次数），用于折算
+     * @param unit 单位名
+     * @param function 被测函数，返回输出字节数
+     */
+    template<class Function>
+    void run_bench_case(const char* name, std::size_t unit_count, const char* unit, Function function)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        const std::size_t size = function();
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        const double nanoseconds = static_cast<double>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+        const double count = static_cast<double>(unit_count == 0 ? 1 : unit_count);
+        std::printf("%-36s %10.2f ns/%-6s %8.2f bytes/%-6s %12zu bytes\n", name,
+            nanoseconds / count, unit, static_cast<double>(size) / count, unit, size);
+    }
+    /**
+     * @brief 逐个渲染值并计时，每个值渲染前清空输出
+     * @tparam Values 值序列类型
+     * @tparam Render 渲染函数类型
+     * @param name 用例名
+     * @param values 值序列
+     * @param render 渲染函数，将值追加到输出
+     */
+    template<class Values, class Render>
+    void run_bench_render_case(const char* name, const Values& values, Render render)
+    {
+        run_bench_case(name, values.size(), "value", [&]()
+            {
+                std::string output;
+                std::size_t total_size = 0;
+                for (const auto& value : values)
+                {
+                    output.clear();
+                    render(output, value);
+                    total_size += output.size();
+                }
+                return total_size;
+            });
+    }
+}
@@ -0,0 +1,83 @@
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+#include <cstddef>
+
+#include "danejoe/stringify/stringify_csv.hpp"
+#include "danejoe/stringify/stringify_to_string.hpp"
+
+#include "bench_common.hpp"
+
+namespace
+{
+    /**
+     * @struct CountingSink
+     * @brief 只统计字节数的输出端，排除磁盘的影响
+     */
+    struct CountingSink
+    {
+        std::size_t size = 0;
+        void append(const char*, std::size_t count)
+        {
+            size += count;
+        }
+    };
+}
+
+int main()
+{
+    constexpr std::size_t row_count = 2000000;
+    std::mt19937_64 engine(20261018);
+    std::uniform_real_distribution<double> distribution(-1e6, 1e6);
+    std::vector<std::tuple<long long, std::string, double>> rows;
+    rows.reserve(row_count);
+    for (std::size_t i = 0; i < row_count; ++i)
+    {
+        rows.emplace_back(static_cast<long long>(engine() >> 20),
+            i % 10 == 0 ? "name, with comma" : "plain_name_" + std::to_string(i % 1000), distribution(engine));
+    }
+
+    DaneJoe::run_bench_case("to_string per cell", row_count, "row", [&]()
+        {
+            CountingSink sink;
+            std::string line;
+            for (const auto& [id, name, value] : rows)
+            {
+                line.clear();
+                line += DaneJoe::to_string(id);
+                line += ',';
+                const std::string text = DaneJoe::to_string(name);
+                if (text.find_first_of(",\"\r\n") != std::string::npos)
+                {
+                    line += '"';
+                    for (char ch : text)
+                    {
+                        line += ch;
+                        if (ch == '"')
+                        {
+                            line += '"';
+                        }
+                    }
+                    line += '"';
+                }
+                else
+                {
+                    line += text;
+                }
+                line += ',';
+                line += DaneJoe::to_string(value);
+                line += "\r\n";
+                sink.append(line.data(), line.size());
+            }
+            return sink.size;
+        });
+    DaneJoe::run_bench_case("StringifyCsvWriter", row_count, "row", [&]()
+        {
+            CountingSink sink;
+            DaneJoe::stringify_csv(rows, sink, DaneJoe::StringifyCsvOptions(),
+                *DaneJoe::StringifyConfigManager::get_config_snapshot());
+            return sink.size;
+        });
+    return 0;
+}
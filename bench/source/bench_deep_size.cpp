@@ -0,0 +1,37 @@
+#include <map>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <cstddef>
+
+#include "danejoe/stringify/stringify_deep_size.hpp"
+#include "danejoe/stringify/stringify_to_string.hpp"
+
+#include "bench_common.hpp"
+
+int main()
+{
+    // 10万个键，映射值为字符串列表
+    std::map<std::string, std::vector<std::string>> value;
+    for (std::size_t i = 0; i < 100000; ++i)
+    {
+        auto& list = value["key-" + std::to_string(i) + std::string(i % 32, 'k')];
+        list.resize(i % 8);
+        for (std::size_t j = 0; j < list.size(); ++j)
+        {
+            list[j].assign(j * 8, 'v');
+        }
+    }
+
+    DaneJoe::run_bench_case("to_string", value.size(), "key", [&] { return DaneJoe::to_string(value).size(); });
+    DaneJoe::run_bench_case("deep_size", value.size(), "key", [&] { return DaneJoe::deep_size(value).get_total_size(); });
+    std::string report;
+    DaneJoe::run_bench_case("format_deep_size", value.size(), "key", [&]
+        {
+            report = DaneJoe::format_deep_size(value);
+            return report.size();
+        });
+    DaneJoe::run_bench_case("to_string", value.size(), "key", [&] { return DaneJoe::to_string(value).size(); });
+    std::printf("%s\n", report.c_str());
+    return 0;
+}
@@ -0,0 +1,31 @@
+#include <numeric>
+#include <string>
+#include <vector>
+#include <cstddef>
+
+#include "danejoe/stringify/stringify_diff.hpp"
+#include "danejoe/stringify/stringify_to_string.hpp"
+
+#include "bench_common.hpp"
+
+int main()
+{
+    constexpr std::size_t count = 1000000;
+    std::vector<long long> a(count);
+    std::iota(a.begin(), a.end(), 0LL);
+    std::vector<long long> b = a;
+    b[10] = -1;
+    b[count / 3] = -2;
+    b.erase(b.begin() + count / 2);
+    b.insert(b.begin() + count / 4 * 3, 7);
+
+    DaneJoe::run_bench_case("to_string both", count, "element", [&]()
+        {
+            return DaneJoe::to_string(a).size() + DaneJoe::to_string(b).size();
+        });
+    DaneJoe::run_bench_case("stringify_diff", count, "element", [&]()
+        {
+            return DaneJoe::stringify_diff(a, b).size();
+        });
+    return 0;
+}
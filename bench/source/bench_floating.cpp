@@ -0,0 +1,72 @@
+#include <cmath>
+#include <cstdio>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+#include <cstddef>
+
+#include "danejoe/stringify/stringify_to_string.hpp"
+
+#include "bench_common.hpp"
+
+int main()
+{
+    constexpr std::size_t value_count = 10000000;
+    // 混合分布：常见量级的小数、任意位模式的有限值
+    std::mt19937_64 engine(20261018);
+    std::uniform_real_distribution<double> price(0.0, 10000.0);
+    std::vector<double> values;
+    values.reserve(value_count);
+    while (values.size() < value_count)
+    {
+        if (values.size() % 2 == 0)
+        {
+            values.push_back(price(engine));
+            continue;
+        }
+        const uint64_t bits = engine();
+        double value;
+        std::memcpy(&value, &bits, sizeof(value));
+        if (std::isfinite(value))
+        {
+            values.push_back(value);
+        }
+    }
+
+    const auto config = DaneJoe::StringifyConfigManager::get_config_snapshot();
+    DaneJoe::StringifyConfig fixed_config = *config;
+    fixed_config.float_format = DaneJoe::FloatFormat::Fixed;
+    fixed_config.float_precision = 6;
+
+    DaneJoe::run_bench_render_case("std::to_string", values, [](std::string& out, double value)
+        {
+            out = std::to_string(value);
+        });
+    DaneJoe::run_bench_render_case("append fixed/6 (previous)", values, [&](std::string& out, double value)
+        {
+            DaneJoe::append_to_string(out, value, fixed_config);
+        });
+    DaneJoe::run_bench_render_case("append shortest", values, [&](std::string& out, double value)
+        {
+            DaneJoe::append_to_string(out, value, *config);
+        });
+    DaneJoe::run_bench_render_case("to_string shortest", values, [](std::string& out, double value)
+        {
+            out = DaneJoe::to_string(value);
+        });
+
+    // 校验最短表示可往返
+    std::size_t mismatch_count = 0;
+    std::string text;
+    for (std::size_t i = 0; i < values.size(); i += 97)
+    {
+        text.clear();
+        DaneJoe::append_to_string(text, values[i], *config);
+        mismatch_count += std::strtod(text.c_str(), nullptr) == values[i] ? 0 : 1;
+    }
+    std::printf("round-trip mismatches: %zu\n", mismatch_count);
+    return mismatch_count == 0 ? 0 : 1;
+}
@@ -0,0 +1,82 @@
+#include <map>
+#include <chrono>
+#include <random>
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <cstddef>
+#include <optional>
+
+#include "danejoe/stringify/stringify_parse.hpp"
+#include "danejoe/stringify/stringify_to_string.hpp"
+
+namespace
+{
+    /// @brief 单个用例的最短计时
+    constexpr std::chrono::milliseconds min_duration(500);
+
+    /**
+     * @brief 反复解析同一输入并输出吞吐量
+     * @tparam T 解析目标类型
+     * @param name 用例名
+     * @param value 用于生成输入的值
+     * @return 是否全部解析成功
+     */
+    template<class T>
+    bool run_case(const char* name, const T& value)
+    {
+        const std::string text = DaneJoe::to_string(value);
+        T parsed{};
+        std::size_t iteration_count = 0;
+        const auto start = std::chrono::steady_clock::now();
+        auto elapsed = std::chrono::steady_clock::duration::zero();
+        do
+        {
+            DaneJoe::FromStringStatus status = DaneJoe::from_string(text, parsed);
+            if (!status)
+            {
+                std::printf("%-28s failed at %zu: %s\n", name, status.offset,
+                    DaneJoe::get_from_string_error_message(status.error));
+                return false;
+            }
+            ++iteration_count;
+            elapsed = std::chrono::steady_clock::now() - start;
+        } while (elapsed < min_duration);
+        const double seconds = std::chrono::duration<double>(elapsed).count();
+        const double megabytes = static_cast<double>(text.size()) * static_cast<double>(iteration_count) / (1024.0 * 1024.0);
+        std::printf("%-28s %10zu bytes %8zu iters %10.2f MB/s\n",
+            name, text.size(), iteration_count, megabytes / seconds);
+        return true;
+    }
+}
+
+int main()
+{
+    constexpr std::size_t element_count = 100000;
+    std::mt19937_64 engine(20261018);
+    std::uniform_int_distribution<int> int_distribution(-1000000, 1000000);
+    std::uniform_real_distribution<double> real_distribution(-1.0e6, 1.0e6);
+
+    std::vector<int> ints;
+    std::vector<double> doubles;
+    std::map<std::string, int> words;
+    std::vector<std::pair<int, std::optional<bool>>> pairs;
+    ints.reserve(element_count);
+    doubles.reserve(element_count);
+    pairs.reserve(element_count);
+    for (std::size_t i = 0; i < element_count; ++i)
+    {
+        const int number = int_distribution(engine);
+        ints.push_back(number);
+        doubles.push_back(real_distribution(engine));
+        words.emplace("key_" + std::to_string(i), number);
+        pairs.emplace_back(number, (number % 3 == 0) ? std::nullopt : std::optional<bool>(number % 2 == 0));
+    }
+
+    bool is_ok = true;
+    is_ok = run_case("vector<int>", ints) && is_ok;
+    is_ok = run_case("vector<double>", doubles) && is_ok;
+    is_ok = run_case("map<string, int>", words) && is_ok;
+    is_ok = run_case("vector<pair<int, optional>>", pairs) && is_ok;
+    return is_ok ? 0 : 1;
+}
@@ -0,0 +1,79 @@
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <algorithm>
+
+#include "danejoe/stringify/stringify_generator.hpp"
+#include "danejoe/stringify/stringify_to_string.hpp"
+
+#if defined(DANEJOE_STRINGIFY_HAS_GENERATOR)
+
+namespace
+{
+    /**
+     * @brief 按块渲染并输出总耗时与单块最大耗时
+     * @param value 待渲染的值
+     * @param chunk_size 块大小
+     * @param config 配置
+     */
+    void run_chunks(const std::vector<std::vector<int>>& value, std::size_t chunk_size,
+        const DaneJoe::StringifyConfig& config)
+    {
+        using Clock = std::chrono::steady_clock;
+        auto generator = DaneJoe::stringify_chunks(value, chunk_size, config);
+        std::size_t size = 0;
+        std::size_t chunk_count = 0;
+        Clock::duration max_slice{};
+        const auto start = Clock::now();
+        auto slice_start = start;
+        while (generator.next())
+        {
+            const auto now = Clock::now();
+            max_slice = std::max(max_slice, now - slice_start);
+            size += generator.get_chunk().size();
+            ++chunk_count;
+            slice_start = now;
+        }
+        const double total = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        const double slice = std::chrono::duration<double, std::micro>(max_slice).count();
+        std::printf("chunks of %-8zu %10.1f ms total %10.1f us max slice %8zu chunks %12zu bytes\n",
+            chunk_size, total, slice, chunk_count, size);
+    }
+}
+
+int main()
+{
+    std::vector<std::vector<int>> value(20000, std::vector<int>(1000));
+    for (std::size_t i = 0; i < value.size(); ++i)
+    {
+        for (std::size_t j = 0; j < value[i].size(); ++j)
+        {
+            value[i][j] = static_cast<int>(i * j);
+        }
+    }
+    const DaneJoe::StringifyConfig config = DaneJoe::StringifyConfigManager::get_config();
+
+    const auto start = std::chrono::steady_clock::now();
+    std::string whole;
+    DaneJoe::append_to_string(whole, value, config);
+    const double total = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    std::printf("%-19s %10.1f ms total %10.1f us max slice %8d chunks %12zu bytes\n",
+        "to_string", total, total * 1000.0, 1, whole.size());
+
+    run_chunks(value, 16 * 1024, config);
+    run_chunks(value, 64 * 1024, config);
+    run_chunks(value, 1024 * 1024, config);
+    return 0;
+}
+
+#else
+
+int main()
+{
+    std::printf("coroutines are not available\n");
+    return 0;
+}
+
+#endif
@@ -0,0 +1,66 @@
+#include <charconv>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+#include <cstddef>
+
+#include "danejoe/stringify/stringify_to_string.hpp"
+
+#include "bench_common.hpp"
+
+int main()
+{
+    constexpr std::size_t value_count = 10000000;
+    // 位数均匀分布的64位整数
+    std::mt19937_64 engine(20261018);
+    std::vector<int64_t> values;
+    values.reserve(value_count);
+    for (std::size_t i = 0; i < value_count; ++i)
+    {
+        values.push_back(static_cast<int64_t>(engine() >> (engine() % 64)));
+    }
+
+    const auto config = DaneJoe::StringifyConfigManager::get_config_snapshot();
+    DaneJoe::StringifyConfig hex_config = *config;
+    hex_config.integer_base = DaneJoe::IntegerBase::Hexadecimal;
+    hex_config.is_show_integer_prefix = true;
+    DaneJoe::StringifyConfig grouped_config = *config;
+    grouped_config.integer_group_symbol = ",";
+
+    DaneJoe::run_bench_render_case("std::to_string", values, [](std::string& out, int64_t value)
+        {
+            out = std::to_string(value);
+        });
+    DaneJoe::run_bench_render_case("std::to_chars", values, [](std::string& out, int64_t value)
+        {
+            char buffer[24];
+            auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+            out.append(buffer, static_cast<std::size_t>(result.ptr - buffer));
+        });
+    DaneJoe::run_bench_render_case("append decimal", values, [&](std::string& out, int64_t value)
+        {
+            DaneJoe::append_to_string(out, value, *config);
+        });
+    DaneJoe::run_bench_render_case("append hex with prefix", values, [&](std::string& out, int64_t value)
+        {
+            DaneJoe::append_to_string(out, value, hex_config);
+        });
+    DaneJoe::run_bench_render_case("append grouped decimal", values, [&](std::string& out, int64_t value)
+        {
+            DaneJoe::append_to_string(out, value, grouped_config);
+        });
+#if defined(DANEJOE_STRINGIFY_HAS_INT128)
+    std::vector<unsigned __int128> wide_values;
+    wide_values.reserve(value_count);
+    for (std::size_t i = 0; i < value_count; ++i)
+    {
+        wide_values.push_back((static_cast<unsigned __int128>(engine()) << 64 | engine()) >> (engine() % 128));
+    }
+    DaneJoe::run_bench_render_case("append unsigned __int128", wide_values, [&](std::string& out, unsigned __int128 value)
+        {
+            DaneJoe::append_to_string(out, value, *config);
+        });
+#endif
+    return 0;
+}
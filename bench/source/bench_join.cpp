@@ -0,0 +1,79 @@
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+#include "danejoe/stringify/stringify_join.hpp"
+#include "danejoe/stringify/stringify_to_string.hpp"
+
+#include "bench_common.hpp"
+
+namespace
+{
+    /**
+     * @brief 运行多次并输出每次的平均耗时
+     * @tparam Function 函数类型
+     * @param name 用例名
+     * @param iteration_count 次数
+     * @param function 被测函数，参数为迭代序号，返回输出字节数
+     */
+    template<class Function>
+    void run_case(const char* name, std::size_t iteration_count, Function function)
+    {
+        DaneJoe::run_bench_case(name, iteration_count, "op", [&]()
+            {
+                std::size_t size = 0;
+                for (std::size_t i = 0; i < iteration_count; ++i)
+                {
+                    size += function(i);
+                }
+                return size;
+            });
+    }
+}
+
+int main()
+{
+    constexpr std::size_t iteration_count = 1000000;
+    const std::string service = "storage-gateway";
+    const std::string path = "/var/lib/gateway/segments/000042.dat";
+
+    // 10个参数的日志行
+    run_case("operator+ on to_string", iteration_count, [&](std::size_t i)
+        {
+            const std::string line = DaneJoe::to_string(service) + " " + DaneJoe::to_string(i) + " " +
+                DaneJoe::to_string(path) + " " + DaneJoe::to_string(i * 4096) + " " + DaneJoe::to_string(i % 2 == 0) +
+                " " + DaneJoe::to_string(static_cast<int64_t>(i) - 500000);
+            return line.size();
+        });
+    run_case("str_cat", iteration_count, [&](std::size_t i)
+        {
+            const std::string line = DaneJoe::str_cat(service, ' ', i, ' ', path, ' ', i * 4096, ' ',
+                i % 2 == 0, ' ', static_cast<int64_t>(i) - 500000);
+            return line.size();
+        });
+
+    std::vector<int> values(64);
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+        values[i] = static_cast<int>(i * 7919);
+    }
+    run_case("join by repeated +=", iteration_count / 10, [&](std::size_t)
+        {
+            std::string result;
+            for (std::size_t i = 0; i < values.size(); ++i)
+            {
+                if (i != 0)
+                {
+                    result += ", ";
+                }
+                result += DaneJoe::to_string(values[i]);
+            }
+            return result.size();
+        });
+    run_case("join", iteration_count / 10, [&](std::size_t)
+        {
+            return DaneJoe::join(values, ", ").size();
+        });
+    return 0;
+}
@@ -0,0 +1,72 @@
+#include <any>
+#include <string>
+#include <vector>
+#include <cstddef>
+
+#include "danejoe/stringify/stringify_registry.hpp"
+#include "danejoe/stringify/stringify_to_string.hpp"
+
+#include "bench_common.hpp"
+
+namespace
+{
+    /// @brief 只能经注册表输出的类型
+    struct PluginPoint
+    {
+        int x;
+        int y;
+    };
+    /**
+     * @brief 追加PluginPoint
+     * @param out 输出
+     * @param point 对象
+     * @param config 配置
+     */
+    void append_point(std::string& out, const PluginPoint& point, const DaneJoe::StringifyConfig& config)
+    {
+        out.push_back('(');
+        DaneJoe::append_to_string(out, point.x, config);
+        out.append(", ");
+        DaneJoe::append_to_string(out, point.y, config);
+        out.push_back(')');
+    }
+}
+
+int main()
+{
+    constexpr std::size_t value_count = 5000000;
+    std::vector<int> integers;
+    std::vector<PluginPoint> points;
+    std::vector<std::any> anys;
+    integers.reserve(value_count);
+    points.reserve(value_count);
+    anys.reserve(value_count);
+    for (std::size_t i = 0; i < value_count; ++i)
+    {
+        const int value = static_cast<int>(i * 2654435761u);
+        integers.push_back(value);
+        points.push_back({ value, -value });
+        anys.emplace_back(value);
+    }
+    DaneJoe::register_formatter<PluginPoint>(append_point);
+    const auto config = DaneJoe::StringifyConfigManager::get_config_snapshot();
+
+    // 编译期分发的路径不查找注册表，用作基线
+    DaneJoe::run_bench_render_case("int (compile-time)", integers, [&](std::string& out, int value)
+        {
+            DaneJoe::append_to_string(out, value, *config);
+        });
+    DaneJoe::run_bench_render_case("PluginPoint (direct call)", points, [&](std::string& out, const PluginPoint& point)
+        {
+            append_point(out, point, *config);
+        });
+    DaneJoe::run_bench_render_case("PluginPoint (registry)", points, [&](std::string& out, const PluginPoint& point)
+        {
+            DaneJoe::append_to_string(out, point, *config);
+        });
+    DaneJoe::run_bench_render_case("std::any<int> (registry)", anys, [&](std::string& out, const std::any& value)
+        {
+            DaneJoe::append_to_string(out, value, *config);
+        });
+    return 0;
+}
@@ -0,0 +1,58 @@
+#include <string>
+#include <cstddef>
+
+#include "danejoe/stringify/stringify_to_string.hpp"
+
+#include "bench_common.hpp"
+
+namespace
+{
+    /// @brief 单个用例的重复次数
+    constexpr std::size_t iteration_count = 100;
+
+    /**
+     * @brief 反复转码同一输入并输出每个代码单元的平均耗时
+     * @tparam Text 字符串类型
+     * @param name 用例名
+     * @param text 输入
+     */
+    template<class Text>
+    void run_case(const char* name, const Text& text)
+    {
+        DaneJoe::run_bench_case(name, text.size() * iteration_count, "unit", [&]()
+            {
+                const auto config = DaneJoe::StringifyConfigManager::get_config_snapshot();
+                std::string output;
+                output.reserve(text.size() * 4);
+                std::size_t total_size = 0;
+                for (std::size_t i = 0; i < iteration_count; ++i)
+                {
+                    output.clear();
+                    DaneJoe::append_to_string(output, text, *config);
+                    total_size += output.size();
+                }
+                return total_size;
+            });
+    }
+}
+
+int main()
+{
+    constexpr std::size_t repeat_count = 1 << 16;
+    std::u16string ascii16;
+    std::u16string mixed16;
+    std::u32string ascii32;
+    std::wstring ascii_wide;
+    for (std::size_t i = 0; i < repeat_count; ++i)
+    {
+        ascii16 += u"telemetry-event ";
+        mixed16 += u"température 温度 ";
+        ascii32 += U"telemetry-event ";
+        ascii_wide += L"telemetry-event ";
+    }
+    run_case("u16string ascii", ascii16);
+    run_case("u16string mixed", mixed16);
+    run_case("u32string ascii", ascii32);
+    run_case("wstring ascii", ascii_wide);
+    return 0;
+}
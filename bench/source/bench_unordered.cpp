@@ -0,0 +1,70 @@
+#include <cstdint>
+#include <map>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <cstddef>
+
+#include "danejoe/stringify/stringify_to_string.hpp"
+
+#include "bench_common.hpp"
+
+namespace
+{
+    /// @brief 单个用例的重复次数
+    constexpr std::size_t repeat_count = 5;
+
+    /**
+     * @brief 反复渲染同一容器并输出平均耗时
+     * @tparam T 容器类型
+     * @param name 用例名
+     * @param value 容器
+     * @param config 配置
+     */
+    template<class T>
+    void run_case(const char* name, const T& value, const DaneJoe::StringifyConfig& config)
+    {
+        DaneJoe::run_bench_case(name, repeat_count * value.size(), "entry", [&]()
+            {
+                std::string output;
+                std::size_t total_size = 0;
+                for (std::size_t i = 0; i < repeat_count; ++i)
+                {
+                    output.clear();
+                    DaneJoe::append_to_string(output, value, config);
+                    total_size += output.size();
+                }
+                return total_size;
+            });
+    }
+}
+
+int main()
+{
+    constexpr std::size_t entry_count = 1000000;
+    std::mt19937_64 engine(20261018);
+    std::unordered_map<int64_t, int64_t> integer_map;
+    std::unordered_map<std::string, int> string_map;
+    integer_map.reserve(entry_count);
+    string_map.reserve(entry_count);
+    while (integer_map.size() < entry_count)
+    {
+        const auto key = static_cast<int64_t>(engine() % 1000000000000ull);
+        integer_map.emplace(key, static_cast<int64_t>(integer_map.size()));
+        string_map.emplace("key-" + std::to_string(key), static_cast<int>(string_map.size()));
+    }
+    const std::map<int64_t, int64_t> ordered_integer_map(integer_map.begin(), integer_map.end());
+    const std::map<std::string, int> ordered_string_map(string_map.begin(), string_map.end());
+
+    const DaneJoe::StringifyConfig bucket_config;
+    DaneJoe::StringifyConfig sorted_config;
+    sorted_config.is_sort_unordered_container = true;
+
+    run_case("unordered_map<int64> bucket order", integer_map, bucket_config);
+    run_case("unordered_map<int64> sorted", integer_map, sorted_config);
+    run_case("map<int64>", ordered_integer_map, bucket_config);
+    run_case("unordered_map<string> bucket order", string_map, bucket_config);
+    run_case("unordered_map<string> sorted", string_map, sorted_config);
+    run_case("map<string>", ordered_string_map, bucket_config);
+    return 0;
+}
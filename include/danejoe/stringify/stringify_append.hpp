@@ -0,0 +1,1082 @@
+/**
+ * @file stringify_append.hpp
+ * @brief 追加式字符串化引擎
+ * @author DaneJoe001
+ * @version 0.2.0
+ * @date 2026-10-18
+ * @details 所有分支直接向同一个输出缓冲追加内容，不产生中间字符串。
+ *          输出类型Out只需提供append(const char*, std::size_t)与push_back(char)，
+ *          因此std::string、std::pmr::string及任意分配器的std::basic_string均可直接使用。
+ */
+#pragma once
+
+#include <any>
+#include <string>
+#include <chrono>
+#include <ctime>
+#include <tuple>
+#include <limits>
+#include <algorithm>
+#include <variant>
+#include <vector>
+#include <typeinfo>
+#include <cstddef>
+#include <cstdint>
+#include <charconv>
+#include <ranges>
+#include <iterator>
+#include <sstream>
+#include <ostream>
+#include <streambuf>
+#include <iomanip>
+#include <string_view>
+#include <type_traits>
+#include <system_error>
+
+#include "danejoe/common/type_traits/std_type_traits.hpp"
+#include "danejoe/common/type_traits/container_traits.hpp"
+#include "danejoe/stringify/stringify_config.hpp"
+#include "danejoe/stringify/stringify_traits.hpp"
+#include "danejoe/stringify/stringify_stats.hpp"
+#include "danejoe/stringify/stringify_unicode.hpp"
+#include "danejoe/stringify/stringify_integer.hpp"
+#include "danejoe/stringify/stringify_bits.hpp"
+#include "danejoe/stringify/stringify_registry.hpp"
+
+ /**
+  * @namespace DaneJoe
+  * @brief DaneJoe 命名空间
+  */
+namespace DaneJoe
+{
+    /**
+     * @brief 通用追加接口
+     * @tparam Out 输出类型
+     * @tparam T 类型
+     * @param out 输出缓冲
+     * @param value 对象
+     * @param config 配置
+     */
+    template<class Out, class T>
+    void append_to_string(Out& out, const T& value, const StringifyConfig& config);
+    /**
+     * @brief 追加字符串片段
+     * @tparam Out 输出类型
+     * @param out 输出缓冲
+     * @param text 字符串片段
+     */
+    template<class Out>
+    void append_text(Out& out, std::string_view text)
+    {
+        out.append(text.data(), text.size());
+    }
+    /**
+     * @class StringifyWriter
+     * @brief 传给自定义追加函数的输出包装
+     * @tparam Out 输出类型
+     * @details 用户类型在所在命名空间中定义
+     *          template<class Out> void stringify_append(DaneJoe::StringifyWriter<Out>&, const T&)，
+     *          即可直接写入库的输出缓冲（std::string、定长缓冲等），无需构造临时字符串。
+     *          该自定义点优先于to_string成员与operator<<。
+     */
+    template<class Out>
+    class StringifyWriter
+    {
+    public:
+        /**
+         * @brief 构造函数
+         * @param out 输出缓冲
+         * @param config 配置
+         */
+        StringifyWriter(Out& out, const StringifyConfig& config) noexcept
+            : m_out(out), m_config(config)
+        {}
+        /**
+         * @brief 追加字符序列
+         * @param data 字符序列
+         * @param size 字符数量
+         */
+        void append(const char* data, std::size_t size)
+        {
+            m_out.append(data, size);
+        }
+        /**
+         * @brief 追加字符串片段
+         * @param text 字符串片段
+         */
+        void append(std::string_view text)
+        {
+            m_out.append(text.data(), text.size());
+        }
+        /**
+         * @brief 追加单个字符
+         * @param ch 字符
+         */
+        void push_back(char ch)
+        {
+            m_out.push_back(ch);
+        }
+        /**
+         * @brief 按库的规则追加任意值
+         * @tparam T 类型
+         * @param value 对象
+         * @note 用于输出成员，遵循当前配置
+         */
+        template<class T>
+        void write(const T& value)
+        {
+            append_to_string(m_out, value, m_config);
+        }
+        /**
+         * @brief 获取配置
+         * @return 配置
+         */
+        const StringifyConfig& get_config() const noexcept
+        {
+            return m_config;
+        }
+        /**
+         * @brief 获取底层输出缓冲
+         * @return 输出缓冲
+         */
+        Out& get_output() noexcept
+        {
+            return m_out;
+        }
+    private:
+        /// @brief 输出缓冲
+        Out& m_out;
+        /// @brief 配置
+        const StringifyConfig& m_config;
+    };
+    /**
+     * @class AppendStreamBuffer
+     * @brief 将流输出直接追加到输出缓冲的流缓冲
+     * @tparam Out 输出类型
+     * @details 配合std::ostream使用，operator<<与std::put_time的输出直接写入out，
+     *          不经过std::ostringstream的临时字符串，分配来自输出缓冲自身的分配器。
+     */
+    template<class Out>
+    class AppendStreamBuffer : public std::streambuf
+    {
+    public:
+        /**
+         * @brief 构造函数
+         * @param out 输出缓冲
+         */
+        explicit AppendStreamBuffer(Out& out) noexcept : m_out(out) {}
+    protected:
+        std::streamsize xsputn(const char* data, std::streamsize size) override
+        {
+            m_out.append(data, static_cast<std::size_t>(size));
+            return size;
+        }
+        int_type overflow(int_type ch) override
+        {
+            if (!traits_type::eq_int_type(ch, traits_type::eof()))
+            {
+                m_out.push_back(traits_type::to_char_type(ch));
+            }
+            return traits_type::not_eof(ch);
+        }
+    private:
+        /// @brief 输出缓冲
+        Out& m_out;
+    };
+    /**
+     * @brief 追加浮点数
+     * @tparam Out 输出类型
+     * @tparam T 浮点类型
+     * @param out 输出缓冲
+     * @param value 浮点数
+     * @param format 浮点格式
+     * @param precision 精度，小于0时输出该格式下可往返的最短表示
+     * @note 基于std::to_chars，不受locale影响；超出栈缓冲的定点表示在可调整大小的输出上原地转换，
+     *       其他输出类型使用临时std::string
+     */
+    template<class Out, class T, std::enable_if_t<
+        std::is_floating_point<T>::value, int> = 0>
+    void append_floating(Out& out, T value,
+        std::chars_format format = std::chars_format::fixed, int precision = 6)
+    {
+        auto convert = [&](char* first, char* last)
+            {
+                return precision < 0 ?
+                    std::to_chars(first, last, value, format) :
+                    std::to_chars(first, last, value, format, precision);
+            };
+        char buffer[128];
+        auto result = convert(buffer, buffer + sizeof(buffer));
+        if (result.ec == std::errc())
+        {
+            out.append(buffer, static_cast<std::size_t>(result.ptr - buffer));
+            return;
+        }
+        // 极大数值的定点表示超出栈缓冲时改用足够大的缓冲
+        const std::size_t max_size = static_cast<std::size_t>(std::numeric_limits<T>::max_exponent10) +
+            static_cast<std::size_t>(std::max(precision, std::numeric_limits<T>::max_digits10)) + 16;
+        if constexpr (requires { out.resize(std::size_t()); out.data(); })
+        {
+            // 直接在输出缓冲的尾部转换，空间来自输出自身的分配器
+            const std::size_t begin = out.size();
+            out.resize(begin + max_size);
+            result = convert(out.data() + begin, out.data() + begin + max_size);
+            out.resize(static_cast<std::size_t>(result.ptr - out.data()));
+        }
+        else
+        {
+            std::string heap_buffer(max_size, '\0');
+            result = convert(heap_buffer.data(), heap_buffer.data() + heap_buffer.size());
+            out.append(heap_buffer.data(), static_cast<std::size_t>(result.ptr - heap_buffer.data()));
+        }
+    }
+    /**
+     * @brief 按配置追加浮点数
+     * @tparam Out 输出类型
+     * @tparam T 浮点类型
+     * @param out 输出缓冲
+     * @param value 浮点数
+     * @param config 配置，使用float_format与float_precision
+     */
+    template<class Out, class T, std::enable_if_t<
+        std::is_floating_point<T>::value, int> = 0>
+    void append_floating(Out& out, T value, const StringifyConfig& config)
+    {
+        switch (config.float_format)
+        {
+        case FloatFormat::Fixed:
+            append_floating(out, value, std::chars_format::fixed, config.float_precision);
+            break;
+        case FloatFormat::Scientific:
+            append_floating(out, value, std::chars_format::scientific, config.float_precision);
+            break;
+        case FloatFormat::General:
+            append_floating(out, value, std::chars_format::general, config.float_precision);
+            break;
+        case FloatFormat::Shortest:
+        default:
+        {
+            char buffer[64];
+            auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+            out.append(buffer, static_cast<std::size_t>(result.ptr - buffer));
+            break;
+        }
+        }
+    }
+    /**
+     * @brief 追加算术类型（std::to_string分支）
+     * @tparam Out 输出类型
+     * @tparam T 类型
+     * @param out 输出缓冲
+     * @param value 对象
+     * @param config 配置
+     * @note 整数（含128位整数）按配置的进制、补零与分组输出，浮点数按配置的格式与精度输出，不产生临时字符串
+     */
+    template<class Out, class T, std::enable_if_t<
+        has_std_to_string<T>::value || is_int128<T>::value, int> = 0>
+    void append_std_to_string(Out& out, const T& value, const StringifyConfig& config)
+    {
+        if constexpr (is_integer_value<T>::value)
+        {
+            append_integer(out, value, config);
+        }
+        else if constexpr (std::is_floating_point_v<T>)
+        {
+            append_floating(out, value, config);
+        }
+        else
+        {
+            append_text(out, std::to_string(value));
+        }
+    }
+    /**
+     * @brief 追加枚举
+     * @tparam Out 输出类型
+     * @tparam T 枚举类型
+     * @param out 输出缓冲
+     * @param value 枚举值
+     * @param config 配置
+     */
+    template<class Out, class T, std::enable_if_t<
+        std::is_enum<T>::value, int> = 0>
+    void append_enum(Out& out, const T& value, const StringifyConfig& config)
+    {
+        using U = typename std::underlying_type<T>::type;
+        append_text(out, config.enum_symbol.type_symbol.start_maker);
+        append_text(out, typeid(value).name());
+        append_text(out, config.enum_symbol.type_symbol.end_maker);
+        append_text(out, config.enum_symbol.value_symbol.start_maker);
+        append_integer(out, static_cast<U>(value));
+        append_text(out, config.enum_symbol.value_symbol.end_maker);
+    }
+    /**
+     * @brief 追加布尔
+     * @tparam Out 输出类型
+     * @param out 输出缓冲
+     * @param value 布尔值
+     * @param config 配置
+     */
+    template<class Out>
+    void append_bool(Out& out, bool value, const StringifyConfig& config)
+    {
+        append_text(out, value ?
+            config.bool_symbol.true_symbol :
+            config.bool_symbol.false_symbol);
+    }
+    /**
+     * @brief 追加C字符串
+     * @tparam Out 输出类型
+     * @param out 输出缓冲
+     * @param value C字符串
+     * @param config 配置
+     */
+    template<class Out>
+    void append_c_string(Out& out, const char* value, const StringifyConfig& config)
+    {
+        if (value == nullptr)
+        {
+            append_text(out, config.null_value_symbol);
+            return;
+        }
+        append_text(out, value);
+    }
+    /**
+     * @brief 追加非char字符的C字符串，转为UTF-8
+     * @tparam Out 输出类型
+     * @tparam CharT 字符类型
+     * @param out 输出缓冲
+     * @param value C字符串
+     * @param config 配置
+     */
+    template<class Out, class CharT>
+    void append_unicode_c_string(Out& out, const CharT* value, const StringifyConfig& config)
+    {
+        if (value == nullptr)
+        {
+            append_text(out, config.null_value_symbol);
+            return;
+        }
+        append_utf8(out, value, std::char_traits<CharT>::length(value));
+    }
+    /**
+     * @brief 追加std::chrono::duration
+     * @tparam Out 输出类型
+     * @tparam Period 时长类型
+     * @param out 输出缓冲
+     * @param period 时长
+     * @param config 配置
+     */
+    template<class Out, class Period, std::enable_if_t<
+        is_chrono_duration<Period>::value, int> = 0>
+    void append_time_duration(Out& out, const Period& period, const StringifyConfig& config)
+    {
+        using Rep = typename Period::rep;
+        if constexpr (std::is_integral_v<Rep>)
+        {
+            append_integer(out, period.count(), config);
+        }
+        else if constexpr (std::is_floating_point_v<Rep>)
+        {
+            append_floating(out, period.count(), config);
+        }
+        else
+        {
+            AppendStreamBuffer<Out> buffer(out);
+            std::ostream stream(&buffer);
+            stream << period.count();
+        }
+        if constexpr (is_chrono_microseconds<Period>::value)
+        {
+            append_text(out, config.time_symbol.microsecond_symbol);
+        }
+        else if constexpr (is_chrono_milliseconds<Period>::value)
+        {
+            append_text(out, config.time_symbol.millisecond_symbol);
+        }
+        else if constexpr (is_chrono_nanoseconds<Period>::value)
+        {
+            append_text(out, config.time_symbol.nanosecond_symbol);
+        }
+        else if constexpr (is_chrono_seconds<Period>::value)
+        {
+            append_text(out, config.time_symbol.second_symbol);
+        }
+    }
+    /**
+     * @brief 追加std::chrono::time_point
+     * @tparam Out 输出类型
+     * @tparam Period 时间点类型
+     * @param out 输出缓冲
+     * @param period 时间点
+     * @param format 时间格式（strftime/put_time 格式字符串）
+     */
+    template<class Out, class Period, std::enable_if_t<
+        is_chrono_time_point<Period>::value, int> = 0>
+    void append_time_point(Out& out, const Period& period, const char* format = "%Y-%m-%d %H:%M:%S")
+    {
+        std::time_t raw_time_t = std::chrono::system_clock::to_time_t(period);
+        std::tm time_info;
+        std::tm* time_info_ptr = nullptr;
+#if defined(_WIN32)
+        localtime_s(&time_info, &raw_time_t); // Windows
+        time_info_ptr = &time_info;
+#elif defined(__linux__)
+        localtime_r(&raw_time_t, &time_info); // Linux
+        time_info_ptr = &time_info;
+#elif defined(__APPLE__)
+        localtime_r(&raw_time_t, &time_info); // macOS
+        time_info_ptr = &time_info;
+#else
+        time_info_ptr = std::localtime(&raw_time_t);
+#endif
+        char buffer[256];
+        std::size_t length = std::strftime(buffer, sizeof(buffer), format, time_info_ptr);
+        if (length > 0 || format[0] == '\0')
+        {
+            out.append(buffer, length);
+            return;
+        }
+        // 结果超出栈缓冲时退回put_time，直接写入输出缓冲
+        AppendStreamBuffer<Out> buffer_stream(out);
+        std::ostream stream(&buffer_stream);
+        stream << std::put_time(time_info_ptr, format);
+    }
+    /**
+     * @brief 追加带分隔符的元素序列
+     * @tparam Out 输出类型
+     * @tparam Iterator 迭代器类型
+     * @tparam Sentinel 结束标记类型
+     * @param out 输出缓冲
+     * @param first 起始迭代器
+     * @param last 结束标记
+     * @param symbol 分隔符号
+     * @param config 配置
+     */
+    template<class Out, class Iterator, class Sentinel>
+    void append_sequence(Out& out, Iterator first, Sentinel last,
+        const DelimiterSymbol& symbol, const StringifyConfig& config)
+    {
+        append_text(out, symbol.start_maker);
+        std::size_t count = 0;
+        for (bool is_first = true; first != last; ++first, ++count)
+        {
+            if constexpr (has_exhausted<Out>::value)
+            {
+                // 定长输出已写满时不再遍历剩余元素
+                if (out.exhausted())
+                {
+                    break;
+                }
+            }
+            if (!is_first)
+            {
+                append_text(out, symbol.element_separator);
+                append_text(out, symbol.space_maker);
+            }
+            is_first = false;
+            if (config.max_stringify_element_count >= 0 &&
+                count >= static_cast<std::size_t>(config.max_stringify_element_count))
+            {
+                append_text(out, config.ellipsis_symbol);
+                break;
+            }
+            append_to_string(out, *first, config);
+        }
+        append_text(out, symbol.end_maker);
+    }
+    /**
+     * @class DereferenceIterator
+     * @brief 解引用指针序列的迭代器，用于按排序后的元素指针遍历容器
+     * @tparam Iterator 指针序列的迭代器类型
+     */
+    template<class Iterator>
+    class DereferenceIterator
+    {
+    public:
+        DereferenceIterator() = default;
+        explicit DereferenceIterator(Iterator current) : m_current(current) {}
+        decltype(auto) operator*() const
+        {
+            return **m_current;
+        }
+        DereferenceIterator& operator++()
+        {
+            ++m_current;
+            return *this;
+        }
+        DereferenceIterator operator++(int)
+        {
+            DereferenceIterator old = *this;
+            ++m_current;
+            return old;
+        }
+        bool operator==(const DereferenceIterator& other) const
+        {
+            return m_current == other.m_current;
+        }
+        bool operator!=(const DereferenceIterator& other) const
+        {
+            return m_current != other.m_current;
+        }
+    private:
+        /// @brief 当前位置
+        Iterator m_current{};
+    };
+    /**
+     * @brief 获取无序容器元素的键
+     * @tparam T 容器类型
+     * @param element 元素
+     * @return 集合返回元素本身，映射返回first
+     */
+    template<class T>
+    const typename T::key_type& get_unordered_key(const typename T::value_type& element)
+    {
+        if constexpr (std::is_same_v<typename T::key_type, typename T::value_type>)
+        {
+            return element;
+        }
+        else
+        {
+            return element.first;
+        }
+    }
+    /**
+     * @brief 获取按键排序的无序容器元素指针
+     * @tparam T 容器类型
+     * @param value 容器
+     * @param config 配置
+     * @return 元素指针，只复制指针、算术类型的键与字符串键的前8字节，不复制元素
+     * @note 键支持operator<时按键排序，否则按哈希值排序，哈希冲突时按键的字符串比较；
+     *       键相同（multi容器）时再按映射值的operator<排序。
+     *       设置了max_stringify_element_count时只保证输出的前若干个元素有序
+     */
+    template<class T>
+    std::vector<const typename T::value_type*> get_sorted_elements(const T& value, const StringifyConfig& config)
+    {
+        using Element = typename T::value_type;
+        using Key = typename T::key_type;
+        const std::size_t sorted_count = config.max_stringify_element_count >= 0 &&
+            static_cast<std::size_t>(config.max_stringify_element_count) < value.size() ?
+            static_cast<std::size_t>(config.max_stringify_element_count) : value.size();
+        auto sort_prefix = [sorted_count](auto first, auto last, auto less)
+            {
+                if (static_cast<std::size_t>(last - first) == sorted_count)
+                {
+                    std::sort(first, last, less);
+                }
+                else
+                {
+                    std::partial_sort(first, first + static_cast<std::ptrdiff_t>(sorted_count), last, less);
+                }
+            };
+        auto is_mapped_less = [](const Element* lhs, const Element* rhs)
+            {
+                if constexpr (!std::is_same_v<Key, Element>)
+                {
+                    if constexpr (has_less_than<typename T::mapped_type>::value)
+                    {
+                        return static_cast<bool>(lhs->second < rhs->second);
+                    }
+                }
+                return false;
+            };
+        std::vector<const Element*> elements;
+        elements.reserve(value.size());
+        if constexpr (std::is_arithmetic_v<Key> || std::is_enum_v<Key>)
+        {
+            // 键连同指针排序，比较时无需解引用
+            std::vector<std::pair<Key, const Element*>> keyed_elements;
+            keyed_elements.reserve(value.size());
+            for (const Element& element : value)
+            {
+                keyed_elements.emplace_back(get_unordered_key<T>(element), &element);
+            }
+            sort_prefix(keyed_elements.begin(), keyed_elements.end(),
+                [&](const auto& lhs, const auto& rhs)
+                {
+                    if (lhs.first < rhs.first)
+                    {
+                        return true;
+                    }
+                    if (rhs.first < lhs.first)
+                    {
+                        return false;
+                    }
+                    return is_mapped_less(lhs.second, rhs.second);
+                });
+            for (const auto& keyed_element : keyed_elements)
+            {
+                elements.push_back(keyed_element.second);
+            }
+        }
+        else if constexpr (is_narrow_std_string<Key>::value)
+        {
+            // 以前8字节作为缩略键，缩略键相同时再比较完整字符串
+            auto get_prefix = [](std::string_view text)
+                {
+                    uint64_t prefix = 0;
+                    const std::size_t size = text.size() < sizeof(prefix) ? text.size() : sizeof(prefix);
+                    for (std::size_t i = 0; i < sizeof(prefix); ++i)
+                    {
+                        prefix = (prefix << 8) | (i < size ? static_cast<unsigned char>(text[i]) : 0u);
+                    }
+                    return prefix;
+                };
+            std::vector<std::pair<uint64_t, const Element*>> keyed_elements;
+            keyed_elements.reserve(value.size());
+            for (const Element& element : value)
+            {
+                keyed_elements.emplace_back(get_prefix(get_unordered_key<T>(element)), &element);
+            }
+            sort_prefix(keyed_elements.begin(), keyed_elements.end(),
+                [&](const auto& lhs, const auto& rhs)
+                {
+                    if (lhs.first != rhs.first)
+                    {
+                        return lhs.first < rhs.first;
+                    }
+                    const int result = std::string_view(get_unordered_key<T>(*lhs.second)).compare(
+                        std::string_view(get_unordered_key<T>(*rhs.second)));
+                    if (result != 0)
+                    {
+                        return result < 0;
+                    }
+                    return is_mapped_less(lhs.second, rhs.second);
+                });
+            for (const auto& keyed_element : keyed_elements)
+            {
+                elements.push_back(keyed_element.second);
+            }
+        }
+        else
+        {
+            for (const Element& element : value)
+            {
+                elements.push_back(&element);
+            }
+            const auto hasher = value.hash_function();
+            const auto key_equal = value.key_eq();
+            sort_prefix(elements.begin(), elements.end(),
+                [&](const Element* lhs, const Element* rhs)
+                {
+                    const Key& lhs_key = get_unordered_key<T>(*lhs);
+                    const Key& rhs_key = get_unordered_key<T>(*rhs);
+                    if constexpr (has_less_than<Key>::value)
+                    {
+                        if (lhs_key < rhs_key)
+                        {
+                            return true;
+                        }
+                        if (rhs_key < lhs_key)
+                        {
+                            return false;
+                        }
+                    }
+                    else
+                    {
+                        const std::size_t lhs_hash = hasher(lhs_key);
+                        const std::size_t rhs_hash = hasher(rhs_key);
+                        if (lhs_hash != rhs_hash)
+                        {
+                            return lhs_hash < rhs_hash;
+                        }
+                        if (!key_equal(lhs_key, rhs_key))
+                        {
+                            std::string lhs_text;
+                            std::string rhs_text;
+                            append_to_string(lhs_text, lhs_key, config);
+                            append_to_string(rhs_text, rhs_key, config);
+                            return lhs_text < rhs_text;
+                        }
+                    }
+                    return is_mapped_less(lhs, rhs);
+                });
+        }
+        return elements;
+    }
+    /**
+     * @brief 追加容器（含有迭代器分支,但非字符串类型）
+     * @tparam Out 输出类型
+     * @tparam T 容器类型
+     * @param out 输出缓冲
+     * @param value 容器对象
+     * @param config 配置
+     */
+    template<class Out, class T, std::enable_if_t<
+        has_iterator<T>::value &&
+        !is_basic_string<T>::value, int> = 0>
+    void append_has_iterator(Out& out, const T& value, const StringifyConfig& config)
+    {
+        if constexpr (is_unordered_container<T>::value && !has_exhausted<Out>::value)
+        {
+            if (config.is_sort_unordered_container && value.size() > 1)
+            {
+                const auto elements = get_sorted_elements(value, config);
+                append_sequence(out, DereferenceIterator(elements.begin()), DereferenceIterator(elements.end()),
+                    config.container_symbol, config);
+                return;
+            }
+        }
+        append_sequence(out, std::begin(value), std::end(value), config.container_symbol, config);
+    }
+    /**
+     * @brief 追加输入范围
+     * @tparam Out 输出类型
+     * @tparam Range 范围类型，可为const
+     * @param out 输出缓冲
+     * @param range 范围，单程范围只遍历一次
+     * @param config 配置
+     * @note 可取得元素数量时，按受元素数量限制后的个数预留输出空间
+     */
+    template<class Out, class Range>
+    void append_input_range(Out& out, Range& range, const StringifyConfig& config)
+    {
+        if constexpr (std::ranges::sized_range<Range> &&
+            requires { out.reserve(std::size_t()); out.size(); out.capacity(); })
+        {
+            auto count = static_cast<std::size_t>(std::ranges::size(range));
+            if (config.max_stringify_element_count >= 0 &&
+                count > static_cast<std::size_t>(config.max_stringify_element_count))
+            {
+                count = static_cast<std::size_t>(config.max_stringify_element_count);
+            }
+            const DelimiterSymbol& symbol = config.container_symbol;
+            // 每个元素至少占一个字符
+            const std::size_t required = out.size() + symbol.start_maker.size() + symbol.end_maker.size() +
+                count * (symbol.element_separator.size() + symbol.space_maker.size() + 1);
+            if (required > out.capacity())
+            {
+                // 嵌套范围逐个预留时保持倍增，避免反复按需扩容
+                out.reserve(required > out.capacity() * 2 ? required : out.capacity() * 2);
+            }
+        }
+        append_sequence(out, std::ranges::begin(range), std::ranges::end(range), config.container_symbol, config);
+    }
+    /**
+     * @brief 追加没有iterator成员类型的范围，如std::views中的视图
+     * @tparam Out 输出类型
+     * @tparam T 范围类型
+     * @param out 输出缓冲
+     * @param value 范围
+     * @param config 配置
+     * @note 只能非const遍历的视图复制视图本身后遍历，不复制元素
+     */
+    template<class Out, class T, std::enable_if_t<
+        is_input_range<T>::value, int> = 0>
+    void append_range_view(Out& out, const T& value, const StringifyConfig& config)
+    {
+        if constexpr (std::ranges::input_range<const T>)
+        {
+            append_input_range(out, value, config);
+        }
+        else
+        {
+            T view(value);
+            append_input_range(out, view, config);
+        }
+    }
+    /**
+     * @brief 只能非const遍历的范围的追加重载，如std::generator
+     * @tparam Out 输出类型
+     * @tparam Range 范围类型
+     * @param out 输出缓冲
+     * @param range 范围，单程范围遍历后即耗尽
+     * @param config 配置
+     */
+    template<class Out, class Range, std::enable_if_t<
+        is_mutable_input_range<std::remove_reference_t<Range>>::value, int> = 0>
+    void append_to_string(Out& out, Range&& range, const StringifyConfig& config)
+    {
+        DANEJOE_STRINGIFY_STATS_SCOPE(StringifyBranch::InputRange, out);
+        append_input_range(out, range, config);
+    }
+    /**
+     * @brief 追加C数组
+     * @tparam Out 输出类型
+     * @tparam T 元素类型
+     * @param out 输出缓冲
+     * @param ptr 指针
+     * @param count 元素数量
+     * @param config 配置
+     */
+    template<class Out, class T>
+    void append_c_ptr(Out& out, const T* ptr, std::size_t count, const StringifyConfig& config)
+    {
+        if (ptr == nullptr)
+        {
+            count = 0;
+        }
+        append_sequence(out, ptr, ptr + count, config.container_symbol, config);
+    }
+    /**
+     * @brief 追加std::pair
+     * @tparam Out 输出类型
+     * @tparam T 键值对类型
+     * @param out 输出缓冲
+     * @param pair 键值对
+     * @param config 配置
+     */
+    template<class Out, class T, std::enable_if_t<
+        is_std_pair<T>::value, int> = 0>
+    void append_std_pair(Out& out, const T& pair, const StringifyConfig& config)
+    {
+        append_text(out, config.pair_symbol.start_maker);
+        append_to_string(out, pair.first, config);
+        append_text(out, config.pair_symbol.element_separator);
+        append_text(out, config.pair_symbol.space_maker);
+        append_to_string(out, pair.second, config);
+        append_text(out, config.pair_symbol.end_maker);
+    }
+    /**
+     * @brief 追加std::optional
+     * @tparam Out 输出类型
+     * @tparam T 类型
+     * @param out 输出缓冲
+     * @param value 对象
+     * @param config 配置
+     */
+    template<class Out, class T, std::enable_if_t<
+        is_std_optional<T>::value, int> = 0>
+    void append_std_optional(Out& out, const T& value, const StringifyConfig& config)
+    {
+        if (value.has_value())
+        {
+            append_to_string(out, *value, config);
+        }
+        else
+        {
+            append_text(out, config.null_value_symbol);
+        }
+    }
+    /**
+     * @brief 追加std::variant
+     * @tparam Out 输出类型
+     * @tparam T 类型
+     * @param out 输出缓冲
+     * @param value 对象
+     * @param config 配置
+     */
+    template<class Out, class T, std::enable_if_t<
+        is_std_variant<T>::value, int> = 0>
+    void append_std_variant(Out& out, const T& value, const StringifyConfig& config)
+    {
+        if (value.valueless_by_exception())
+        {
+            append_text(out, config.variant_valueless_placeholder);
+        }
+        else
+        {
+            std::visit([&](const auto& arg)
+                {
+                    append_to_string(out, arg, config);
+                }, value);
+        }
+    }
+    /**
+     * @brief 追加std::tuple
+     * @tparam Out 输出类型
+     * @tparam T 类型
+     * @param out 输出缓冲
+     * @param value 对象
+     * @param config 配置
+     */
+    template<class Out, class T, std::enable_if_t<
+        is_std_tuple<T>::value, int> = 0>
+    void append_std_tuple(Out& out, const T& value, const StringifyConfig& config)
+    {
+        append_text(out, config.tuple_symbol.start_maker);
+        std::apply([&](const auto&... args)
+            {
+                bool is_first = true;
+                auto append_element = [&](const auto& arg)
+                    {
+                        if (!is_first)
+                        {
+                            append_text(out, config.tuple_symbol.element_separator);
+                            append_text(out, config.tuple_symbol.space_maker);
+                        }
+                        is_first = false;
+                        append_to_string(out, arg, config);
+                    };
+                (append_element(args), ...);
+            }, value);
+        append_text(out, config.tuple_symbol.end_maker);
+    }
+    /**
+     * @brief 追加支持流输出的类型
+     * @tparam Out 输出类型
+     * @tparam T 类型
+     * @param out 输出缓冲
+     * @param value 对象
+     * @note 用户类型的operator<<只能写入流，经AppendStreamBuffer直接写入输出缓冲
+     */
+    template<class Out, class T, std::enable_if_t<
+        has_stream_out<T>::value, int> = 0>
+    void append_stream_out(Out& out, const T& value)
+    {
+        AppendStreamBuffer<Out> buffer(out);
+        std::ostream stream(&buffer);
+        stream << value;
+    }
+    /**
+     * @brief 存储单位的追加重载，与DaneJoe::to_string(StorageUnit)输出一致
+     * @tparam Out 输出类型
+     * @param out 输出缓冲
+     * @param unit 存储单位
+     * @note 输出不受配置影响，配置参数仅为与通用分发的签名一致
+     */
+    template<class Out>
+    void append_to_string(Out& out, StorageUnit unit, const StringifyConfig&)
+    {
+        append_text(out, get_storage_unit_name(unit));
+    }
+    /**
+     * @brief 通用追加接口的分发实现
+     * @tparam Out 输出类型
+     * @tparam T 类型
+     * @param out 输出缓冲
+     * @param value 对象
+     * @param config 配置
+     * @note 分支顺序与to_string保持一致
+     */
+    template<class Out, class T>
+    void append_to_string(Out& out, const T& value, const StringifyConfig& config)
+    {
+        if constexpr (has_stringify_append<T, Out>::value)
+        {
+            // 用户显式提供的自定义点优先于所有内置分支
+            DANEJOE_STRINGIFY_STATS_SCOPE(StringifyBranch::CustomAppend, out);
+            StringifyWriter<Out> writer(out, config);
+            stringify_append(writer, value);
+        }
+        else if constexpr (is_unicode_string<T>::value)
+        {
+            // 须先于is_std_string_view判断：后者可能匹配任意字符类型的视图
+            DANEJOE_STRINGIFY_STATS_SCOPE(StringifyBranch::UnicodeString, out);
+            append_utf8(out, value.data(), value.size());
+        }
+        else if constexpr (is_std_string_view<T>::value)
+        {
+            DANEJOE_STRINGIFY_STATS_SCOPE(StringifyBranch::StdStringView, out);
+            append_text(out, std::string_view(value.data(), value.size()));
+        }
+        else if constexpr (is_basic_string<T>::value)
+        {
+            DANEJOE_STRINGIFY_STATS_SCOPE(StringifyBranch::StdString, out);
+            out.append(value.data(), value.size());
+        }
+        else if constexpr (is_c_string<T>::value)
+        {
+            DANEJOE_STRINGIFY_STATS_SCOPE(StringifyBranch::CString, out);
+            append_c_string(out, value, config);
+        }
+        else if constexpr (is_unicode_c_string<T>::value)
+        {
+            DANEJOE_STRINGIFY_STATS_SCOPE(StringifyBranch::UnicodeString, out);
+            // 数组与指针统一退化为指向const字符的指针
+            const std::remove_cv_t<std::remove_pointer_t<std::decay_t<T>>>* text = value;
+            append_unicode_c_string(out, text, config);
+        }
+        else if constexpr (std::is_enum_v<T>)
+        {
+            DANEJOE_STRINGIFY_STATS_SCOPE(StringifyBranch::Enum, out);
+            append_enum(out, value, config);
+        }
+        else if constexpr (std::is_same_v<T, char> || std::is_same_v<T, unsigned char>)
+        {
+            DANEJOE_STRINGIFY_STATS_SCOPE(StringifyBranch::Char, out);
+            out.push_back(static_cast<char>(value));
+        }
+        else if constexpr (is_unicode_char<T>::value)
+        {
+            DANEJOE_STRINGIFY_STATS_SCOPE(StringifyBranch::UnicodeChar, out);
+            append_unicode_char(out, value);
+        }
+        else if constexpr (std::is_same_v<T, bool>)
+        {
+            DANEJOE_STRINGIFY_STATS_SCOPE(StringifyBranch::Bool, out);
+            append_bool(out, value, config);
+        }
+        else if constexpr (is_bit_sequence<T>::value)
+        {
+            // 先于成员to_string与容器分支，避免std::bitset经to_string分配、std::vector<bool>逐位分发
+            DANEJOE_STRINGIFY_STATS_SCOPE(StringifyBranch::BitSequence, out);
+            append_bit_sequence(out, value, config);
+        }
+        else if constexpr (has_member_to_string<T>::value)
+        {
+            // 成员to_string返回的字符串由用户类型决定，不经过输出的分配器
+            DANEJOE_STRINGIFY_STATS_SCOPE(StringifyBranch::MemberToString, out);
+            append_text(out, value.to_string());
+        }
+        else if constexpr (has_std_to_string<T>::value || is_int128<T>::value)
+        {
+            DANEJOE_STRINGIFY_STATS_SCOPE(StringifyBranch::StdToString, out);
+            append_std_to_string(out, value, config);
+        }
+        else if constexpr (is_chrono_duration<T>::value)
+        {
+            DANEJOE_STRINGIFY_STATS_SCOPE(StringifyBranch::TimeDuration, out);
+            append_time_duration(out, value, config);
+        }
+        else if constexpr (is_chrono_time_point<T>::value)
+        {
+            DANEJOE_STRINGIFY_STATS_SCOPE(StringifyBranch::TimePoint, out);
+            append_time_point(out, value);
+        }
+        else if constexpr (is_std_pair<T>::value)
+        {
+            DANEJOE_STRINGIFY_STATS_SCOPE(StringifyBranch::StdPair, out);
+            append_std_pair(out, value, config);
+        }
+        else if constexpr (is_std_optional<T>::value)
+        {
+            DANEJOE_STRINGIFY_STATS_SCOPE(StringifyBranch::StdOptional, out);
+            append_std_optional(out, value, config);
+        }
+        else if constexpr (is_std_variant<T>::value)
+        {
+            DANEJOE_STRINGIFY_STATS_SCOPE(StringifyBranch::StdVariant, out);
+            append_std_variant(out, value, config);
+        }
+        else if constexpr (is_std_tuple<T>::value)
+        {
+            DANEJOE_STRINGIFY_STATS_SCOPE(StringifyBranch::StdTuple, out);
+            append_std_tuple(out, value, config);
+        }
+        else if constexpr (std::is_same_v<T, std::any>)
+        {
+            DANEJOE_STRINGIFY_STATS_SCOPE(StringifyBranch::StdAny, out);
+            append_std_any(out, value, config);
+        }
+        else if constexpr (has_iterator<T>::value)
+        {
+            DANEJOE_STRINGIFY_STATS_SCOPE(StringifyBranch::HasIterator, out);
+            append_has_iterator(out, value, config);
+        }
+        else if constexpr (is_c_array<T>::value)
+        {
+            DANEJOE_STRINGIFY_STATS_SCOPE(StringifyBranch::CArray, out);
+            append_c_ptr(out, value, std::extent_v<T>, config);
+        }
+        else if constexpr (is_input_range<T>::value)
+        {
+            DANEJOE_STRINGIFY_STATS_SCOPE(StringifyBranch::InputRange, out);
+            append_range_view(out, value, config);
+        }
+        else if constexpr (has_stream_out<T>::value)
+        {
+            DANEJOE_STRINGIFY_STATS_SCOPE(StringifyBranch::StreamOut, out);
+            append_stream_out(out, value);
+        }
+        else
+        {
+            DANEJOE_STRINGIFY_STATS_SCOPE(StringifyBranch::Fallback, out);
+            // 仅编译期无法分发的类型查找运行时注册表
+            if (!append_registered(out, &value, typeid(T), config))
+            {
+                append_text(out, config.unsupported_type_place_holder);
+            }
+        }
+    }
+}
@@ -0,0 +1,402 @@
+/**
+ * @file stringify_bits.hpp
+ * @brief 位序列的紧凑输出
+ * @author DaneJoe001
+ * @version 0.2.0
+ * @date 2026-10-18
+ * @details std::vector<bool>、std::bitset与BitSpan按字节读取位，由查找表一次展开为
+ *          8个二进制数字或2个十六进制数字，写入栈缓冲后整块追加，不经逐元素分发。
+ *          BitSpan直接按字读取；标准容器只能逐位访问，先将8位拼成一个字节再查表。
+ */
+#pragma once
+
+#include <string>
+#include <bitset>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "danejoe/stringify/stringify_config.hpp"
+#include "danejoe/stringify/stringify_traits.hpp"
+
+ /**
+  * @namespace DaneJoe
+  * @brief DaneJoe 命名空间
+  */
+namespace DaneJoe
+{
+    /**
+     * @class BitSpan
+     * @brief 按字打包的位序列视图，不持有数据
+     * @tparam Word 字类型，无符号整数
+     * @note 第i位为words[i / 字宽]的第(i % 字宽)低位，与常见位图布局一致
+     */
+    template<class Word = std::uint64_t>
+    class BitSpan
+    {
+        static_assert(std::is_unsigned_v<Word> && sizeof(Word) >= 1, "Word must be an unsigned integer");
+    public:
+        /// @brief 每个字的位数
+        static constexpr std::size_t word_bit_count = sizeof(Word) * 8;
+        /**
+         * @brief 构造函数
+         * @param words 字序列
+         * @param bit_count 位数
+         */
+        BitSpan(const Word* words, std::size_t bit_count) noexcept
+            : m_words(words), m_bit_count(bit_count)
+        {}
+        /**
+         * @brief 获取字序列
+         * @return 首个字
+         */
+        const Word* get_words() const noexcept
+        {
+            return m_words;
+        }
+        /**
+         * @brief 获取位数
+         * @return 位数
+         */
+        std::size_t size() const noexcept
+        {
+            return m_bit_count;
+        }
+        /**
+         * @brief 读取一位
+         * @param index 下标
+         * @return 该位是否为1
+         */
+        bool operator[](std::size_t index) const noexcept
+        {
+            return (m_words[index / word_bit_count] >> (index % word_bit_count)) & 1U;
+        }
+    private:
+        /// @brief 字序列
+        const Word* m_words;
+        /// @brief 位数
+        std::size_t m_bit_count;
+    };
+    /**
+     * @brief 判断类型是否为BitSpan
+     * @tparam T 类型
+     */
+    template<class T>
+    struct is_bit_span : std::false_type {};
+    /**
+     * @brief is_bit_span的匹配分支
+     * @tparam Word 字类型
+     */
+    template<class Word>
+    struct is_bit_span<BitSpan<Word>> : std::true_type {};
+    /**
+     * @brief 判断类型是否为按位输出的序列
+     * @tparam T 类型
+     */
+    template<class T>
+    struct is_bit_sequence : std::bool_constant<
+        is_std_vector_bool<T>::value || is_std_bitset<T>::value || is_bit_span<T>::value> {};
+    /**
+     * @struct BitDigitTable
+     * @brief 字节到数字的查找表
+     * @note 字节的第0位为输出中的第一位
+     */
+    struct BitDigitTable
+    {
+        /// @brief 每个字节的8个二进制数字
+        char binary[256 * 8];
+        /// @brief 每个字节的2个十六进制数字，每个数字的最高位为4位中的第一位
+        char hexadecimal[256 * 2];
+    };
+    /**
+     * @brief 生成字节到数字的查找表
+     * @return 查找表
+     */
+    constexpr BitDigitTable make_bit_digit_table()
+    {
+        constexpr char digits[] = "0123456789abcdef";
+        BitDigitTable table{};
+        for (int byte = 0; byte < 256; ++byte)
+        {
+            for (int bit = 0; bit < 8; ++bit)
+            {
+                table.binary[byte * 8 + bit] = (byte >> bit) & 1 ? '1' : '0';
+            }
+            for (int nibble = 0; nibble < 2; ++nibble)
+            {
+                const int bits = byte >> (nibble * 4);
+                const int value = (bits & 1) << 3 | (bits >> 1 & 1) << 2 | (bits >> 2 & 1) << 1 | (bits >> 3 & 1);
+                table.hexadecimal[byte * 2 + nibble] = digits[value];
+            }
+        }
+        return table;
+    }
+    /// @brief 字节到数字的查找表
+    inline constexpr BitDigitTable bit_digit_table = make_bit_digit_table();
+    /**
+     * @class BitDigitGrouper
+     * @brief 按组插入分隔符地追加数字
+     * @tparam Out 输出类型
+     */
+    template<class Out>
+    class BitDigitGrouper
+    {
+    public:
+        /**
+         * @brief 构造函数
+         * @param out 输出
+         * @param digit_count 将追加的数字总数
+         * @param is_align_right 是否从末尾开始分组
+         * @param config 配置
+         */
+        BitDigitGrouper(Out& out, std::size_t digit_count, bool is_align_right, const StringifyConfig& config) noexcept
+            : m_out(out), m_symbol(config.bit_group_symbol), m_remaining_count(digit_count)
+        {
+            if (!m_symbol.empty() && config.bit_group_size != 0)
+            {
+                m_group_size = config.bit_group_size;
+                const std::size_t head_size = digit_count % m_group_size;
+                m_until_separator = is_align_right && head_size != 0 ? head_size : m_group_size;
+            }
+        }
+        /**
+         * @brief 追加数字
+         * @param data 数字
+         * @param size 数字个数
+         */
+        void append(const char* data, std::size_t size)
+        {
+            if (m_group_size == 0)
+            {
+                m_out.append(data, size);
+                return;
+            }
+            while (size != 0)
+            {
+                const std::size_t take = size < m_until_separator ? size : m_until_separator;
+                m_out.append(data, take);
+                data += take;
+                size -= take;
+                m_remaining_count -= take;
+                m_until_separator -= take;
+                if (m_until_separator == 0 && m_remaining_count != 0)
+                {
+                    m_out.append(m_symbol.data(), m_symbol.size());
+                    m_until_separator = m_group_size;
+                }
+            }
+        }
+    private:
+        /// @brief 输出
+        Out& m_out;
+        /// @brief 分组符号
+        const std::string& m_symbol;
+        /// @brief 每组数字个数，0表示不分组
+        std::size_t m_group_size = 0;
+        /// @brief 下一个分隔符前剩余的数字个数
+        std::size_t m_until_separator = 0;
+        /// @brief 尚未追加的数字个数
+        std::size_t m_remaining_count;
+    };
+    /**
+     * @brief 按字节读取位并以二进制或十六进制追加
+     * @tparam Out 输出类型
+     * @tparam ReadByte 读取函数，read_byte(position, count)返回从position起count位组成的字节，第0位为第一位
+     * @param out 输出
+     * @param read_byte 读取函数
+     * @param bit_count 位数
+     * @param is_align_right 是否从末尾开始分组
+     * @param config 配置
+     * @note max_stringify_element_count限制的是数字个数
+     */
+    template<class Out, class ReadByte>
+    void append_bit_digits(Out& out, ReadByte read_byte, std::size_t bit_count,
+        bool is_align_right, const StringifyConfig& config)
+    {
+        const bool is_hexadecimal = config.bit_format == BitFormat::Hexadecimal;
+        const std::size_t bits_per_digit = is_hexadecimal ? 4 : 1;
+        std::size_t digit_count = (bit_count + bits_per_digit - 1) / bits_per_digit;
+        bool is_truncated = false;
+        if (config.max_stringify_element_count >= 0 &&
+            digit_count > static_cast<std::size_t>(config.max_stringify_element_count))
+        {
+            digit_count = static_cast<std::size_t>(config.max_stringify_element_count);
+            is_truncated = true;
+        }
+        const std::size_t read_count = digit_count * bits_per_digit < bit_count ?
+            digit_count * bits_per_digit : bit_count;
+        if constexpr (requires { out.reserve(std::size_t()); out.size(); })
+        {
+            // 输出长度可预先算出，一次预留
+            std::size_t required = out.size() + digit_count + config.ellipsis_symbol.size();
+            if (config.bit_group_size != 0 && digit_count != 0)
+            {
+                required += (digit_count - 1) / config.bit_group_size * config.bit_group_symbol.size();
+            }
+            out.reserve(required);
+        }
+        BitDigitGrouper<Out> grouper(out, digit_count, is_align_right, config);
+        constexpr std::size_t chunk_bit_count = 512;
+        char chunk[chunk_bit_count];
+        for (std::size_t position = 0; position < read_count; position += chunk_bit_count)
+        {
+            if constexpr (has_exhausted<Out>::value)
+            {
+                // 定长输出已写满时不再读取剩余的位
+                if (out.exhausted())
+                {
+                    break;
+                }
+            }
+            const std::size_t chunk_end = position + chunk_bit_count < read_count ?
+                position + chunk_bit_count : read_count;
+            char* current = chunk;
+            for (std::size_t byte_position = position; byte_position < chunk_end; byte_position += 8)
+            {
+                const std::size_t count = chunk_end - byte_position < 8 ? chunk_end - byte_position : 8;
+                const unsigned byte = read_byte(byte_position, count);
+                if (is_hexadecimal)
+                {
+                    const char* digits = bit_digit_table.hexadecimal + byte * 2;
+                    *current++ = digits[0];
+                    if (count > 4)
+                    {
+                        *current++ = digits[1];
+                    }
+                }
+                else
+                {
+                    std::memcpy(current, bit_digit_table.binary + byte * 8, count);
+                    current += count;
+                }
+            }
+            grouper.append(chunk, static_cast<std::size_t>(current - chunk));
+        }
+        if (is_truncated)
+        {
+            out.append(config.ellipsis_symbol.data(), config.ellipsis_symbol.size());
+        }
+    }
+    /**
+     * @brief 按元素追加位序列，如[true, false]
+     * @tparam Out 输出类型
+     * @tparam Test 读取函数，test(index)返回该位是否为1
+     * @param out 输出
+     * @param test 读取函数
+     * @param bit_count 位数
+     * @param config 配置
+     */
+    template<class Out, class Test>
+    void append_bit_elements(Out& out, Test test, std::size_t bit_count, const StringifyConfig& config)
+    {
+        const DelimiterSymbol& symbol = config.container_symbol;
+        const std::string& true_symbol = config.bool_symbol.true_symbol;
+        const std::string& false_symbol = config.bool_symbol.false_symbol;
+        if constexpr (requires { out.reserve(std::size_t()); out.size(); })
+        {
+            std::size_t count = bit_count;
+            if (config.max_stringify_element_count >= 0 &&
+                count > static_cast<std::size_t>(config.max_stringify_element_count))
+            {
+                count = static_cast<std::size_t>(config.max_stringify_element_count);
+            }
+            // 按较短的符号预留
+            const std::size_t element_size = symbol.element_separator.size() + symbol.space_maker.size() +
+                (true_symbol.size() < false_symbol.size() ? true_symbol.size() : false_symbol.size());
+            out.reserve(out.size() + symbol.start_maker.size() + symbol.end_maker.size() + count * element_size);
+        }
+        out.append(symbol.start_maker.data(), symbol.start_maker.size());
+        for (std::size_t i = 0; i < bit_count; ++i)
+        {
+            if constexpr (has_exhausted<Out>::value)
+            {
+                if (out.exhausted())
+                {
+                    break;
+                }
+            }
+            if (i != 0)
+            {
+                out.append(symbol.element_separator.data(), symbol.element_separator.size());
+                out.append(symbol.space_maker.data(), symbol.space_maker.size());
+            }
+            if (config.max_stringify_element_count >= 0 &&
+                i >= static_cast<std::size_t>(config.max_stringify_element_count))
+            {
+                out.append(config.ellipsis_symbol.data(), config.ellipsis_symbol.size());
+                break;
+            }
+            const std::string& text = test(i) ? true_symbol : false_symbol;
+            out.append(text.data(), text.size());
+        }
+        out.append(symbol.end_maker.data(), symbol.end_maker.size());
+    }
+    /**
+     * @brief 追加位序列
+     * @tparam Out 输出类型
+     * @tparam T 类型，须满足is_bit_sequence
+     * @param out 输出
+     * @param value 位序列
+     * @param config 配置
+     */
+    template<class Out, class T>
+    void append_bit_sequence(Out& out, const T& value, const StringifyConfig& config)
+    {
+        if constexpr (is_std_bitset<T>::value)
+        {
+            // 与operator<<一致从高位输出；十六进制在前面补0至4位的整数倍，与整数的十六进制输出一致
+            constexpr std::size_t bit_count = T().size();
+            const std::size_t padding = config.bit_format == BitFormat::Hexadecimal ? (4 - bit_count % 4) % 4 : 0;
+            auto read_byte = [&value, padding](std::size_t position, std::size_t count)
+                {
+                    unsigned byte = 0;
+                    for (std::size_t i = 0; i < count; ++i)
+                    {
+                        const std::size_t output_position = position + i;
+                        if (output_position >= padding && value[bit_count - 1 - (output_position - padding)])
+                        {
+                            byte |= 1U << i;
+                        }
+                    }
+                    return byte;
+                };
+            append_bit_digits(out, read_byte, bit_count + padding, true, config);
+        }
+        else if (config.bit_format == BitFormat::Element)
+        {
+            append_bit_elements(out, [&value](std::size_t index) { return static_cast<bool>(value[index]); },
+                value.size(), config);
+        }
+        else if constexpr (is_bit_span<T>::value)
+        {
+            using Word = std::remove_cv_t<std::remove_pointer_t<decltype(value.get_words())>>;
+            constexpr std::size_t word_bit_count = sizeof(Word) * 8;
+            const Word* words = value.get_words();
+            auto read_byte = [words](std::size_t position, std::size_t count)
+                {
+                    // position为8的倍数，字节不跨字
+                    const unsigned byte = static_cast<unsigned>(
+                        (words[position / word_bit_count] >> (position % word_bit_count)) & 0xFFU);
+                    return count == 8 ? byte : byte & ((1U << count) - 1);
+                };
+            append_bit_digits(out, read_byte, value.size(), false, config);
+        }
+        else
+        {
+            // 按字节顺序读取，沿用迭代器避免每位重新计算所在的字
+            auto current = value.begin();
+            auto read_byte = [&current](std::size_t, std::size_t count)
+                {
+                    unsigned byte = 0;
+                    for (std::size_t i = 0; i < count; ++i, ++current)
+                    {
+                        byte |= static_cast<unsigned>(static_cast<bool>(*current)) << i;
+                    }
+                    return byte;
+                };
+            append_bit_digits(out, read_byte, value.size(), false, config);
+        }
+    }
+}
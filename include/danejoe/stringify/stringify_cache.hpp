@@ -0,0 +1,187 @@
+/**
+ * @file stringify_cache.hpp
+ * @brief 字符串化结果缓存
+ * @author DaneJoe001
+ * @version 0.2.0
+ * @date 2026-10-18
+ * @details 以对象地址、类型与调用方提供的版本号为键缓存to_string结果，
+ *          版本不变时直接返回共享的只读字符串；set_config后全部失效。
+ */
+#pragma once
+
+#include <list>
+#include <mutex>
+#include <memory>
+#include <string>
+#include <cstddef>
+#include <cstdint>
+#include <typeindex>
+#include <unordered_map>
+
+#include "danejoe/stringify/stringify_config.hpp"
+#include "danejoe/stringify/stringify_to_string.hpp"
+
+ /**
+  * @namespace DaneJoe
+  * @brief DaneJoe 命名空间
+  */
+namespace DaneJoe
+{
+    /**
+     * @struct StringifyCacheStats
+     * @brief 缓存统计
+     */
+    struct StringifyCacheStats
+    {
+        /// @brief 命中次数
+        uint64_t hit_count = 0;
+        /// @brief 未命中次数
+        uint64_t miss_count = 0;
+        /// @brief 因内存预算淘汰的条目数
+        uint64_t eviction_count = 0;
+        /// @brief 当前条目数
+        std::size_t entry_count = 0;
+        /// @brief 当前占用字节数（估算）
+        std::size_t memory_usage = 0;
+        /// @brief 内存预算字节数
+        std::size_t memory_budget = 0;
+    };
+    /**
+     * @class StringifyCache
+     * @brief 带LRU内存预算的字符串化结果缓存
+     * @note 线程安全；对象销毁或地址复用前应调用invalidate，或更换版本号
+     */
+    class StringifyCache
+    {
+    public:
+        /**
+         * @brief 构造函数
+         * @param memory_budget 内存预算字节数
+         */
+        explicit StringifyCache(std::size_t memory_budget = 4 * 1024 * 1024);
+        /**
+         * @brief 获取对象的字符串化结果
+         * @tparam T 类型
+         * @param value 对象
+         * @param version 对象版本，内容变化时调用方须递增
+         * @return 共享的只读字符串
+         * @note 超出内存预算的单个结果不会被缓存
+         */
+        template<class T>
+        std::shared_ptr<const std::string> get(const T& value, uint64_t version)
+        {
+            const EntryKey key{ static_cast<const void*>(std::addressof(value)), std::type_index(typeid(T)) };
+            const uint64_t config_version = StringifyConfigManager::get_config_version();
+            std::shared_ptr<const std::string> text = find(key, version, config_version);
+            if (text != nullptr)
+            {
+                return text;
+            }
+            // 在锁外渲染，避免阻塞其他线程的查询
+            text = std::make_shared<const std::string>(DaneJoe::to_string(value));
+            insert(key, version, config_version, text);
+            return text;
+        }
+        /**
+         * @brief 移除对象的缓存
+         * @tparam T 类型
+         * @param value 对象
+         */
+        template<class T>
+        void invalidate(const T& value)
+        {
+            erase(EntryKey{ static_cast<const void*>(std::addressof(value)), std::type_index(typeid(T)) });
+        }
+        /**
+         * @brief 清空缓存
+         */
+        void clear();
+        /**
+         * @brief 获取统计
+         * @return 缓存统计
+         */
+        StringifyCacheStats get_stats() const;
+    private:
+        /**
+         * @struct EntryKey
+         * @brief 对象标识
+         */
+        struct EntryKey
+        {
+            /// @brief 对象地址
+            const void* address = nullptr;
+            /// @brief 对象类型
+            std::type_index type = std::type_index(typeid(void));
+            bool operator==(const EntryKey& other) const
+            {
+                return address == other.address && type == other.type;
+            }
+        };
+        /**
+         * @struct EntryKeyHash
+         * @brief 对象标识哈希
+         */
+        struct EntryKeyHash
+        {
+            std::size_t operator()(const EntryKey& key) const noexcept;
+        };
+        /**
+         * @struct Entry
+         * @brief 缓存条目
+         */
+        struct Entry
+        {
+            /// @brief 对象标识
+            EntryKey key;
+            /// @brief 对象版本
+            uint64_t version = 0;
+            /// @brief 字符串化结果
+            std::shared_ptr<const std::string> text;
+            /// @brief 占用字节数（估算）
+            std::size_t cost = 0;
+        };
+        /**
+         * @brief 查找条目
+         * @param key 对象标识
+         * @param version 对象版本
+         * @param config_version 配置版本
+         * @return 命中时为缓存结果，否则为nullptr
+         */
+        std::shared_ptr<const std::string> find(const EntryKey& key, uint64_t version, uint64_t config_version);
+        /**
+         * @brief 插入条目
+         * @param key 对象标识
+         * @param version 对象版本
+         * @param config_version 渲染时的配置版本
+         * @param text 字符串化结果
+         */
+        void insert(const EntryKey& key, uint64_t version, uint64_t config_version,
+            std::shared_ptr<const std::string> text);
+        /**
+         * @brief 移除条目
+         * @param key 对象标识
+         */
+        void erase(const EntryKey& key);
+        /**
+         * @brief 配置版本变化时清空（须持有锁）
+         * @param config_version 配置版本
+         */
+        void sync_config_version(uint64_t config_version);
+        /**
+         * @brief 移除条目（须持有锁）
+         * @param iter 条目位置
+         */
+        void erase_entry(std::list<Entry>::iterator iter);
+    private:
+        /// @brief 互斥锁
+        mutable std::mutex m_mutex;
+        /// @brief 条目，表头为最近使用
+        std::list<Entry> m_entries;
+        /// @brief 条目索引
+        std::unordered_map<EntryKey, std::list<Entry>::iterator, EntryKeyHash> m_index;
+        /// @brief 条目对应的配置版本
+        uint64_t m_config_version = 0;
+        /// @brief 统计
+        StringifyCacheStats m_stats;
+    };
+}
@@ -0,0 +1,557 @@
+/**
+ * @file stringify_capture.hpp
+ * @brief 延迟渲染的二进制捕获
+ * @author DaneJoe001
+ * @version 0.2.0
+ * @date 2026-10-18
+ * @details 热路径仅按to_string的分支顺序将参数编码为紧凑的带类型标记的二进制记录，
+ *          并memcpy进当前线程的无锁单生产者单消费者环形缓冲；
+ *          渲染由后台线程或离线解码工具按to_string语义完成。
+ * @note 记录使用本机字节序，离线解码须在相同平台进行；时间点按解码时所在时区渲染
+ */
+#pragma once
+
+#include <any>
+#include <mutex>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <variant>
+#include <iterator>
+#include <typeinfo>
+#include <functional>
+#include <string_view>
+#include <type_traits>
+#include <condition_variable>
+
+#include "danejoe/common/type_traits/std_type_traits.hpp"
+#include "danejoe/common/type_traits/container_traits.hpp"
+#include "danejoe/stringify/stringify_config.hpp"
+#include "danejoe/stringify/stringify_traits.hpp"
+#include "danejoe/stringify/stringify_format.hpp"
+#include "danejoe/stringify/stringify_to_string.hpp"
+
+ /**
+  * @namespace DaneJoe
+  * @brief DaneJoe 命名空间
+  */
+namespace DaneJoe
+{
+    /**
+     * @enum CaptureTag
+     * @brief 捕获记录中值的类型标记
+     */
+    enum class CaptureTag : uint8_t
+    {
+        /// @brief 文本，uint32长度加字节
+        Text,
+        /// @brief 空值，渲染为null_value_symbol
+        Null,
+        /// @brief 枚举，是否有符号、64位底层值、uint16类型名长度加类型名
+        Enum,
+        /// @brief 字符
+        Char,
+        /// @brief 布尔
+        Bool,
+        /// @brief 有符号整数
+        Int8,
+        Int16,
+        Int32,
+        Int64,
+        /// @brief 无符号整数
+        UInt16,
+        UInt32,
+        UInt64,
+        /// @brief 128位整数
+        Int128,
+        UInt128,
+        /// @brief 浮点数
+        Float,
+        Double,
+        LongDouble,
+        /// @brief 时长，单位加计数值
+        Duration,
+        /// @brief 时间点，std::time_t
+        TimePoint,
+        /// @brief 键值对，后随两个值
+        Pair,
+        /// @brief 元组，uint32元素数量加元素
+        Tuple,
+        /// @brief 容器，uint32元素数量加元素
+        Sequence,
+        /// @brief 因异常而无值的std::variant
+        Valueless,
+        /// @brief 不支持的类型
+        Unsupported
+    };
+    /**
+     * @enum CaptureDurationUnit
+     * @brief 时长单位
+     */
+    enum class CaptureDurationUnit : uint8_t
+    {
+        /// @brief 无单位符号
+        None,
+        Second,
+        Millisecond,
+        Microsecond,
+        Nanosecond
+    };
+    /**
+     * @brief 向记录写入原始字节
+     * @tparam T 可平凡复制的类型
+     * @param buffer 记录缓冲
+     * @param value 值
+     */
+    template<class T>
+    void write_capture_raw(std::string& buffer, const T& value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "capture raw value must be trivially copyable");
+        buffer.append(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+    /**
+     * @brief 向记录写入类型标记
+     * @param buffer 记录缓冲
+     * @param tag 类型标记
+     */
+    inline void write_capture_tag(std::string& buffer, CaptureTag tag)
+    {
+        buffer.push_back(static_cast<char>(tag));
+    }
+    /**
+     * @brief 向记录写入文本
+     * @param buffer 记录缓冲
+     * @param text 文本
+     */
+    inline void write_capture_text(std::string& buffer, std::string_view text)
+    {
+        write_capture_tag(buffer, CaptureTag::Text);
+        write_capture_raw(buffer, static_cast<uint32_t>(text.size()));
+        buffer.append(text.data(), text.size());
+    }
+    /**
+     * @brief 将值编码进捕获记录
+     * @tparam T 类型
+     * @param buffer 记录缓冲
+     * @param value 值
+     * @note 分支顺序与append_to_string保持一致；自定义追加函数、位序列、成员to_string与流输出类型无法延迟，
+     *       在捕获时即渲染为文本
+     */
+    template<class T>
+    void encode_capture_value(std::string& buffer, const T& value)
+    {
+        if constexpr (has_stringify_append<T>::value || is_bit_sequence<T>::value)
+        {
+            write_capture_text(buffer, DaneJoe::to_string(value));
+        }
+        else if constexpr (is_unicode_string<T>::value || is_unicode_c_string<T>::value || is_unicode_char<T>::value)
+        {
+            // 转码后的UTF-8与渲染结果相同，在捕获时完成
+            write_capture_text(buffer, DaneJoe::to_string(value));
+        }
+        else if constexpr (is_std_string_view<T>::value || is_basic_string<T>::value)
+        {
+            write_capture_text(buffer, std::string_view(value.data(), value.size()));
+        }
+        else if constexpr (is_c_string<T>::value)
+        {
+            if constexpr (std::is_array_v<T>)
+            {
+                write_capture_text(buffer, std::string_view(value));
+            }
+            else if (value == nullptr)
+            {
+                write_capture_tag(buffer, CaptureTag::Null);
+            }
+            else
+            {
+                write_capture_text(buffer, std::string_view(value));
+            }
+        }
+        else if constexpr (std::is_same_v<T, StorageUnit> || std::is_same_v<T, FormatPosition>)
+        {
+            // 这两个枚举有专门的追加重载，输出与通用枚举格式不同
+            write_capture_text(buffer, to_string(value));
+        }
+        else if constexpr (std::is_enum_v<T>)
+        {
+            using U = std::underlying_type_t<T>;
+            const std::string_view name = typeid(value).name();
+            write_capture_tag(buffer, CaptureTag::Enum);
+            write_capture_raw(buffer, static_cast<uint8_t>(std::is_signed_v<U>));
+            if constexpr (std::is_signed_v<U>)
+            {
+                write_capture_raw(buffer, static_cast<int64_t>(value));
+            }
+            else
+            {
+                write_capture_raw(buffer, static_cast<uint64_t>(value));
+            }
+            write_capture_raw(buffer, static_cast<uint16_t>(name.size()));
+            buffer.append(name.data(), name.size());
+        }
+        else if constexpr (std::is_same_v<T, char> || std::is_same_v<T, unsigned char>)
+        {
+            write_capture_tag(buffer, CaptureTag::Char);
+            write_capture_raw(buffer, static_cast<char>(value));
+        }
+        else if constexpr (std::is_same_v<T, bool>)
+        {
+            write_capture_tag(buffer, CaptureTag::Bool);
+            write_capture_raw(buffer, static_cast<uint8_t>(value));
+        }
+        else if constexpr (has_member_to_string<T>::value)
+        {
+            write_capture_text(buffer, value.to_string());
+        }
+        else if constexpr (is_int128<T>::value)
+        {
+            write_capture_tag(buffer, is_signed_integer_v<T> ? CaptureTag::Int128 : CaptureTag::UInt128);
+            write_capture_raw(buffer, value);
+        }
+        else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>)
+        {
+            // 保留原始宽度，解码时按相同宽度的类型渲染
+            if constexpr (sizeof(T) == 1)
+            {
+                write_capture_tag(buffer, CaptureTag::Int8);
+                write_capture_raw(buffer, static_cast<int8_t>(value));
+            }
+            else if constexpr (sizeof(T) == 2)
+            {
+                write_capture_tag(buffer, CaptureTag::Int16);
+                write_capture_raw(buffer, static_cast<int16_t>(value));
+            }
+            else if constexpr (sizeof(T) == 4)
+            {
+                write_capture_tag(buffer, CaptureTag::Int32);
+                write_capture_raw(buffer, static_cast<int32_t>(value));
+            }
+            else
+            {
+                write_capture_tag(buffer, CaptureTag::Int64);
+                write_capture_raw(buffer, static_cast<int64_t>(value));
+            }
+        }
+        else if constexpr (std::is_integral_v<T>)
+        {
+            if constexpr (sizeof(T) <= 2)
+            {
+                write_capture_tag(buffer, CaptureTag::UInt16);
+                write_capture_raw(buffer, static_cast<uint16_t>(value));
+            }
+            else if constexpr (sizeof(T) == 4)
+            {
+                write_capture_tag(buffer, CaptureTag::UInt32);
+                write_capture_raw(buffer, static_cast<uint32_t>(value));
+            }
+            else
+            {
+                write_capture_tag(buffer, CaptureTag::UInt64);
+                write_capture_raw(buffer, static_cast<uint64_t>(value));
+            }
+        }
+        else if constexpr (std::is_floating_point_v<T>)
+        {
+            if constexpr (std::is_same_v<T, float>)
+            {
+                write_capture_tag(buffer, CaptureTag::Float);
+            }
+            else if constexpr (std::is_same_v<T, double>)
+            {
+                write_capture_tag(buffer, CaptureTag::Double);
+            }
+            else
+            {
+                write_capture_tag(buffer, CaptureTag::LongDouble);
+            }
+            write_capture_raw(buffer, value);
+        }
+        else if constexpr (has_std_to_string<T>::value)
+        {
+            write_capture_text(buffer, DaneJoe::to_string(value));
+        }
+        else if constexpr (is_chrono_duration<T>::value)
+        {
+            CaptureDurationUnit unit = CaptureDurationUnit::None;
+            if constexpr (is_chrono_microseconds<T>::value)
+            {
+                unit = CaptureDurationUnit::Microsecond;
+            }
+            else if constexpr (is_chrono_milliseconds<T>::value)
+            {
+                unit = CaptureDurationUnit::Millisecond;
+            }
+            else if constexpr (is_chrono_nanoseconds<T>::value)
+            {
+                unit = CaptureDurationUnit::Nanosecond;
+            }
+            else if constexpr (is_chrono_seconds<T>::value)
+            {
+                unit = CaptureDurationUnit::Second;
+            }
+            write_capture_tag(buffer, CaptureTag::Duration);
+            write_capture_raw(buffer, unit);
+            encode_capture_value(buffer, value.count());
+        }
+        else if constexpr (is_chrono_time_point<T>::value)
+        {
+            write_capture_tag(buffer, CaptureTag::TimePoint);
+            write_capture_raw(buffer, static_cast<int64_t>(std::chrono::system_clock::to_time_t(value)));
+        }
+        else if constexpr (is_std_pair<T>::value)
+        {
+            write_capture_tag(buffer, CaptureTag::Pair);
+            encode_capture_value(buffer, value.first);
+            encode_capture_value(buffer, value.second);
+        }
+        else if constexpr (is_std_optional<T>::value)
+        {
+            if (value.has_value())
+            {
+                encode_capture_value(buffer, *value);
+            }
+            else
+            {
+                write_capture_tag(buffer, CaptureTag::Null);
+            }
+        }
+        else if constexpr (is_std_variant<T>::value)
+        {
+            if (value.valueless_by_exception())
+            {
+                write_capture_tag(buffer, CaptureTag::Valueless);
+            }
+            else
+            {
+                std::visit([&](const auto& arg)
+                    {
+                        encode_capture_value(buffer, arg);
+                    }, value);
+            }
+        }
+        else if constexpr (is_std_tuple<T>::value)
+        {
+            write_capture_tag(buffer, CaptureTag::Tuple);
+            write_capture_raw(buffer, static_cast<uint32_t>(std::tuple_size_v<T>));
+            std::apply([&](const auto&... args)
+                {
+                    (encode_capture_value(buffer, args), ...);
+                }, value);
+        }
+        else if constexpr (std::is_same_v<T, std::any>)
+        {
+            // 所含对象在解码时已不可访问，捕获时即按注册的格式化器渲染
+            write_capture_text(buffer, DaneJoe::to_string(value));
+        }
+        else if constexpr (has_iterator<T>::value || is_c_array<T>::value || is_input_range<T>::value)
+        {
+            write_capture_tag(buffer, CaptureTag::Sequence);
+            // 元素数量在遍历后回填，单程迭代的容器也只遍历一次
+            const std::size_t count_offset = buffer.size();
+            write_capture_raw(buffer, uint32_t(0));
+            uint32_t count = 0;
+            if constexpr (is_unordered_container<T>::value)
+            {
+                // 排序须在捕获时完成，解码时已无法访问元素
+                const auto config = StringifyConfigManager::get_config_snapshot();
+                if (config->is_sort_unordered_container && value.size() > 1)
+                {
+                    StringifyConfig sort_config = *config;
+                    // 元素数量限制在解码时应用，这里对全部元素排序
+                    sort_config.max_stringify_element_count = -1;
+                    for (const auto* element : get_sorted_elements(value, sort_config))
+                    {
+                        encode_capture_value(buffer, *element);
+                        ++count;
+                    }
+                    std::memcpy(buffer.data() + count_offset, &count, sizeof(count));
+                    return;
+                }
+            }
+            auto encode_elements = [&](auto& range)
+                {
+                    for (const auto& element : range)
+                    {
+                        encode_capture_value(buffer, element);
+                        ++count;
+                    }
+                };
+            if constexpr (!has_iterator<T>::value && !is_c_array<T>::value && !std::ranges::input_range<const T>)
+            {
+                // 视图引用的数据在解码时可能已失效，捕获时遍历视图的副本
+                T view(value);
+                encode_elements(view);
+            }
+            else
+            {
+                encode_elements(value);
+            }
+            std::memcpy(buffer.data() + count_offset, &count, sizeof(count));
+        }
+        else if constexpr (has_stream_out<T>::value)
+        {
+            write_capture_text(buffer, DaneJoe::to_string(value));
+        }
+        else
+        {
+            const auto config = StringifyConfigManager::get_config_snapshot();
+            std::string text;
+            if (append_registered(text, &value, typeid(T), *config))
+            {
+                write_capture_text(buffer, text);
+            }
+            else
+            {
+                write_capture_tag(buffer, CaptureTag::Unsupported);
+            }
+        }
+    }
+    /**
+     * @brief 将一条捕获记录渲染为文本
+     * @param record 记录（不含长度前缀）
+     * @param out 输出，追加写入
+     * @param config 配置
+     * @return 记录格式是否正确
+     * @note 记录内的多个值依次直接拼接
+     */
+    bool decode_capture_record(std::string_view record, std::string& out, const StringifyConfig& config);
+    /**
+     * @brief 逐条解码带长度前缀的记录流
+     * @param data 由drain_binary输出拼接而成的数据
+     * @param callback 每条记录渲染后的回调
+     * @param config 配置
+     * @return 数据格式是否正确
+     */
+    bool decode_capture_frames(std::string_view data,
+        const std::function<void(std::string_view)>& callback,
+        const StringifyConfig& config);
+    /**
+     * @brief 获取当前线程的记录编码缓冲
+     * @return 编码缓冲
+     */
+    std::string& get_capture_scratch();
+    class CaptureRing;
+    /**
+     * @class StringifyCapture
+     * @brief 捕获会话，每个生产线程拥有独立的环形缓冲
+     * @note capture可在任意线程调用；drain系列接口内部串行化，同一时刻只有一个消费者；
+     *       不同线程的记录之间不保证全局顺序
+     */
+    class StringifyCapture
+    {
+    public:
+        /**
+         * @brief 构造函数
+         * @param ring_capacity 每个线程环形缓冲的字节数，向上取整为2的幂
+         */
+        explicit StringifyCapture(std::size_t ring_capacity = 1 << 20);
+        /**
+         * @brief 析构函数，停止后台渲染线程
+         * @note 须保证析构时没有线程仍在capture
+         */
+        ~StringifyCapture();
+        StringifyCapture(const StringifyCapture&) = delete;
+        StringifyCapture& operator=(const StringifyCapture&) = delete;
+        /**
+         * @brief 捕获一条记录
+         * @tparam Args 参数类型
+         * @param args 参数，渲染时按顺序拼接
+         * @return 是否写入，环形缓冲已满时丢弃并返回false
+         */
+        template<class... Args>
+        bool capture(const Args&... args)
+        {
+            std::string& buffer = get_capture_scratch();
+            buffer.clear();
+            (encode_capture_value(buffer, args), ...);
+            return push_record(buffer);
+        }
+        /**
+         * @brief 取出所有已捕获的记录并渲染
+         * @param callback 每条记录渲染后的回调
+         * @return 成功渲染的记录数，解码失败的记录不计入，见get_decode_failure_count
+         */
+        std::size_t drain(const std::function<void(std::string_view)>& callback);
+        /**
+         * @brief 取出所有已捕获的记录，不渲染
+         * @param callback 每条带长度前缀的原始记录的回调，可直接写入文件供离线解码
+         * @return 记录数
+         */
+        std::size_t drain_binary(const std::function<void(std::string_view)>& callback);
+        /**
+         * @brief 启动后台渲染线程
+         * @param callback 每条记录渲染后的回调，在后台线程调用
+         * @param interval 轮询间隔
+         */
+        void start_background(std::function<void(std::string_view)> callback,
+            std::chrono::milliseconds interval = std::chrono::milliseconds(10));
+        /**
+         * @brief 停止后台渲染线程，并渲染剩余记录
+         */
+        void stop_background();
+        /**
+         * @brief 获取因缓冲已满而丢弃的记录数
+         * @return 丢弃数
+         */
+        uint64_t get_dropped_count() const;
+        /**
+         * @brief 获取drain时因解码失败而跳过的记录数
+         * @return 解码失败数
+         */
+        uint64_t get_decode_failure_count() const;
+        /**
+         * @brief 获取当前持有的线程环形缓冲数
+         * @return 环形缓冲数
+         * @note 所属线程退出后，其环形缓冲在下一次drain取空时释放
+         */
+        std::size_t get_thread_ring_count() const;
+    private:
+        /**
+         * @brief 将编码完成的记录写入当前线程的环形缓冲
+         * @param record 记录
+         * @return 是否写入
+         */
+        bool push_record(std::string_view record);
+        /**
+         * @brief 获取当前线程的环形缓冲，首次调用时注册
+         * @return 环形缓冲
+         */
+        CaptureRing& get_thread_ring();
+        /**
+         * @brief 取出所有记录（须持有消费锁），并释放所属线程已退出且已取空的环形缓冲
+         * @param callback 每条记录的回调
+         * @return 记录数
+         */
+        std::size_t pop_all(const std::function<void(const std::string&)>& callback);
+    private:
+        /// @brief 会话标识，线程缓存以此区分会话
+        const uint64_t m_id;
+        /// @brief 每个线程环形缓冲的字节数
+        const std::size_t m_ring_capacity;
+        /// @brief 注册锁
+        mutable std::mutex m_ring_mutex;
+        /// @brief 所有线程的环形缓冲，线程缓存持有其弱引用
+        std::vector<std::shared_ptr<CaptureRing>> m_rings;
+        /// @brief 消费锁
+        std::mutex m_drain_mutex;
+        /// @brief 丢弃数
+        std::atomic<uint64_t> m_dropped_count{ 0 };
+        /// @brief 解码失败数
+        std::atomic<uint64_t> m_decode_failure_count{ 0 };
+        /// @brief 后台线程状态锁
+        std::mutex m_background_mutex;
+        /// @brief 后台线程唤醒条件
+        std::condition_variable m_background_condition;
+        /// @brief 后台线程是否应退出
+        bool m_is_stopping = false;
+        /// @brief 后台渲染线程
+        std::thread m_background_thread;
+    };
+}
@@ -0,0 +1,245 @@
+/**
+ * @file stringify_column.hpp
+ * @brief 列式批量字符串化
+ * @author DaneJoe001
+ * @version 0.2.0
+ * @date 2026-10-18
+ * @details 将同类型的一列值依次写入同一块连续缓冲，并记录每个值的起止偏移，
+ *          布局与Arrow字符串列一致：offsets[i]与offsets[i + 1]之间为第i个值。
+ *          分支与配置在每批开始时确定一次；整数按单值最大长度预留空间后
+ *          直接由数字查找表写入，其余类型按前若干个值的平均长度预估容量。
+ */
+#pragma once
+
+#include <span>
+#include <string>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+#include "danejoe/stringify/stringify_config.hpp"
+#include "danejoe/stringify/stringify_traits.hpp"
+#include "danejoe/stringify/stringify_integer.hpp"
+#include "danejoe/stringify/stringify_append.hpp"
+
+ /**
+  * @namespace DaneJoe
+  * @brief DaneJoe 命名空间
+  */
+namespace DaneJoe
+{
+    /**
+     * @class RawBufferWriter
+     * @brief 写入已预留空间的输出，不做边界检查
+     * @note 仅供调用方已按最大长度预留空间的场景使用
+     */
+    class RawBufferWriter
+    {
+    public:
+        /**
+         * @brief 构造函数
+         * @param current 写入起始位置
+         */
+        explicit RawBufferWriter(char* current) noexcept
+            : m_current(current)
+        {}
+        /**
+         * @brief 追加字符序列
+         * @param data 字符序列
+         * @param size 字符数量
+         */
+        void append(const char* data, std::size_t size) noexcept
+        {
+            std::memcpy(m_current, data, size);
+            m_current += size;
+        }
+        /**
+         * @brief 追加单个字符
+         * @param ch 字符
+         */
+        void push_back(char ch) noexcept
+        {
+            *m_current++ = ch;
+        }
+        /**
+         * @brief 获取当前写入位置
+         * @return 写入位置
+         */
+        char* get_current() const noexcept
+        {
+            return m_current;
+        }
+    private:
+        /// @brief 当前写入位置
+        char* m_current;
+    };
+    /**
+     * @brief 判断类型在列式输出中能否走整数快速路径
+     * @tparam T 类型
+     * @note 与append_to_string一致，char与unsigned char按字符输出，不在此列
+     */
+    template<class T>
+    struct is_column_integer : std::bool_constant<
+        is_integer_value<T>::value &&
+        !std::is_same_v<T, char> && !std::is_same_v<T, unsigned char> &&
+        !is_unicode_char<T>::value && !has_stringify_append<T>::value> {};
+    /**
+     * @brief 按配置计算单个整数输出的最大长度
+     * @tparam T 整数类型
+     * @param config 配置
+     * @return 最大字节数
+     */
+    template<class T>
+    std::size_t get_integer_max_size(const StringifyConfig& config)
+    {
+        constexpr std::size_t bit_count = sizeof(T) * 8;
+        std::size_t digit_count = 0;
+        switch (config.integer_base)
+        {
+        case IntegerBase::Binary:
+            digit_count = bit_count;
+            break;
+        case IntegerBase::Octal:
+            digit_count = (bit_count + 2) / 3;
+            break;
+        case IntegerBase::Hexadecimal:
+            digit_count = bit_count / 4;
+            break;
+        case IntegerBase::Decimal:
+        default:
+            // 每字节不超过3位十进制数字
+            digit_count = sizeof(T) * 3;
+            break;
+        }
+        if (digit_count < config.integer_width)
+        {
+            digit_count = config.integer_width;
+        }
+        std::size_t size = 1 + get_integer_prefix(config.integer_base).size() + digit_count;
+        if (!config.integer_group_symbol.empty() && config.integer_group_size != 0)
+        {
+            size += (digit_count - 1) / config.integer_group_size * config.integer_group_symbol.size();
+        }
+        return size;
+    }
+    /**
+     * @brief 以整数快速路径输出一列值
+     * @tparam T 整数类型
+     * @tparam Buffer 缓冲类型，char的std::basic_string
+     * @tparam Offsets 偏移容器类型
+     * @param values 值
+     * @param buffer 缓冲
+     * @param offsets 偏移
+     * @param config 配置
+     */
+    template<class T, class Buffer, class Offsets>
+    void stringify_integer_column(std::span<const T> values, Buffer& buffer, Offsets& offsets,
+        const StringifyConfig& config)
+    {
+        using Offset = typename Offsets::value_type;
+        // 分块预留，避免按最大长度一次性预留整列
+        constexpr std::size_t chunk_size = 4096;
+        const bool is_plain_decimal = config.integer_base == IntegerBase::Decimal &&
+            config.integer_width == 0 && (config.integer_group_symbol.empty() || config.integer_group_size == 0);
+        const std::size_t max_size = get_integer_max_size<T>(config);
+        const std::size_t column_begin = buffer.size();
+        for (std::size_t first = 0; first < values.size(); first += chunk_size)
+        {
+            const std::size_t last = first + chunk_size < values.size() ? first + chunk_size : values.size();
+            if (first == chunk_size)
+            {
+                // 以首块的平均长度预估整列所需容量，另留一块的最大长度
+                const std::size_t average_size = (buffer.size() - column_begin + chunk_size - 1) / chunk_size;
+                buffer.reserve(buffer.size() + (values.size() - first) * average_size + chunk_size * max_size);
+            }
+            const std::size_t begin = buffer.size();
+            buffer.resize(begin + (last - first) * max_size);
+            char* const base = buffer.data();
+            RawBufferWriter writer(base + begin);
+            if (is_plain_decimal)
+            {
+                for (std::size_t i = first; i < last; ++i)
+                {
+                    append_integer(writer, values[i]);
+                    offsets.push_back(static_cast<Offset>(writer.get_current() - base));
+                }
+            }
+            else
+            {
+                for (std::size_t i = first; i < last; ++i)
+                {
+                    append_integer(writer, values[i], config);
+                    offsets.push_back(static_cast<Offset>(writer.get_current() - base));
+                }
+            }
+            buffer.resize(static_cast<std::size_t>(writer.get_current() - base));
+        }
+    }
+    /**
+     * @brief 将一列值连续写入缓冲并记录偏移
+     * @tparam T 值类型
+     * @tparam Buffer 缓冲类型，须提供append、push_back、size与reserve，如std::string
+     * @tparam Offsets 偏移容器类型，如std::vector<int32_t>或std::vector<int64_t>
+     * @param values 值
+     * @param buffer 缓冲，追加写入
+     * @param offsets 偏移，追加写入；为空时先写入当前缓冲大小作为起始偏移
+     * @param config 配置
+     * @note 可对同一缓冲多次调用以拼接多批；偏移类型须能表示缓冲的最终大小
+     */
+    template<class T, class Buffer, class Offsets>
+    void stringify_column(std::span<const T> values, Buffer& buffer, Offsets& offsets,
+        const StringifyConfig& config)
+    {
+        using Offset = typename Offsets::value_type;
+        // 先预留再写入起始偏移，避免起始偏移单独分配一次
+        offsets.reserve(offsets.size() + values.size() + (offsets.empty() ? 1 : 0));
+        if (offsets.empty())
+        {
+            offsets.push_back(static_cast<Offset>(buffer.size()));
+        }
+        if constexpr (is_column_integer<T>::value && is_basic_string<Buffer>::value)
+        {
+            stringify_integer_column(values, buffer, offsets, config);
+        }
+        else
+        {
+            // 以前若干个值的平均长度预估整列所需容量
+            constexpr std::size_t sample_count = 32;
+            const std::size_t sample_end = values.size() < sample_count ? values.size() : sample_count;
+            const std::size_t sample_begin = buffer.size();
+            for (std::size_t i = 0; i < sample_end; ++i)
+            {
+                append_to_string(buffer, values[i], config);
+                offsets.push_back(static_cast<Offset>(buffer.size()));
+            }
+            if (sample_end == values.size())
+            {
+                return;
+            }
+            const std::size_t sample_size = buffer.size() - sample_begin;
+            const std::size_t rest_count = values.size() - sample_end;
+            // 多预留1/8，减少平均长度偏小时的再分配
+            buffer.reserve(buffer.size() + sample_size * rest_count / sample_end * 9 / 8);
+            for (std::size_t i = sample_end; i < values.size(); ++i)
+            {
+                append_to_string(buffer, values[i], config);
+                offsets.push_back(static_cast<Offset>(buffer.size()));
+            }
+        }
+    }
+    /**
+     * @brief 使用全局配置将一列值连续写入缓冲并记录偏移
+     * @tparam T 值类型
+     * @tparam Buffer 缓冲类型
+     * @tparam Offsets 偏移容器类型
+     * @param values 值
+     * @param buffer 缓冲，追加写入
+     * @param offsets 偏移，追加写入
+     * @note 整批只读取一次配置快照
+     */
+    template<class T, class Buffer, class Offsets>
+    void stringify_column(std::span<const T> values, Buffer& buffer, Offsets& offsets)
+    {
+        stringify_column(values, buffer, offsets, *StringifyConfigManager::get_config_snapshot());
+    }
+}
@@ -9,6 +9,12 @@
 
 #include <string>
 #include <mutex>
+#include <atomic>
+#include <memory>
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <string_view>
 
 #include "danejoe/common/enum/enum_convert.hpp"
 
@@ -97,6 +103,49 @@ namespace DaneJoe
         /// @brief 值符号
         DelimiterSymbol value_symbol = { "(",")",":"," " };
     };
+    /**
+     * @enum FloatFormat
+     * @brief 浮点数输出格式
+     */
+    enum class FloatFormat
+    {
+        /// @brief 可往返的最短表示（std::to_chars默认行为）
+        Shortest = 0,
+        /// @brief 定点表示
+        Fixed,
+        /// @brief 科学计数法
+        Scientific,
+        /// @brief 定点与科学计数法中较短者
+        General
+    };
+    /**
+     * @enum IntegerBase
+     * @brief 整数进制
+     */
+    enum class IntegerBase
+    {
+        /// @brief 十进制
+        Decimal = 0,
+        /// @brief 二进制，前缀0b
+        Binary,
+        /// @brief 八进制，前缀0
+        Octal,
+        /// @brief 十六进制（小写），前缀0x
+        Hexadecimal
+    };
+    /**
+     * @enum BitFormat
+     * @brief 位序列（std::vector<bool>、std::bitset、BitSpan）输出格式
+     */
+    enum class BitFormat
+    {
+        /// @brief 按元素输出，如[true, false]；std::bitset无元素形式，按Binary输出
+        Element = 0,
+        /// @brief 连续的0与1
+        Binary,
+        /// @brief 每4位一个十六进制数字（小写）
+        Hexadecimal
+    };
     /**
      * @enum StorageUnit
      * @brief 存储单位
@@ -125,6 +174,12 @@ namespace DaneJoe
         Unknown
     };
 
+    /**
+     * @brief 获取存储单位枚举名（调试用）
+     * @param unit 存储单位
+     * @return 对应的枚举名，指向字符串字面量
+     */
+    std::string_view get_storage_unit_name(StorageUnit unit) noexcept;
     /**
      * @brief 获取存储单位枚举字符串（调试用）
      * @param unit 存储单位
@@ -166,17 +221,50 @@ namespace DaneJoe
         TimeSymbol time_symbol = { "s","ms","us","ns" };
         /// @brief 布尔值符号
         BoolSymbol bool_symbol = { "true", "false" };
+        /// @brief 浮点数输出格式
+        FloatFormat float_format = FloatFormat::Shortest;
+        /// @brief 浮点数精度
+        /// @note 小于0时按所选格式输出可往返的最短表示；Shortest格式忽略此项
+        int float_precision = -1;
+        /// @brief 整数进制
+        /// @note 负数输出为符号加绝对值，如-0xff
+        IntegerBase integer_base = IntegerBase::Decimal;
+        /// @brief 是否输出进制前缀
+        bool is_show_integer_prefix = false;
+        /// @brief 整数最小位数，不足时在前面补0
+        std::size_t integer_width = 0;
+        /// @brief 数字分组符号，为空时不分组
+        std::string integer_group_symbol = "";
+        /// @brief 每组位数
+        /// @note 为0时不分组
+        std::size_t integer_group_size = 3;
+        /// @brief 是否按键排序输出无序容器
+        /// @note 排序后与同内容的std::map/std::set输出一致；键不支持operator<时按哈希值排序。
+        /// @note 定长缓冲输出（stringify_to）不分配内存，始终按桶顺序输出
+        bool is_sort_unordered_container = false;
+        /// @brief 位序列输出格式
+        /// @note std::vector<bool>与BitSpan按下标顺序输出；std::bitset与operator<<一致，从高位到低位输出
+        BitFormat bit_format = BitFormat::Element;
+        /// @brief 位序列分组符号，为空时不分组
+        std::string bit_group_symbol = "";
+        /// @brief 位序列每组数字个数
+        /// @note 为0时不分组；std::bitset与整数一样从低位开始分组
+        std::size_t bit_group_size = 8;
         /// @brief 存储单位
         int storage_units = 1024;
         /// @brief 存储单位符号
         StorageSymbol storage_symbol = StorageSymbol();
         /// @brief 最大递归深度
-        /// @note 暂未启用
+        /// @note 仅迭代遍历（to_string_iterative）启用，超过深度的容器、pair与tuple使用省略号表示
+        /// @note 小于0表示不限制
         int max_depth = -1;
         /// @brief 最大字符串化元素数量
-        /// @note 暂未启用
         /// @note 超过部分使用...表示
+        /// @note 小于0表示不限制
         int max_stringify_element_count = -1;
+        /// @brief 多维视图各维的最大字符串化元素数量
+        /// @note 第i项限制第i维（0为最外层）；缺省或小于0的维度使用max_stringify_element_count
+        std::vector<int> max_stringify_dimension_element_count;
     };
     /**
      * @class ConfigManager
@@ -190,6 +278,24 @@ namespace DaneJoe
          * @return 配置
          */
         static StringifyConfig get_config();
+        /**
+         * @brief 获取配置快照
+         * @return 只读配置的共享指针
+         * @note 仅增加引用计数，不复制配置中的字符串；set_config后旧快照仍然有效
+         */
+        static std::shared_ptr<const StringifyConfig> get_config_snapshot();
+        /**
+         * @brief 获取默认配置
+         * @return 默认配置的引用
+         * @note 不加锁、不分配，可在信号处理函数与实时线程中使用
+         */
+        static const StringifyConfig& get_default_config() noexcept;
+        /**
+         * @brief 获取配置版本
+         * @return 配置版本，每次set_config后递增
+         * @note 不加锁，可用于判断基于旧配置的缓存是否失效
+         */
+        static uint64_t get_config_version() noexcept;
         /**
          * @brief 设置配置
          * @param config 配置
@@ -197,7 +303,11 @@ namespace DaneJoe
         static void set_config(const StringifyConfig& config);
     private:
         /// @brief 配置
-        static StringifyConfig m_config;
+        static std::shared_ptr<const StringifyConfig> m_config;
+        /// @brief 默认配置
+        static const StringifyConfig m_default_config;
+        /// @brief 配置版本
+        static std::atomic<uint64_t> m_config_version;
         /// @brief 互斥锁
         static std::mutex m_mutex;
     };
@@ -0,0 +1,580 @@
+/**
+ * @file stringify_constexpr.hpp
+ * @brief 编译期字符串化
+ * @author DaneJoe001
+ * @version 0.2.0
+ * @date 2026-10-18
+ * @details 追加引擎的constexpr子集：整数、布尔、字符、枚举、字符串字面量与std::string_view，
+ *          以及由它们组成的std::array、C数组、std::pair与std::tuple。
+ *          先以计数输出求得长度，再写入长度恰好的fixed_string<N>，
+ *          结果可作为constexpr变量存放于只读段，无运行期开销与静态初始化顺序问题。
+ *          除枚举外，输出与默认配置下的DaneJoe::to_string一致。
+ *          枚举输出为"类型名::枚举项"，无对应枚举项时为"类型名(值)"；
+ *          to_string对一般枚举输出typeid名与数值，如"<typeid名>(值)"，仅StorageUnit、FormatPosition两者相同。
+ */
+#pragma once
+
+#include <array>
+#include <tuple>
+#include <limits>
+#include <cstddef>
+#include <utility>
+#include <string_view>
+#include <type_traits>
+
+#include "danejoe/common/type_traits/std_type_traits.hpp"
+#include "danejoe/stringify/stringify_traits.hpp"
+#include "danejoe/stringify/stringify_integer.hpp"
+
+#ifndef DANEJOE_STRINGIFY_ENUM_RANGE_MIN
+/// @brief 编译期枚举名查找的最小值
+#define DANEJOE_STRINGIFY_ENUM_RANGE_MIN -128
+#endif
+
+#ifndef DANEJOE_STRINGIFY_ENUM_RANGE_MAX
+/// @brief 编译期枚举名查找的最大值
+#define DANEJOE_STRINGIFY_ENUM_RANGE_MAX 127
+#endif
+
+ /**
+  * @namespace DaneJoe
+  * @brief DaneJoe 命名空间
+  */
+namespace DaneJoe
+{
+    /**
+     * @class fixed_string
+     * @brief 长度固定的编译期字符串
+     * @tparam N 字符数，不含结尾的'\0'
+     */
+    template<std::size_t N>
+    class fixed_string
+    {
+    public:
+        /**
+         * @brief 构造函数，内容全部为'\0'
+         */
+        constexpr fixed_string() = default;
+        /**
+         * @brief 从字符串字面量构造
+         * @param text 字符串字面量
+         */
+        constexpr fixed_string(const char(&text)[N + 1])
+        {
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                m_data[i] = text[i];
+            }
+        }
+        /**
+         * @brief 获取字符数
+         * @return 字符数
+         */
+        static constexpr std::size_t size() noexcept
+        {
+            return N;
+        }
+        /**
+         * @brief 获取字符数据
+         * @return 以'\0'结尾的字符数据
+         */
+        constexpr const char* data() const noexcept
+        {
+            return m_data;
+        }
+        /**
+         * @brief 获取可写字符数据
+         * @return 字符数据
+         */
+        constexpr char* data() noexcept
+        {
+            return m_data;
+        }
+        /**
+         * @brief 获取C字符串
+         * @return 以'\0'结尾的字符数据
+         */
+        constexpr const char* c_str() const noexcept
+        {
+            return m_data;
+        }
+        /**
+         * @brief 获取字符串视图
+         * @return 字符串视图
+         */
+        constexpr std::string_view view() const noexcept
+        {
+            return std::string_view(m_data, N);
+        }
+        /**
+         * @brief 转为字符串视图
+         * @return 字符串视图
+         */
+        constexpr operator std::string_view() const noexcept
+        {
+            return view();
+        }
+        /**
+         * @brief 按下标访问字符
+         * @param index 下标
+         * @return 字符
+         */
+        constexpr char operator[](std::size_t index) const noexcept
+        {
+            return m_data[index];
+        }
+        /**
+         * @brief 与字符串视图比较
+         * @param left 编译期字符串
+         * @param right 字符串视图
+         * @return 内容相同时为true
+         */
+        friend constexpr bool operator==(const fixed_string& left, std::string_view right) noexcept
+        {
+            return left.view() == right;
+        }
+    private:
+        /// @brief 字符数据，末尾为'\0'
+        char m_data[N + 1] = {};
+    };
+    /**
+     * @brief 从字符串字面量推导长度
+     * @tparam N 含'\0'的数组长度
+     */
+    template<std::size_t N>
+    fixed_string(const char(&)[N]) -> fixed_string<N - 1>;
+    /**
+     * @brief 判断类型是否为fixed_string
+     * @tparam T 类型
+     */
+    template<class T>
+    struct is_fixed_string : std::false_type {};
+    /**
+     * @brief is_fixed_string的匹配分支
+     * @tparam N 字符数
+     */
+    template<std::size_t N>
+    struct is_fixed_string<fixed_string<N>> : std::true_type {};
+    /**
+     * @class ConstexprSizeCounter
+     * @brief 只统计长度的编译期输出
+     */
+    class ConstexprSizeCounter
+    {
+    public:
+        /**
+         * @brief 追加字符序列
+         * @param size 字符数量
+         */
+        constexpr void append(const char*, std::size_t size) noexcept
+        {
+            m_size += size;
+        }
+        /**
+         * @brief 追加单个字符
+         */
+        constexpr void push_back(char) noexcept
+        {
+            ++m_size;
+        }
+        /**
+         * @brief 获取已统计的长度
+         * @return 长度
+         */
+        constexpr std::size_t size() const noexcept
+        {
+            return m_size;
+        }
+    private:
+        /// @brief 已统计的长度
+        std::size_t m_size = 0;
+    };
+    /**
+     * @class ConstexprBufferWriter
+     * @brief 写入已知长度缓冲的编译期输出
+     */
+    class ConstexprBufferWriter
+    {
+    public:
+        /**
+         * @brief 构造函数
+         * @param current 写入起始位置
+         */
+        explicit constexpr ConstexprBufferWriter(char* current) noexcept
+            : m_current(current)
+        {}
+        /**
+         * @brief 追加字符序列
+         * @param data 字符序列
+         * @param size 字符数量
+         */
+        constexpr void append(const char* data, std::size_t size) noexcept
+        {
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                *m_current++ = data[i];
+            }
+        }
+        /**
+         * @brief 追加单个字符
+         * @param ch 字符
+         */
+        constexpr void push_back(char ch) noexcept
+        {
+            *m_current++ = ch;
+        }
+    private:
+        /// @brief 当前写入位置
+        char* m_current;
+    };
+    /**
+     * @brief 获取包含模板实参的函数签名
+     * @tparam T 类型
+     * @return 编译器生成的函数签名
+     */
+    template<class T>
+    constexpr std::string_view get_type_signature() noexcept
+    {
+#if defined(_MSC_VER) && !defined(__clang__)
+        return __FUNCSIG__;
+#else
+        return __PRETTY_FUNCTION__;
+#endif
+    }
+    /**
+     * @brief 获取包含非类型模板实参的函数签名
+     * @tparam Value 值
+     * @return 编译器生成的函数签名
+     */
+    template<auto Value>
+    constexpr std::string_view get_value_signature() noexcept
+    {
+#if defined(_MSC_VER) && !defined(__clang__)
+        return __FUNCSIG__;
+#else
+        return __PRETTY_FUNCTION__;
+#endif
+    }
+    /**
+     * @brief 从函数签名中取出模板实参的文本
+     * @param signature 函数签名
+     * @param marker GCC/Clang签名中实参前的标记，如"T = "
+     * @return 实参文本
+     */
+    constexpr std::string_view extract_template_argument(std::string_view signature, std::string_view marker) noexcept
+    {
+#if defined(_MSC_VER) && !defined(__clang__)
+        // MSVC：...get_xxx_signature<实参>(void)，返回类型中也可能含'<'
+        constexpr std::string_view prefix = "_signature<";
+        const std::size_t begin = signature.find(prefix) + prefix.size();
+        const std::size_t end = signature.rfind(">(void)");
+        return signature.substr(begin, end - begin);
+#else
+        // GCC：[with T = 实参; ...]，Clang：[T = 实参]
+        const std::size_t begin = signature.find(marker) + marker.size();
+        std::size_t end = signature.find(';', begin);
+        if (end == std::string_view::npos)
+        {
+            end = signature.rfind(']');
+        }
+        return signature.substr(begin, end - begin);
+#endif
+    }
+    /**
+     * @brief 去掉限定名前的作用域
+     * @param name 名称
+     * @return 最后一个"::"之后的部分
+     */
+    constexpr std::string_view remove_scope(std::string_view name) noexcept
+    {
+        const std::size_t position = name.rfind("::");
+        return position == std::string_view::npos ? name : name.substr(position + 2);
+    }
+    /**
+     * @brief 获取枚举类型的名称
+     * @tparam T 枚举类型
+     * @return 不含命名空间的类型名
+     */
+    template<class T>
+    constexpr std::string_view get_enum_type_name() noexcept
+    {
+        std::string_view name = extract_template_argument(get_type_signature<T>(), "T = ");
+        // MSVC的类型实参带有"enum "前缀
+        const std::size_t space = name.rfind(' ');
+        if (space != std::string_view::npos)
+        {
+            name = name.substr(space + 1);
+        }
+        return remove_scope(name);
+    }
+    /**
+     * @brief 获取枚举值对应的枚举项名称
+     * @tparam Value 枚举值
+     * @return 不含作用域的枚举项名称，无对应枚举项时为空
+     */
+    template<auto Value>
+    constexpr std::string_view get_enum_value_name() noexcept
+    {
+        const std::string_view name = extract_template_argument(get_value_signature<Value>(), "Value = ");
+        // 无对应枚举项时编译器输出"(类型)值"或"0x..."形式
+        if (name.empty() || name.front() == '(' || name.find(')') != std::string_view::npos ||
+            (name.front() >= '0' && name.front() <= '9') || name.front() == '-')
+        {
+            return {};
+        }
+        return remove_scope(name);
+    }
+    /**
+     * @brief 判断枚举是否具有固定底层类型（限定枚举或显式指定底层类型）
+     * @tparam T 枚举类型
+     */
+    template<class T, class = void>
+    struct has_fixed_underlying_type : std::false_type {};
+    /**
+     * @brief 判断枚举是否具有固定底层类型（特化）
+     * @details 仅固定底层类型的枚举可由底层类型值直接列表初始化
+     * @tparam T 枚举类型
+     */
+    template<class T>
+    struct has_fixed_underlying_type<T, std::void_t<decltype(T{ std::underlying_type_t<T>{} })>> : std::true_type {};
+    /**
+     * @brief 编译期枚举名查找范围
+     * @tparam T 枚举类型
+     * @note 与底层类型的取值范围取交集
+     */
+    template<class T>
+    struct EnumNameRange
+    {
+        // 未固定底层类型的枚举取值范围仅覆盖枚举项所需的位数，超出范围的转换在常量表达式中非法
+        static_assert(has_fixed_underlying_type<T>::value,
+            "compile-time enum names require a scoped enum or an explicit underlying type");
+        /// @brief 底层类型
+        using Underlying = std::underlying_type_t<T>;
+        /// @brief 最小值
+        static constexpr long long min_value =
+            static_cast<long long>(std::numeric_limits<Underlying>::min()) > DANEJOE_STRINGIFY_ENUM_RANGE_MIN ?
+            static_cast<long long>(std::numeric_limits<Underlying>::min()) : DANEJOE_STRINGIFY_ENUM_RANGE_MIN;
+        /// @brief 最大值
+        static constexpr long long max_value =
+            static_cast<unsigned long long>(std::numeric_limits<Underlying>::max()) <
+            static_cast<unsigned long long>(DANEJOE_STRINGIFY_ENUM_RANGE_MAX) ?
+            static_cast<long long>(std::numeric_limits<Underlying>::max()) : DANEJOE_STRINGIFY_ENUM_RANGE_MAX;
+        /// @brief 值的个数
+        static constexpr std::size_t count = static_cast<std::size_t>(max_value - min_value + 1);
+    };
+    /**
+     * @brief 生成查找范围内各值的枚举项名称表
+     * @tparam T 枚举类型
+     * @tparam Index 相对最小值的偏移
+     * @return 名称表
+     */
+    template<class T, std::size_t... Index>
+    constexpr std::array<std::string_view, sizeof...(Index)> make_enum_name_table(std::index_sequence<Index...>) noexcept
+    {
+        return { get_enum_value_name<static_cast<T>(EnumNameRange<T>::min_value + static_cast<long long>(Index))>()... };
+    }
+    /**
+     * @brief 查找范围内各值的枚举项名称表
+     * @tparam T 枚举类型
+     */
+    template<class T>
+    inline constexpr auto enum_name_table = make_enum_name_table<T>(std::make_index_sequence<EnumNameRange<T>::count>());
+    /**
+     * @brief 在编译期获取枚举值的枚举项名称
+     * @tparam T 枚举类型
+     * @param value 枚举值
+     * @return 枚举项名称，不在查找范围或无对应枚举项时为空
+     * @note 查找范围由DANEJOE_STRINGIFY_ENUM_RANGE_MIN/MAX指定；
+     *       仅支持限定枚举或显式指定底层类型的枚举
+     */
+    template<class T>
+    constexpr std::string_view get_enum_name(T value) noexcept
+    {
+        const auto raw = static_cast<long long>(value);
+        if (raw < EnumNameRange<T>::min_value || raw > EnumNameRange<T>::max_value)
+        {
+            return {};
+        }
+        return enum_name_table<T>[static_cast<std::size_t>(raw - EnumNameRange<T>::min_value)];
+    }
+    /**
+     * @brief 在编译期追加十进制整数
+     * @tparam Out 输出类型
+     * @tparam T 整数类型
+     * @param out 输出
+     * @param value 整数
+     */
+    template<class Out, class T>
+    constexpr void append_constexpr_integer(Out& out, T value)
+    {
+        char buffer[sizeof(T) * 3 + 2] = {};
+        std::size_t begin = sizeof(buffer);
+        auto magnitude = get_integer_magnitude(value);
+        do
+        {
+            buffer[--begin] = static_cast<char>('0' + static_cast<unsigned>(magnitude % 10));
+            magnitude /= 10;
+        } while (magnitude != 0);
+        if (is_negative_integer(value))
+        {
+            buffer[--begin] = '-';
+        }
+        out.append(buffer + begin, sizeof(buffer) - begin);
+    }
+    /**
+     * @brief 在编译期追加字符串片段
+     * @tparam Out 输出类型
+     * @param out 输出
+     * @param text 字符串片段
+     */
+    template<class Out>
+    constexpr void append_constexpr_text(Out& out, std::string_view text)
+    {
+        out.append(text.data(), text.size());
+    }
+    /**
+     * @brief 编译期追加接口
+     * @tparam Out 输出类型
+     * @tparam T 类型
+     * @param out 输出
+     * @param value 对象
+     * @note 符号与默认StringifyConfig一致
+     */
+    template<class Out, class T>
+    constexpr void append_constexpr(Out& out, const T& value)
+    {
+        if constexpr (is_fixed_string<T>::value || std::is_same_v<T, std::string_view>)
+        {
+            append_constexpr_text(out, value);
+        }
+        else if constexpr (std::is_same_v<std::decay_t<T>, const char*> || std::is_same_v<std::decay_t<T>, char*>)
+        {
+            if (value == nullptr)
+            {
+                append_constexpr_text(out, "<null>");
+                return;
+            }
+            append_constexpr_text(out, std::string_view(value));
+        }
+        else if constexpr (std::is_enum_v<T>)
+        {
+            append_constexpr_text(out, get_enum_type_name<T>());
+            const std::string_view name = get_enum_name(value);
+            if (name.empty())
+            {
+                out.push_back('(');
+                append_constexpr_integer(out, static_cast<std::underlying_type_t<T>>(value));
+                out.push_back(')');
+                return;
+            }
+            append_constexpr_text(out, "::");
+            append_constexpr_text(out, name);
+        }
+        else if constexpr (std::is_same_v<T, char> || std::is_same_v<T, unsigned char>)
+        {
+            out.push_back(static_cast<char>(value));
+        }
+        else if constexpr (std::is_same_v<T, bool>)
+        {
+            append_constexpr_text(out, value ? "true" : "false");
+        }
+        else if constexpr (is_integer_value<T>::value && !is_unicode_char<T>::value)
+        {
+            append_constexpr_integer(out, value);
+        }
+        else if constexpr (is_std_pair<T>::value)
+        {
+            out.push_back('{');
+            append_constexpr(out, value.first);
+            append_constexpr_text(out, ": ");
+            append_constexpr(out, value.second);
+            out.push_back('}');
+        }
+        else if constexpr (is_std_tuple<T>::value)
+        {
+            out.push_back('(');
+            std::apply([&](const auto&... args)
+                {
+                    std::size_t index = 0;
+                    ((append_constexpr_text(out, index++ == 0 ? "" : ", "), append_constexpr(out, args)), ...);
+                }, value);
+            out.push_back(')');
+        }
+        else if constexpr (is_c_array<T>::value || is_std_array<T>::value)
+        {
+            out.push_back('[');
+            bool is_first = true;
+            for (const auto& element : value)
+            {
+                if (!is_first)
+                {
+                    append_constexpr_text(out, ", ");
+                }
+                is_first = false;
+                append_constexpr(out, element);
+            }
+            out.push_back(']');
+        }
+        else
+        {
+            static_assert(!sizeof(T), "append_constexpr: type is not supported at compile time");
+        }
+    }
+    /**
+     * @brief 在编译期计算字符串化后的长度
+     * @tparam T 类型
+     * @param value 对象
+     * @return 长度
+     */
+    template<class T>
+    constexpr std::size_t get_constexpr_stringify_size(const T& value)
+    {
+        ConstexprSizeCounter counter;
+        append_constexpr(counter, value);
+        return counter.size();
+    }
+    /**
+     * @brief 将编译期常量字符串化为fixed_string
+     * @tparam Function 无捕获lambda类型，调用后返回待转换的值
+     * @return 长度恰好的fixed_string
+     * @note 值经lambda传入，因而std::tuple、字符串字面量等不能作为模板实参的类型也可使用；
+     *       通常通过DANEJOE_FIXED_STRING(表达式)调用
+     */
+    template<class Function>
+    constexpr auto to_fixed_string(Function)
+    {
+        constexpr auto value = Function{}();
+        constexpr std::size_t size = get_constexpr_stringify_size(value);
+        fixed_string<size> result;
+        ConstexprBufferWriter writer(result.data());
+        append_constexpr(writer, value);
+        return result;
+    }
+    /**
+     * @brief 将编译期常量字符串化为fixed_string
+     * @tparam Value 可作为模板实参的值，如整数、枚举、std::array与std::pair
+     * @return 长度恰好的fixed_string
+     */
+    template<auto Value>
+    constexpr auto to_fixed_string()
+    {
+        return to_fixed_string([]
+            {
+                return Value;
+            });
+    }
+    /**
+     * @brief 编译期常量字符串化后的静态存储
+     * @tparam Value 可作为模板实参的值
+     * @note 可安全地取std::string_view，用于构造编译期标签表
+     */
+    template<auto Value>
+    inline constexpr auto fixed_string_v = to_fixed_string<Value>();
+}
+
+/**
+ * @brief 在编译期将表达式字符串化为fixed_string
+ * @param ... 常量表达式
+ */
+#define DANEJOE_FIXED_STRING(...) \
+    ::DaneJoe::to_fixed_string([] { return __VA_ARGS__; })
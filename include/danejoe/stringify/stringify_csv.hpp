@@ -0,0 +1,513 @@
+/**
+ * @file stringify_csv.hpp
+ * @brief CSV/TSV流式导出
+ * @author DaneJoe001
+ * @version 0.2.0
+ * @date 2026-10-18
+ * @details 每行可为std::tuple、std::pair、std::array、容器或聚合体，其中每个成员或元素为一个单元格。
+ *          单元格经append_to_string直接写入行缓冲，再以每次8字节的扫描检查分隔符、引号与换行，
+ *          仅在需要时按RFC 4180原地加引号并将引号加倍；缓冲达到阈值后整块写入输出端，
+ *          内存占用与导出总量无关。
+ */
+#pragma once
+
+#include <array>
+#include <string>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+#include <utility>
+#include <iterator>
+#include <string_view>
+#include <type_traits>
+#include <initializer_list>
+
+#include "danejoe/common/type_traits/std_type_traits.hpp"
+#include "danejoe/common/type_traits/container_traits.hpp"
+#include "danejoe/stringify/stringify_config.hpp"
+#include "danejoe/stringify/stringify_traits.hpp"
+#include "danejoe/stringify/stringify_append.hpp"
+
+ /**
+  * @namespace DaneJoe
+  * @brief DaneJoe 命名空间
+  */
+namespace DaneJoe
+{
+    /**
+     * @struct StringifyCsvOptions
+     * @brief CSV输出选项
+     * @note TSV将delimiter设为'\t'
+     */
+    struct StringifyCsvOptions
+    {
+        /// @brief 单元格分隔符
+        char delimiter = ',';
+        /// @brief 行结束符，RFC 4180为CRLF
+        std::string line_terminator = "\r\n";
+        /// @brief 是否为所有单元格加引号
+        bool is_always_quote = false;
+        /// @brief 缓冲阈值，达到后写入输出端
+        std::size_t buffer_size = 64 * 1024;
+    };
+    /**
+     * @brief 判断文本是否含有须加引号的字符（分隔符、双引号、CR、LF）
+     * @param data 文本
+     * @param size 字节数
+     * @param delimiter 分隔符
+     * @return 含有时为true
+     * @note 每次读取8字节，以位运算同时检查8个字节
+     */
+    inline bool has_csv_special_char(const char* data, std::size_t size, char delimiter) noexcept
+    {
+        constexpr std::uint64_t ones = 0x0101010101010101ULL;
+        constexpr std::uint64_t highs = 0x8080808080808080ULL;
+        // 与pattern相同的字节异或后为0，再由(x - 1) & ~x的最高位判断是否存在0字节
+        auto has_byte = [](std::uint64_t word, std::uint64_t pattern)
+            {
+                const std::uint64_t x = word ^ pattern;
+                return (x - ones) & ~x & highs;
+            };
+        const std::uint64_t delimiter_pattern = ones * static_cast<unsigned char>(delimiter);
+        auto has_special = [&](std::uint64_t word)
+            {
+                return (has_byte(word, delimiter_pattern) | has_byte(word, ones * '"') |
+                    has_byte(word, ones * '\r') | has_byte(word, ones * '\n')) != 0;
+            };
+        std::size_t i = 0;
+        for (; i + 8 <= size; i += 8)
+        {
+            std::uint64_t word;
+            std::memcpy(&word, data + i, 8);
+            if (has_special(word))
+            {
+                return true;
+            }
+        }
+        // 不足8字节的结尾逐字节检查
+        for (; i < size; ++i)
+        {
+            const char ch = data[i];
+            if (ch == delimiter || ch == '"' || ch == '\r' || ch == '\n')
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+    /**
+     * @struct AnyAggregateField
+     * @brief 可转换为任意类型的占位，用于统计聚合体成员数量
+     */
+    struct AnyAggregateField
+    {
+        template<class T>
+        constexpr operator T() const noexcept;
+    };
+    /**
+     * @brief 统计聚合体的成员数量
+     * @tparam T 聚合体类型
+     * @tparam Fields 已尝试的占位
+     * @return 可用于花括号初始化的最多成员数量，至多16
+     * @note 成员本身为聚合体或数组时，花括号省略会使计数偏大，此类行类型应使用std::tuple
+     */
+    template<class T, class... Fields>
+    constexpr std::size_t get_aggregate_field_count()
+    {
+        if constexpr (sizeof...(Fields) < 16 && requires { T{ Fields{}..., AnyAggregateField{} }; })
+        {
+            return get_aggregate_field_count<T, Fields..., AnyAggregateField>();
+        }
+        else
+        {
+            return sizeof...(Fields);
+        }
+    }
+    /**
+     * @brief 判断类型能否按成员拆分为单元格
+     * @tparam T 类型
+     */
+    template<class T>
+    struct is_csv_aggregate : std::bool_constant<
+        std::is_class_v<T> && std::is_aggregate_v<T> && !has_iterator<T>::value &&
+        !is_std_array<T>::value && !has_stringify_append<T>::value && !has_member_to_string<T>::value> {};
+    /**
+     * @brief 以聚合体的各成员调用函数
+     * @tparam T 聚合体类型
+     * @tparam Function 函数类型
+     * @param value 聚合体
+     * @param function 函数，以全部成员为参数
+     */
+    template<class T, class Function>
+    void apply_aggregate(const T& value, Function&& function)
+    {
+        constexpr std::size_t N = get_aggregate_field_count<T>();
+        static_assert(N > 0, "aggregate row must have 1 to 16 fields");
+        if constexpr (N == 1)
+        {
+            const auto& [f0] = value;
+            function(f0);
+        }
+        else if constexpr (N == 2)
+        {
+            const auto& [f0, f1] = value;
+            function(f0, f1);
+        }
+        else if constexpr (N == 3)
+        {
+            const auto& [f0, f1, f2] = value;
+            function(f0, f1, f2);
+        }
+        else if constexpr (N == 4)
+        {
+            const auto& [f0, f1, f2, f3] = value;
+            function(f0, f1, f2, f3);
+        }
+        else if constexpr (N == 5)
+        {
+            const auto& [f0, f1, f2, f3, f4] = value;
+            function(f0, f1, f2, f3, f4);
+        }
+        else if constexpr (N == 6)
+        {
+            const auto& [f0, f1, f2, f3, f4, f5] = value;
+            function(f0, f1, f2, f3, f4, f5);
+        }
+        else if constexpr (N == 7)
+        {
+            const auto& [f0, f1, f2, f3, f4, f5, f6] = value;
+            function(f0, f1, f2, f3, f4, f5, f6);
+        }
+        else if constexpr (N == 8)
+        {
+            const auto& [f0, f1, f2, f3, f4, f5, f6, f7] = value;
+            function(f0, f1, f2, f3, f4, f5, f6, f7);
+        }
+        else if constexpr (N == 9)
+        {
+            const auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8] = value;
+            function(f0, f1, f2, f3, f4, f5, f6, f7, f8);
+        }
+        else if constexpr (N == 10)
+        {
+            const auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9] = value;
+            function(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9);
+        }
+        else if constexpr (N == 11)
+        {
+            const auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10] = value;
+            function(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10);
+        }
+        else if constexpr (N == 12)
+        {
+            const auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11] = value;
+            function(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11);
+        }
+        else if constexpr (N == 13)
+        {
+            const auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12] = value;
+            function(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12);
+        }
+        else if constexpr (N == 14)
+        {
+            const auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13] = value;
+            function(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13);
+        }
+        else if constexpr (N == 15)
+        {
+            const auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14] = value;
+            function(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14);
+        }
+        else if constexpr (N == 16)
+        {
+            const auto& [f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15] = value;
+            function(f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15);
+        }
+    }
+    /**
+     * @class StringifyCsvWriter
+     * @brief 按行写入CSV/TSV的缓冲写入器
+     * @tparam Sink 输出端类型，提供write(const char*, size)（如std::ostream）或append(const char*, size)（如std::string）
+     * @note 析构时写出剩余缓冲
+     */
+    template<class Sink>
+    class StringifyCsvWriter
+    {
+    public:
+        /**
+         * @brief 构造函数
+         * @param sink 输出端
+         * @param options 选项
+         * @param config 配置，用于单元格的字符串化
+         */
+        StringifyCsvWriter(Sink& sink, const StringifyCsvOptions& options, const StringifyConfig& config)
+            : m_sink(sink), m_options(options), m_config(config)
+        {
+            m_buffer.reserve(m_options.buffer_size);
+            const std::string& group_symbol = m_config.integer_group_symbol;
+            m_is_number_special = has_csv_special_char(group_symbol.data(), group_symbol.size(), m_options.delimiter);
+        }
+        /**
+         * @brief 使用全局配置构造
+         * @param sink 输出端
+         * @param options 选项
+         */
+        explicit StringifyCsvWriter(Sink& sink, const StringifyCsvOptions& options = StringifyCsvOptions())
+            : StringifyCsvWriter(sink, options, *StringifyConfigManager::get_config_snapshot())
+        {}
+        StringifyCsvWriter(const StringifyCsvWriter&) = delete;
+        StringifyCsvWriter& operator=(const StringifyCsvWriter&) = delete;
+        /**
+         * @brief 析构函数，将剩余缓冲写入输出端
+         * @note 析构时写入失败抛出的异常被吞掉，剩余数据丢弃；需要感知写入错误时应在析构前显式调用flush
+         */
+        ~StringifyCsvWriter()
+        {
+            try
+            {
+                flush();
+            }
+            catch (...)
+            {
+            }
+        }
+        /**
+         * @brief 写入一行
+         * @tparam Row 行类型
+         * @param row 行：tuple、pair与std::array的每个元素、容器的每个元素或聚合体的每个成员为一个单元格，
+         *            字符串、字符串视图（含Unicode）等其余类型为单个单元格
+         */
+        template<class Row>
+        void write_row(const Row& row)
+        {
+            if constexpr (is_std_tuple<Row>::value || is_std_pair<Row>::value || is_std_array<Row>::value)
+            {
+                std::apply([this](const auto&... cells) { (write_cell(cells), ...); }, row);
+            }
+            else if constexpr ((has_iterator<Row>::value || is_c_array<Row>::value) &&
+                !is_basic_string<Row>::value && !is_std_string_view<Row>::value && !is_c_string<Row>::value &&
+                !is_unicode_string<Row>::value && !is_unicode_c_string<Row>::value)
+            {
+                for (const auto& cell : row)
+                {
+                    write_cell(cell);
+                }
+            }
+            else if constexpr (is_csv_aggregate<Row>::value)
+            {
+                apply_aggregate(row, [this](const auto&... cells) { (write_cell(cells), ...); });
+            }
+            else
+            {
+                write_cell(row);
+            }
+            end_row();
+        }
+        /**
+         * @brief 写入一行文本单元格，如表头
+         * @param cells 单元格
+         */
+        void write_row(std::initializer_list<std::string_view> cells)
+        {
+            for (std::string_view cell : cells)
+            {
+                write_cell(cell);
+            }
+            end_row();
+        }
+        /**
+         * @brief 依次写入多行
+         * @tparam Rows 行序列类型
+         * @param rows 行序列
+         */
+        template<class Rows>
+        void write_rows(const Rows& rows)
+        {
+            for (const auto& row : rows)
+            {
+                write_row(row);
+            }
+        }
+        /**
+         * @brief 将缓冲写入输出端
+         */
+        void flush()
+        {
+            if (m_buffer.empty())
+            {
+                return;
+            }
+            if constexpr (requires { m_sink.write(m_buffer.data(), std::streamsize()); })
+            {
+                m_sink.write(m_buffer.data(), static_cast<std::streamsize>(m_buffer.size()));
+            }
+            else
+            {
+                m_sink.append(m_buffer.data(), m_buffer.size());
+            }
+            m_buffer.clear();
+        }
+        /**
+         * @brief 获取已写入的行数
+         * @return 行数
+         */
+        std::size_t get_row_count() const noexcept
+        {
+            return m_row_count;
+        }
+    private:
+        /**
+         * @brief 写入一个单元格
+         * @tparam T 值类型
+         * @param value 值
+         */
+        template<class T>
+        void write_cell(const T& value)
+        {
+            if (!m_is_row_start)
+            {
+                m_buffer.push_back(m_options.delimiter);
+            }
+            m_is_row_start = false;
+            if constexpr ((is_std_string_view<T>::value || is_basic_string<T>::value) && !is_unicode_string<T>::value)
+            {
+                // 在源文本上检查，避免读取刚写入缓冲的字节
+                const std::string_view text(value.data(), value.size());
+                if (m_options.is_always_quote || has_csv_special_char(text.data(), text.size(), m_options.delimiter))
+                {
+                    append_quoted(text);
+                }
+                else
+                {
+                    m_buffer.append(text);
+                }
+            }
+            else
+            {
+                const std::size_t begin = m_buffer.size();
+                append_to_string(m_buffer, value, m_config);
+                constexpr bool is_number = !has_stringify_append<T>::value && (std::is_floating_point_v<T> ||
+                    (is_integer_value<T>::value && !std::is_same_v<T, char> && !std::is_same_v<T, unsigned char> &&
+                        !is_unicode_char<T>::value));
+                if constexpr (is_number)
+                {
+                    // 数字只含数字、符号、小数点、指数与分组符号，分组符号已在构造时检查
+                    if (m_options.is_always_quote || m_is_number_special)
+                    {
+                        quote_cell(begin);
+                    }
+                }
+                else if (m_options.is_always_quote ||
+                    has_csv_special_char(m_buffer.data() + begin, m_buffer.size() - begin, m_options.delimiter))
+                {
+                    quote_cell(begin);
+                }
+            }
+        }
+        /**
+         * @brief 追加加引号的文本，其中的引号加倍
+         * @param text 文本
+         */
+        void append_quoted(std::string_view text)
+        {
+            m_buffer.push_back('"');
+            for (std::size_t quote = text.find('"'); quote != std::string_view::npos; quote = text.find('"'))
+            {
+                m_buffer.append(text.data(), quote + 1);
+                m_buffer.push_back('"');
+                text.remove_prefix(quote + 1);
+            }
+            m_buffer.append(text);
+            m_buffer.push_back('"');
+        }
+        /**
+         * @brief 为缓冲中自begin起的单元格原地加引号，并将其中的引号加倍
+         * @param begin 单元格起始位置
+         */
+        void quote_cell(std::size_t begin)
+        {
+            const std::size_t end = m_buffer.size();
+            std::size_t quote_count = 0;
+            for (std::size_t i = begin; i < end; ++i)
+            {
+                quote_count += m_buffer[i] == '"';
+            }
+            m_buffer.resize(end + quote_count + 2);
+            // 自后向前移动，避免覆盖尚未移动的内容
+            char* const data = m_buffer.data();
+            std::size_t target = m_buffer.size();
+            data[--target] = '"';
+            for (std::size_t i = end; i > begin; --i)
+            {
+                const char ch = data[i - 1];
+                data[--target] = ch;
+                if (ch == '"')
+                {
+                    data[--target] = '"';
+                }
+            }
+            data[--target] = '"';
+        }
+        /**
+         * @brief 结束当前行，缓冲达到阈值时写入输出端
+         */
+        void end_row()
+        {
+            m_buffer.append(m_options.line_terminator);
+            m_is_row_start = true;
+            ++m_row_count;
+            if (m_buffer.size() >= m_options.buffer_size)
+            {
+                flush();
+            }
+        }
+        /// @brief 输出端
+        Sink& m_sink;
+        /// @brief 选项
+        StringifyCsvOptions m_options;
+        /// @brief 配置
+        StringifyConfig m_config;
+        /// @brief 行缓冲
+        std::string m_buffer;
+        /// @brief 是否位于行首
+        bool m_is_row_start = true;
+        /// @brief 数字的输出是否可能含有须加引号的字符
+        bool m_is_number_special = false;
+        /// @brief 已写入的行数
+        std::size_t m_row_count = 0;
+    };
+    /**
+     * @brief 将行序列写入输出端
+     * @tparam Rows 行序列类型
+     * @tparam Sink 输出端类型
+     * @param rows 行序列
+     * @param sink 输出端
+     * @param options 选项
+     * @param config 配置
+     * @return 写入的行数
+     */
+    template<class Rows, class Sink>
+    std::size_t stringify_csv(const Rows& rows, Sink& sink, const StringifyCsvOptions& options,
+        const StringifyConfig& config)
+    {
+        StringifyCsvWriter<Sink> writer(sink, options, config);
+        writer.write_rows(rows);
+        writer.flush();
+        return writer.get_row_count();
+    }
+    /**
+     * @brief 使用全局配置将行序列转为CSV文本
+     * @tparam Rows 行序列类型
+     * @param rows 行序列
+     * @param options 选项
+     * @return CSV文本
+     */
+    template<class Rows>
+    std::string stringify_csv(const Rows& rows, const StringifyCsvOptions& options = StringifyCsvOptions())
+    {
+        std::string result;
+        stringify_csv(rows, result, options, *StringifyConfigManager::get_config_snapshot());
+        return result;
+    }
+}
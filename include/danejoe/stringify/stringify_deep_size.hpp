@@ -0,0 +1,670 @@
+/**
+ * @file stringify_deep_size.hpp
+ * @brief 深层内存占用统计
+ * @author DaneJoe001
+ * @version 0.2.0
+ * @date 2026-10-18
+ * @details 按与append_to_string相同的类型分发遍历对象，估算其拥有的堆内存：
+ *          连续容器按capacity计算并统计未使用的预留，节点容器按节点头加元素估算，
+ *          字符串区分短字符串优化。只在元素类型可能拥有堆内存时才逐个访问元素，
+ *          路径只在进入占用最大的若干项时才生成，因此远快于字符串化。
+ * @note 节点头与块大小按常见实现（libstdc++）估算，不包含分配器自身的管理开销；
+ *       自定义类型与非拥有类型（视图、指针）只计sizeof
+ */
+#pragma once
+
+#include <array>
+#include <tuple>
+#include <string>
+#include <vector>
+#include <variant>
+#include <optional>
+#include <cstddef>
+#include <cstdint>
+#include <climits>
+#include <utility>
+#include <iterator>
+#include <algorithm>
+#include <type_traits>
+
+#include "danejoe/common/type_traits/std_type_traits.hpp"
+#include "danejoe/common/type_traits/container_traits.hpp"
+#include "danejoe/stringify/stringify_config.hpp"
+#include "danejoe/stringify/stringify_traits.hpp"
+#include "danejoe/stringify/stringify_append.hpp"
+#include "danejoe/stringify/stringify_format.hpp"
+
+ /**
+  * @namespace DaneJoe
+  * @brief DaneJoe 命名空间
+  */
+namespace DaneJoe
+{
+    /**
+     * @struct DeepSize
+     * @brief 内存占用
+     */
+    struct DeepSize
+    {
+        /// @brief 对象自身的字节数（sizeof）
+        std::size_t inline_size = 0;
+        /// @brief 拥有的堆内存字节数，包含预留与节点开销
+        std::size_t heap_size = 0;
+        /// @brief 已预留但未使用的字节数
+        std::size_t slack_size = 0;
+        /// @brief 节点头与桶数组等簿记开销的字节数
+        std::size_t node_overhead_size = 0;
+        /**
+         * @brief 获取总字节数
+         * @return 自身与堆内存之和
+         */
+        std::size_t get_total_size() const noexcept
+        {
+            return inline_size + heap_size;
+        }
+        /**
+         * @brief 累加堆内存统计
+         * @param other 另一统计
+         * @return 自身引用
+         */
+        DeepSize& operator+=(const DeepSize& other) noexcept
+        {
+            heap_size += other.heap_size;
+            slack_size += other.slack_size;
+            node_overhead_size += other.node_overhead_size;
+            return *this;
+        }
+    };
+    /**
+     * @struct DeepSizeOptions
+     * @brief 内存占用报告选项
+     */
+    struct DeepSizeOptions
+    {
+        /// @brief 根路径符号
+        std::string root_symbol = "$";
+        /// @brief 最多列出的项数，按堆内存从大到小；为0时只输出总计
+        std::size_t max_entry_count = 10;
+        /// @brief 非字节单位的小数位数
+        std::size_t precision = 2;
+    };
+    /**
+     * @brief 判断类型是否为std::basic_string（任意字符类型）
+     * @tparam T 类型
+     */
+    template<class T>
+    struct is_deep_size_string : std::false_type {};
+    /**
+     * @brief is_deep_size_string的匹配分支
+     * @tparam CharT 字符类型
+     * @tparam Traits 字符特征
+     * @tparam Allocator 分配器
+     */
+    template<class CharT, class Traits, class Allocator>
+    struct is_deep_size_string<std::basic_string<CharT, Traits, Allocator>> : std::true_type {};
+    /**
+     * @brief 判断类型是否为拥有元素的容器
+     * @tparam T 类型
+     * @note 以iterator与allocator_type判断，排除std::span、std::string_view等视图
+     */
+    template<class T, class = void>
+    struct is_owning_container : std::false_type {};
+    /**
+     * @brief is_owning_container的匹配分支
+     * @tparam T 类型
+     */
+    template<class T>
+    struct is_owning_container<T, std::void_t<typename T::allocator_type>> : has_iterator<T> {};
+    /**
+     * @brief 判断类型是否可能拥有堆内存
+     * @tparam T 类型
+     * @return 不可能时为false，此类元素不被逐个访问
+     */
+    template<class T>
+    constexpr bool has_deep_size_heap()
+    {
+        if constexpr (is_deep_size_string<T>::value || is_owning_container<T>::value)
+        {
+            return true;
+        }
+        else if constexpr (is_std_pair<T>::value)
+        {
+            return has_deep_size_heap<typename T::first_type>() || has_deep_size_heap<typename T::second_type>();
+        }
+        else if constexpr (is_std_tuple<T>::value)
+        {
+            return []<std::size_t... Indexes>(std::index_sequence<Indexes...>)
+            {
+                return (false || ... || has_deep_size_heap<std::tuple_element_t<Indexes, T>>());
+            }(std::make_index_sequence<std::tuple_size_v<T>>());
+        }
+        else if constexpr (is_std_variant<T>::value)
+        {
+            return []<std::size_t... Indexes>(std::index_sequence<Indexes...>)
+            {
+                return (false || ... || has_deep_size_heap<std::variant_alternative_t<Indexes, T>>());
+            }(std::make_index_sequence<std::variant_size_v<T>>());
+        }
+        else if constexpr (is_std_optional<T>::value || is_std_array<T>::value)
+        {
+            return has_deep_size_heap<typename T::value_type>();
+        }
+        else if constexpr (std::is_array_v<T>)
+        {
+            return has_deep_size_heap<std::remove_cv_t<std::remove_extent_t<T>>>();
+        }
+        else
+        {
+            return false;
+        }
+    }
+    /**
+     * @class DeepSizeMeasurer
+     * @brief 统计对象拥有的堆内存，并可记录占用最大的若干项
+     */
+    class DeepSizeMeasurer
+    {
+    public:
+        /**
+         * @struct Entry
+         * @brief 报告中的一项
+         */
+        struct Entry
+        {
+            /// @brief 路径
+            std::string path;
+            /// @brief 该项的内存占用（不含inline_size）
+            DeepSize size;
+            /// @brief 发现顺序，堆内存相同时先发现者优先
+            std::size_t sequence = 0;
+        };
+        /**
+         * @brief 只统计总量的构造函数
+         */
+        DeepSizeMeasurer() = default;
+        /**
+         * @brief 记录占用最大项的构造函数
+         * @param options 选项，须在统计期间保持有效
+         * @param config 配置，用于渲染路径中的键，须在统计期间保持有效
+         */
+        DeepSizeMeasurer(const DeepSizeOptions& options, const StringifyConfig& config)
+            : m_options(&options), m_config(&config), m_is_recording(options.max_entry_count != 0)
+        {}
+        /**
+         * @brief 统计对象拥有的堆内存
+         * @tparam T 类型
+         * @param value 对象
+         * @return 内存占用，inline_size为0
+         */
+        template<class T>
+        DeepSize measure(const T& value)
+        {
+            if constexpr (!has_deep_size_heap<T>())
+            {
+                return DeepSize();
+            }
+            else if constexpr (is_deep_size_string<T>::value)
+            {
+                const DeepSize size = measure_string(value);
+                record(size);
+                return size;
+            }
+            else if constexpr (is_std_vector_bool<T>::value)
+            {
+                // 按unsigned long的字存储位
+                constexpr std::size_t word_bits = sizeof(unsigned long) * CHAR_BIT;
+                DeepSize size;
+                size.heap_size = (value.capacity() + word_bits - 1) / word_bits * sizeof(unsigned long);
+                size.slack_size = size.heap_size - (value.size() + word_bits - 1) / word_bits * sizeof(unsigned long);
+                record(size);
+                return size;
+            }
+            else if constexpr (is_std_pair<T>::value)
+            {
+                DeepSize size;
+                push_segment(PathKind::Member, 0);
+                size += measure(value.first);
+                m_segments.back().index = 1;
+                size += measure(value.second);
+                m_segments.pop_back();
+                return size;
+            }
+            else if constexpr (is_std_tuple<T>::value)
+            {
+                DeepSize size;
+                push_segment(PathKind::TupleIndex, 0);
+                std::apply([&](const auto&... elements)
+                    {
+                        ((size += measure(elements), ++m_segments.back().index), ...);
+                    }, value);
+                m_segments.pop_back();
+                return size;
+            }
+            else if constexpr (is_std_optional<T>::value)
+            {
+                return value.has_value() ? measure(*value) : DeepSize();
+            }
+            else if constexpr (is_std_variant<T>::value)
+            {
+                if (value.valueless_by_exception())
+                {
+                    return DeepSize();
+                }
+                return std::visit([&](const auto& alternative) { return measure(alternative); }, value);
+            }
+            else if constexpr (is_std_array<T>::value || std::is_array_v<T>)
+            {
+                DeepSize size;
+                push_segment(PathKind::Index, 0);
+                for (const auto& element : value)
+                {
+                    size += measure(element);
+                    ++m_segments.back().index;
+                }
+                m_segments.pop_back();
+                return size;
+            }
+            else
+            {
+                const DeepSize size = measure_container(value);
+                record(size);
+                return size;
+            }
+        }
+        /**
+         * @brief 获取按堆内存从大到小排列的项
+         * @return 项
+         */
+        std::vector<Entry> get_sorted_entries() const
+        {
+            std::vector<Entry> entries = m_entries;
+            std::sort(entries.begin(), entries.end(), &is_better_entry);
+            return entries;
+        }
+        /**
+         * @brief 是否有项因数量上限被省略
+         * @return 有省略时为true
+         */
+        bool is_truncated() const noexcept
+        {
+            return m_is_truncated;
+        }
+    private:
+        /**
+         * @enum PathKind
+         * @brief 路径段类型
+         */
+        enum class PathKind
+        {
+            /// @brief 下标，[i]
+            Index,
+            /// @brief pair成员，.first或.second
+            Member,
+            /// @brief tuple成员，.i
+            TupleIndex,
+            /// @brief 关联容器的键，[key]
+            Key
+        };
+        /**
+         * @struct PathSegment
+         * @brief 延迟渲染的路径段
+         */
+        struct PathSegment
+        {
+            /// @brief 类型
+            PathKind kind = PathKind::Index;
+            /// @brief 下标或成员序号
+            std::size_t index = 0;
+            /// @brief 键
+            const void* key = nullptr;
+            /// @brief 渲染键
+            void (*append_key)(std::string&, const void*, const StringifyConfig&) = nullptr;
+        };
+        /**
+         * @brief 比较两项的排列顺序
+         * @param lhs 项
+         * @param rhs 项
+         * @return lhs排在rhs之前时为true
+         */
+        static bool is_better_entry(const Entry& lhs, const Entry& rhs)
+        {
+            return lhs.size.heap_size != rhs.size.heap_size ?
+                lhs.size.heap_size > rhs.size.heap_size :
+                lhs.sequence < rhs.sequence;
+        }
+        /**
+         * @brief 统计字符串
+         * @tparam T 字符串类型
+         * @param value 字符串
+         * @return 内存占用，短字符串不占堆内存
+         */
+        template<class T>
+        static DeepSize measure_string(const T& value)
+        {
+            using CharT = typename T::value_type;
+            // 默认构造的字符串容量即为短字符串缓冲的容量
+            static const std::size_t inline_capacity = std::basic_string<CharT>().capacity();
+            DeepSize size;
+            if (value.capacity() > inline_capacity)
+            {
+                size.heap_size = (value.capacity() + 1) * sizeof(CharT);
+                size.slack_size = (value.capacity() - value.size()) * sizeof(CharT);
+            }
+            return size;
+        }
+        /**
+         * @brief 累加节点容器的节点
+         * @tparam Element 元素类型
+         * @param size 内存占用
+         * @param count 节点数
+         * @param header_size 节点头字节数
+         */
+        template<class Element>
+        static void add_nodes(DeepSize& size, std::size_t count, std::size_t header_size)
+        {
+            constexpr std::size_t alignment = alignof(Element) > alignof(void*) ? alignof(Element) : alignof(void*);
+            const std::size_t node_size =
+                (header_size + sizeof(Element) + alignment - 1) / alignment * alignment;
+            size.heap_size += count * node_size;
+            size.node_overhead_size += count * (node_size - sizeof(Element));
+        }
+        /**
+         * @brief 统计容器
+         * @tparam T 容器类型
+         * @param value 容器
+         * @return 内存占用
+         */
+        template<class T>
+        DeepSize measure_container(const T& value)
+        {
+            using Element = typename T::value_type;
+            using Category = typename std::iterator_traits<typename T::const_iterator>::iterator_category;
+            DeepSize size;
+            std::size_t count = 0;
+            if constexpr (requires { value.size(); })
+            {
+                count = value.size();
+            }
+            else
+            {
+                count = static_cast<std::size_t>(std::distance(value.begin(), value.end()));
+            }
+            if constexpr (requires { value.capacity(); })
+            {
+                size.heap_size = value.capacity() * sizeof(Element);
+                size.slack_size = (value.capacity() - count) * sizeof(Element);
+            }
+            else if constexpr (is_ordered_container<T>::value)
+            {
+                // 红黑树节点：颜色与父、左、右指针
+                add_nodes<Element>(size, count, 4 * sizeof(void*));
+            }
+            else if constexpr (is_unordered_container<T>::value)
+            {
+                // 单链节点：后继指针与缓存的哈希值；另有桶数组
+                add_nodes<Element>(size, count, sizeof(void*) + sizeof(std::size_t));
+                const std::size_t bucket_size = value.bucket_count() * sizeof(void*);
+                size.heap_size += bucket_size;
+                size.node_overhead_size += bucket_size;
+            }
+            else if constexpr (std::is_base_of_v<std::random_access_iterator_tag, Category>)
+            {
+                // 分块的双端队列：每块至少512字节，另有块指针数组
+                constexpr std::size_t block_bytes = 512;
+                constexpr std::size_t block_count = sizeof(Element) < block_bytes ? block_bytes / sizeof(Element) : 1;
+                const std::size_t block_total = count / block_count + 1;
+                const std::size_t map_size = std::max<std::size_t>(8, block_total + 2) * sizeof(void*);
+                size.heap_size = block_total * block_count * sizeof(Element) + map_size;
+                size.slack_size = (block_total * block_count - count) * sizeof(Element);
+                size.node_overhead_size = map_size;
+            }
+            else if constexpr (std::is_base_of_v<std::bidirectional_iterator_tag, Category>)
+            {
+                add_nodes<Element>(size, count, 2 * sizeof(void*));
+            }
+            else
+            {
+                add_nodes<Element>(size, count, sizeof(void*));
+            }
+            if constexpr (has_deep_size_heap<Element>())
+            {
+                size += measure_elements(value);
+            }
+            return size;
+        }
+        /**
+         * @brief 统计容器元素
+         * @tparam T 容器类型
+         * @param value 容器
+         * @return 元素拥有的堆内存
+         */
+        template<class T>
+        DeepSize measure_elements(const T& value)
+        {
+            DeepSize size;
+            if constexpr (is_ordered_container<T>::value || is_unordered_container<T>::value)
+            {
+                using Key = typename T::key_type;
+                push_segment(PathKind::Key, 0);
+                m_segments.back().append_key = [](std::string& out, const void* key, const StringifyConfig& config)
+                    {
+                        append_to_string(out, *static_cast<const Key*>(key), config);
+                    };
+                for (const auto& element : value)
+                {
+                    const Key& key = get_unordered_key<T>(element);
+                    m_segments.back().key = &key;
+                    if constexpr (has_mapped_type<T>::value)
+                    {
+                        // 键的堆内存计入总量，路径[key]指向映射值
+                        const bool is_recording = std::exchange(m_is_recording, false);
+                        size += measure(key);
+                        m_is_recording = is_recording;
+                        size += measure(element.second);
+                    }
+                    else
+                    {
+                        size += measure(element);
+                    }
+                }
+            }
+            else
+            {
+                push_segment(PathKind::Index, 0);
+                for (const auto& element : value)
+                {
+                    size += measure(element);
+                    ++m_segments.back().index;
+                }
+            }
+            m_segments.pop_back();
+            return size;
+        }
+        /**
+         * @brief 压入路径段
+         * @param kind 类型
+         * @param index 下标或成员序号
+         */
+        void push_segment(PathKind kind, std::size_t index)
+        {
+            m_segments.push_back(PathSegment{ kind, index, nullptr, nullptr });
+        }
+        /**
+         * @brief 渲染当前路径
+         * @return 路径
+         */
+        std::string build_path() const
+        {
+            std::string path = m_options->root_symbol;
+            for (const PathSegment& segment : m_segments)
+            {
+                switch (segment.kind)
+                {
+                case PathKind::Index:
+                    path.push_back('[');
+                    append_integer(path, segment.index);
+                    path.push_back(']');
+                    break;
+                case PathKind::Member:
+                    path.append(segment.index == 0 ? ".first" : ".second");
+                    break;
+                case PathKind::TupleIndex:
+                    path.push_back('.');
+                    append_integer(path, segment.index);
+                    break;
+                case PathKind::Key:
+                    path.push_back('[');
+                    segment.append_key(path, segment.key, *m_config);
+                    path.push_back(']');
+                    break;
+                }
+            }
+            return path;
+        }
+        /**
+         * @brief 记录一项，只保留堆内存最大的max_entry_count项
+         * @param size 内存占用
+         */
+        void record(const DeepSize& size)
+        {
+            if (!m_is_recording || size.heap_size == 0)
+            {
+                return;
+            }
+            Entry candidate{ std::string(), size, m_sequence++ };
+            // 堆顶为已保留项中最小者
+            if (m_entries.size() == m_options->max_entry_count)
+            {
+                m_is_truncated = true;
+                if (!is_better_entry(candidate, m_entries.front()))
+                {
+                    return;
+                }
+                std::pop_heap(m_entries.begin(), m_entries.end(), &is_better_entry);
+                m_entries.pop_back();
+            }
+            candidate.path = build_path();
+            m_entries.push_back(std::move(candidate));
+            std::push_heap(m_entries.begin(), m_entries.end(), &is_better_entry);
+        }
+    private:
+        /// @brief 选项，只统计总量时为nullptr
+        const DeepSizeOptions* m_options = nullptr;
+        /// @brief 配置，只统计总量时为nullptr
+        const StringifyConfig* m_config = nullptr;
+        /// @brief 是否记录项
+        bool m_is_recording = false;
+        /// @brief 是否有项被省略
+        bool m_is_truncated = false;
+        /// @brief 下一项的发现顺序
+        std::size_t m_sequence = 0;
+        /// @brief 当前路径
+        std::vector<PathSegment> m_segments;
+        /// @brief 已保留的项
+        std::vector<Entry> m_entries;
+    };
+    /**
+     * @brief 统计对象的内存占用
+     * @tparam T 类型
+     * @param value 对象
+     * @return 内存占用
+     */
+    template<class T>
+    DeepSize deep_size(const T& value)
+    {
+        DeepSizeMeasurer measurer;
+        DeepSize size = measurer.measure(value);
+        size.inline_size = sizeof(T);
+        return size;
+    }
+    /**
+     * @brief 以合适的单位追加容量大小
+     * @tparam Out 输出类型
+     * @param out 输出缓冲
+     * @param size 容量大小(Bytes)
+     * @param precision 非字节单位的小数位数
+     * @param config 配置
+     */
+    template<class Out>
+    void append_deep_size_value(Out& out, std::size_t size, std::size_t precision, const StringifyConfig& config)
+    {
+        const StorageUnit unit = get_capacity_unit(size, config);
+        append_capacity_size(out, size, unit, unit == StorageUnit::Byte ? 0 : precision, config);
+    }
+    /**
+     * @brief 追加内存占用报告
+     * @tparam Out 输出类型
+     * @tparam T 类型
+     * @param out 输出缓冲
+     * @param value 对象
+     * @param options 选项
+     * @param config 配置
+     * @note 首行为总计，其后每行为“路径: 堆内存 (slack: 预留, node overhead: 节点开销)”，
+     *       按堆内存从大到小排列，项之间可以嵌套
+     */
+    template<class Out, class T>
+    void append_deep_size_report(Out& out, const T& value, const DeepSizeOptions& options,
+        const StringifyConfig& config)
+    {
+        DeepSizeMeasurer measurer(options, config);
+        DeepSize size = measurer.measure(value);
+        size.inline_size = sizeof(T);
+        auto append_detail = [&](const DeepSize& entry)
+            {
+                append_text(out, "slack: ");
+                append_deep_size_value(out, entry.slack_size, options.precision, config);
+                append_text(out, ", node overhead: ");
+                append_deep_size_value(out, entry.node_overhead_size, options.precision, config);
+                out.push_back(')');
+            };
+        append_text(out, "total: ");
+        append_deep_size_value(out, size.get_total_size(), options.precision, config);
+        append_text(out, " (inline: ");
+        append_deep_size_value(out, size.inline_size, options.precision, config);
+        append_text(out, ", heap: ");
+        append_deep_size_value(out, size.heap_size, options.precision, config);
+        append_text(out, ", ");
+        append_detail(size);
+        for (const auto& entry : measurer.get_sorted_entries())
+        {
+            out.push_back('\n');
+            append_text(out, entry.path);
+            append_text(out, ": ");
+            append_deep_size_value(out, entry.size.heap_size, options.precision, config);
+            append_text(out, " (");
+            append_detail(entry.size);
+        }
+        if (measurer.is_truncated())
+        {
+            out.push_back('\n');
+            append_text(out, config.ellipsis_symbol);
+        }
+    }
+    /**
+     * @brief 格式化内存占用报告
+     * @tparam T 类型
+     * @param value 对象
+     * @param options 选项
+     * @param config 配置
+     * @return 报告
+     */
+    template<class T>
+    std::string format_deep_size(const T& value, const DeepSizeOptions& options, const StringifyConfig& config)
+    {
+        std::string result;
+        append_deep_size_report(result, value, options, config);
+        return result;
+    }
+    /**
+     * @brief 使用全局配置格式化内存占用报告
+     * @tparam T 类型
+     * @param value 对象
+     * @param options 选项
+     * @return 报告
+     */
+    template<class T>
+    std::string format_deep_size(const T& value, const DeepSizeOptions& options = DeepSizeOptions())
+    {
+        return format_deep_size(value, options, *StringifyConfigManager::get_config_snapshot());
+    }
+}
@@ -0,0 +1,718 @@
+/**
+ * @file stringify_diff.hpp
+ * @brief 两个值的结构化差异
+ * @author DaneJoe001
+ * @version 0.2.0
+ * @date 2026-10-18
+ * @details 按与append_to_string相同的类型分发同时遍历两个值，只渲染不同的元素及其路径：
+ *          pair、tuple、optional与variant逐成员比较，关联容器按键合并或查找，
+ *          序列先去掉相同的首尾，再以Myers算法求最短编辑脚本得到插入与删除。
+ *          相同的区域只比较、不渲染，因此少量差异的大容器只需线性扫描。
+ */
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <tuple>
+#include <utility>
+#include <variant>
+#include <string_view>
+#include <iterator>
+#include <algorithm>
+#include <type_traits>
+
+#include "danejoe/common/type_traits/std_type_traits.hpp"
+#include "danejoe/common/type_traits/container_traits.hpp"
+#include "danejoe/stringify/stringify_config.hpp"
+#include "danejoe/stringify/stringify_traits.hpp"
+#include "danejoe/stringify/stringify_append.hpp"
+
+ /**
+  * @namespace DaneJoe
+  * @brief DaneJoe 命名空间
+  */
+namespace DaneJoe
+{
+    /**
+     * @struct StringifyDiffOptions
+     * @brief 差异输出选项
+     */
+    struct StringifyDiffOptions
+    {
+        /// @brief 根路径符号
+        std::string root_symbol = "$";
+        /// @brief 最多报告的差异数量，超出后以省略号结束
+        std::size_t max_difference_count = 64;
+        /// @brief 序列中每处差异前后输出的相同元素数量
+        std::size_t context_count = 1;
+        /// @brief 按最短编辑脚本对齐序列时的最大编辑距离
+        /// @note 超出后按下标逐个比较，避免差异很多时的平方级开销
+        std::size_t max_edit_distance = 1024;
+    };
+    /**
+     * @class StringifyDiffer
+     * @brief 比较两个值并逐行输出差异
+     * @note 每行为“标记 路径: 值”：~为修改（旧值 -> 新值），-为删除，+为插入，空格为上下文；
+     *       序列的修改与删除使用原值中的下标，插入使用新值中的下标
+     */
+    class StringifyDiffer
+    {
+    public:
+        /**
+         * @brief 构造函数
+         * @param out 输出
+         * @param options 选项
+         * @param config 配置
+         */
+        StringifyDiffer(std::string& out, const StringifyDiffOptions& options, const StringifyConfig& config)
+            : m_out(out), m_options(options), m_config(config), m_path(options.root_symbol)
+        {}
+        /**
+         * @brief 比较两个值
+         * @tparam T 类型
+         * @param a 原值
+         * @param b 新值
+         */
+        template<class T>
+        void compare(const T& a, const T& b)
+        {
+            if (m_is_truncated)
+            {
+                return;
+            }
+            if constexpr (is_diff_leaf<T>())
+            {
+                if (!is_equal(a, b))
+                {
+                    write_change(a, b);
+                }
+            }
+            else if constexpr (is_std_pair<T>::value)
+            {
+                const std::size_t size = m_path.size();
+                m_path.append(".first");
+                compare(a.first, b.first);
+                m_path.resize(size);
+                m_path.append(".second");
+                compare(a.second, b.second);
+                m_path.resize(size);
+            }
+            else if constexpr (is_std_optional<T>::value)
+            {
+                if (a.has_value() && b.has_value())
+                {
+                    compare(*a, *b);
+                }
+                else if (a.has_value() != b.has_value())
+                {
+                    write_change(a, b);
+                }
+            }
+            else if constexpr (is_std_variant<T>::value)
+            {
+                if (a.index() == b.index() && !a.valueless_by_exception())
+                {
+                    compare_variant(a, b, std::make_index_sequence<std::variant_size_v<T>>());
+                }
+                else
+                {
+                    write_change(a, b);
+                }
+            }
+            else if constexpr (is_std_tuple<T>::value)
+            {
+                compare_tuple(a, b, std::make_index_sequence<std::tuple_size_v<T>>());
+            }
+            else if constexpr (is_ordered_container<T>::value || is_unordered_container<T>::value)
+            {
+                compare_associative(a, b);
+            }
+            else
+            {
+                compare_sequence(a, b);
+            }
+        }
+    private:
+        /**
+         * @struct DiffEdit
+         * @brief 编辑脚本中的一步
+         */
+        struct DiffEdit
+        {
+            /// @brief 是否为插入，否则为删除
+            bool is_insert;
+            /// @brief 编辑前在原序列中的位置
+            std::size_t a_index;
+            /// @brief 编辑前在新序列中的位置
+            std::size_t b_index;
+        };
+        /**
+         * @brief 判断类型是否按整体比较
+         * @tparam T 类型
+         * @return 不再展开成员或元素时为true
+         * @note 自定义输出的类型按整体比较，差异与其输出一致
+         */
+        template<class T>
+        static constexpr bool is_diff_leaf()
+        {
+            if constexpr (has_stringify_append<T>::value || has_member_to_string<T>::value ||
+                is_std_string_view<T>::value || is_basic_string<T>::value || is_c_string<T>::value ||
+                is_unicode_string<T>::value || is_unicode_c_string<T>::value || is_std_bitset<T>::value)
+            {
+                return true;
+            }
+            else
+            {
+                return !is_std_pair<T>::value && !is_std_optional<T>::value && !is_std_variant<T>::value &&
+                    !is_std_tuple<T>::value && !has_iterator<T>::value && !is_c_array<T>::value;
+            }
+        }
+        /**
+         * @brief 判断两个值是否相等
+         * @tparam T 类型
+         * @param a 原值
+         * @param b 新值
+         * @return 相等时为true
+         * @note 不支持operator==的类型比较渲染结果
+         */
+        template<class T>
+        bool is_equal(const T& a, const T& b) const
+        {
+            if constexpr (is_c_string<T>::value || is_unicode_c_string<T>::value)
+            {
+                // 空指针只与空指针相等，与渲染为<null>一致
+                using CharT = std::remove_cv_t<std::remove_pointer_t<std::decay_t<T>>>;
+                const CharT* a_text = a;
+                const CharT* b_text = b;
+                if (a_text == nullptr || b_text == nullptr)
+                {
+                    return a_text == b_text;
+                }
+                return std::basic_string_view<CharT>(a_text) == std::basic_string_view<CharT>(b_text);
+            }
+            else if constexpr (has_equal_to<T>::value)
+            {
+                return static_cast<bool>(a == b);
+            }
+            else
+            {
+                std::string a_text;
+                std::string b_text;
+                append_to_string(a_text, a, m_config);
+                append_to_string(b_text, b, m_config);
+                return a_text == b_text;
+            }
+        }
+        /**
+         * @brief 记录一处差异
+         * @return 已达数量上限时为false
+         */
+        bool count_difference()
+        {
+            if (m_difference_count >= m_options.max_difference_count)
+            {
+                if (!m_is_truncated)
+                {
+                    m_out.append(m_config.ellipsis_symbol);
+                    m_out.push_back('\n');
+                    m_is_truncated = true;
+                }
+                return false;
+            }
+            ++m_difference_count;
+            return true;
+        }
+        /**
+         * @brief 输出一行
+         * @tparam T 值类型
+         * @param marker 行首标记
+         * @param value 值
+         */
+        template<class T>
+        void write_line(char marker, const T& value)
+        {
+            m_out.push_back(marker);
+            m_out.push_back(' ');
+            m_out.append(m_path);
+            m_out.append(": ");
+            append_to_string(m_out, value, m_config);
+            m_out.push_back('\n');
+        }
+        /**
+         * @brief 输出修改
+         * @tparam T 值类型
+         * @param a 原值
+         * @param b 新值
+         */
+        template<class T>
+        void write_change(const T& a, const T& b)
+        {
+            if (!count_difference())
+            {
+                return;
+            }
+            m_out.append("~ ");
+            m_out.append(m_path);
+            m_out.append(": ");
+            append_to_string(m_out, a, m_config);
+            m_out.append(" -> ");
+            append_to_string(m_out, b, m_config);
+            m_out.push_back('\n');
+        }
+        /**
+         * @brief 输出删除或插入
+         * @tparam T 值类型
+         * @param marker -或+
+         * @param value 值
+         */
+        template<class T>
+        void write_edit(char marker, const T& value)
+        {
+            if (count_difference())
+            {
+                write_line(marker, value);
+            }
+        }
+        /**
+         * @brief 在路径末尾追加下标
+         * @param index 下标
+         */
+        void push_index(std::size_t index)
+        {
+            m_path.push_back('[');
+            append_integer(m_path, index);
+            m_path.push_back(']');
+        }
+        /**
+         * @brief 在路径末尾追加键
+         * @tparam Key 键类型
+         * @param key 键
+         */
+        template<class Key>
+        void push_key(const Key& key)
+        {
+            m_path.push_back('[');
+            append_to_string(m_path, key, m_config);
+            m_path.push_back(']');
+        }
+        /**
+         * @brief 比较variant的当前备选
+         * @tparam T variant类型
+         * @tparam Index 备选下标
+         * @param a 原值
+         * @param b 新值
+         */
+        template<class T, std::size_t... Index>
+        void compare_variant(const T& a, const T& b, std::index_sequence<Index...>)
+        {
+            ((a.index() == Index ? compare(std::get<Index>(a), std::get<Index>(b)) : void()), ...);
+        }
+        /**
+         * @brief 逐个比较tuple的成员，路径为.下标
+         * @tparam T tuple类型
+         * @tparam Index 成员下标
+         * @param a 原值
+         * @param b 新值
+         */
+        template<class T, std::size_t... Index>
+        void compare_tuple(const T& a, const T& b, std::index_sequence<Index...>)
+        {
+            const std::size_t size = m_path.size();
+            auto compare_element = [&](auto index, const auto& a_element, const auto& b_element)
+                {
+                    m_path.push_back('.');
+                    append_integer(m_path, static_cast<std::size_t>(index));
+                    compare(a_element, b_element);
+                    m_path.resize(size);
+                };
+            (compare_element(std::integral_constant<std::size_t, Index>(), std::get<Index>(a), std::get<Index>(b)), ...);
+        }
+        /**
+         * @brief 输出关联容器中只存在于一侧的元素
+         * @tparam T 容器类型
+         * @param marker -或+
+         * @param element 元素
+         */
+        template<class T>
+        void write_associative_edit(char marker, const typename T::value_type& element)
+        {
+            if constexpr (has_mapped_type<T>::value)
+            {
+                const std::size_t size = m_path.size();
+                push_key(element.first);
+                write_edit(marker, element.second);
+                m_path.resize(size);
+            }
+            else
+            {
+                write_edit(marker, element);
+            }
+        }
+        /**
+         * @brief 比较关联容器中键相同的两个元素
+         * @tparam T 容器类型
+         * @param a 原元素
+         * @param b 新元素
+         */
+        template<class T>
+        void compare_associative_element(const typename T::value_type& a, const typename T::value_type& b)
+        {
+            if constexpr (has_mapped_type<T>::value)
+            {
+                const std::size_t size = m_path.size();
+                push_key(a.first);
+                compare(a.second, b.second);
+                m_path.resize(size);
+            }
+        }
+        /**
+         * @brief 按键比较关联容器
+         * @tparam T 容器类型
+         * @param a 原容器
+         * @param b 新容器
+         * @note 有序容器按键合并遍历；无序容器按键查找，重复键只与首个匹配元素比较
+         */
+        template<class T>
+        void compare_associative(const T& a, const T& b)
+        {
+            if constexpr (is_ordered_container<T>::value)
+            {
+                const auto key_compare = a.key_comp();
+                auto a_current = a.begin();
+                auto b_current = b.begin();
+                while (a_current != a.end() && b_current != b.end() && !m_is_truncated)
+                {
+                    const auto& a_key = get_unordered_key<T>(*a_current);
+                    const auto& b_key = get_unordered_key<T>(*b_current);
+                    if (key_compare(a_key, b_key))
+                    {
+                        write_associative_edit<T>('-', *a_current++);
+                    }
+                    else if (key_compare(b_key, a_key))
+                    {
+                        write_associative_edit<T>('+', *b_current++);
+                    }
+                    else
+                    {
+                        compare_associative_element<T>(*a_current++, *b_current++);
+                    }
+                }
+                for (; a_current != a.end() && !m_is_truncated; ++a_current)
+                {
+                    write_associative_edit<T>('-', *a_current);
+                }
+                for (; b_current != b.end() && !m_is_truncated; ++b_current)
+                {
+                    write_associative_edit<T>('+', *b_current);
+                }
+            }
+            else
+            {
+                for (auto current = a.begin(); current != a.end() && !m_is_truncated; ++current)
+                {
+                    const auto found = b.find(get_unordered_key<T>(*current));
+                    if (found == b.end())
+                    {
+                        write_associative_edit<T>('-', *current);
+                    }
+                    else
+                    {
+                        compare_associative_element<T>(*current, *found);
+                    }
+                }
+                for (auto current = b.begin(); current != b.end() && !m_is_truncated; ++current)
+                {
+                    if (a.find(get_unordered_key<T>(*current)) == a.end())
+                    {
+                        write_associative_edit<T>('+', *current);
+                    }
+                }
+            }
+        }
+        /**
+         * @brief 按下标逐个比较序列
+         * @tparam IteratorA 原序列迭代器类型
+         * @tparam SentinelA 原序列结束标记类型
+         * @tparam IteratorB 新序列迭代器类型
+         * @tparam SentinelB 新序列结束标记类型
+         * @param a_current 原序列起始位置
+         * @param a_last 原序列结束位置
+         * @param b_current 新序列起始位置
+         * @param b_last 新序列结束位置
+         * @param index 起始下标
+         */
+        template<class IteratorA, class SentinelA, class IteratorB, class SentinelB>
+        void compare_by_index(IteratorA a_current, SentinelA a_last, IteratorB b_current, SentinelB b_last,
+            std::size_t index)
+        {
+            const std::size_t size = m_path.size();
+            for (; a_current != a_last && b_current != b_last && !m_is_truncated; ++a_current, ++b_current, ++index)
+            {
+                if (!is_equal(*a_current, *b_current))
+                {
+                    push_index(index);
+                    compare(*a_current, *b_current);
+                    m_path.resize(size);
+                }
+            }
+            std::size_t b_index = index;
+            for (; a_current != a_last && !m_is_truncated; ++a_current, ++index)
+            {
+                push_index(index);
+                write_edit('-', *a_current);
+                m_path.resize(size);
+            }
+            for (; b_current != b_last && !m_is_truncated; ++b_current, ++b_index)
+            {
+                push_index(b_index);
+                write_edit('+', *b_current);
+                m_path.resize(size);
+            }
+        }
+        /**
+         * @brief 以Myers算法求两段序列的最短编辑脚本
+         * @tparam Iterator 随机访问迭代器类型
+         * @param a 原序列起始位置
+         * @param a_count 原序列长度
+         * @param b 新序列起始位置
+         * @param b_count 新序列长度
+         * @param edits 编辑脚本，按位置升序
+         * @return 编辑距离不超过max_edit_distance时为true
+         * @note 耗时O((N + M) * D)，保存的中间状态为O(D^2)
+         */
+        template<class Iterator>
+        bool find_shortest_edit(Iterator a, std::size_t a_count, Iterator b, std::size_t b_count,
+            std::vector<DiffEdit>& edits) const
+        {
+            const auto n = static_cast<std::ptrdiff_t>(a_count);
+            const auto m = static_cast<std::ptrdiff_t>(b_count);
+            const std::ptrdiff_t max_distance = std::min<std::ptrdiff_t>(n + m,
+                static_cast<std::ptrdiff_t>(m_options.max_edit_distance));
+            const std::ptrdiff_t offset = max_distance + 1;
+            // v[offset + k]为对角线k上已到达的最远x
+            std::vector<std::ptrdiff_t> v(static_cast<std::size_t>(2 * max_distance + 3), 0);
+            // trace[d][k + d]为第d步结束时对角线k上的最远x
+            std::vector<std::vector<std::ptrdiff_t>> trace;
+            for (std::ptrdiff_t d = 0; d <= max_distance; ++d)
+            {
+                bool is_found = false;
+                for (std::ptrdiff_t k = -d; k <= d; k += 2)
+                {
+                    std::ptrdiff_t x = k == -d || (k != d && v[offset + k - 1] < v[offset + k + 1]) ?
+                        v[offset + k + 1] : v[offset + k - 1] + 1;
+                    std::ptrdiff_t y = x - k;
+                    while (x < n && y < m && is_equal(a[x], b[y]))
+                    {
+                        ++x;
+                        ++y;
+                    }
+                    v[offset + k] = x;
+                    if (x >= n && y >= m)
+                    {
+                        is_found = true;
+                        break;
+                    }
+                }
+                trace.emplace_back(v.begin() + (offset - d), v.begin() + (offset + d + 1));
+                if (!is_found)
+                {
+                    continue;
+                }
+                // 自终点回溯每一步的来源
+                std::ptrdiff_t x = n;
+                std::ptrdiff_t y = m;
+                for (std::ptrdiff_t step = d; step > 0; --step)
+                {
+                    const std::vector<std::ptrdiff_t>& previous = trace[static_cast<std::size_t>(step - 1)];
+                    const std::ptrdiff_t k = x - y;
+                    const bool is_insert = k == -step ||
+                        (k != step && previous[k - 1 + step - 1] < previous[k + 1 + step - 1]);
+                    const std::ptrdiff_t previous_k = is_insert ? k + 1 : k - 1;
+                    x = previous[previous_k + step - 1];
+                    y = x - previous_k;
+                    edits.push_back({ is_insert, static_cast<std::size_t>(x), static_cast<std::size_t>(y) });
+                }
+                std::reverse(edits.begin(), edits.end());
+                return true;
+            }
+            return false;
+        }
+        /**
+         * @brief 输出序列中的相同元素作为上下文
+         * @tparam Iterator 随机访问迭代器类型
+         * @param a 原序列起始位置
+         * @param first 起始下标
+         * @param last 结束下标
+         */
+        template<class Iterator>
+        void write_context(Iterator a, std::size_t first, std::size_t last)
+        {
+            const std::size_t size = m_path.size();
+            for (std::size_t i = first; i < last && !m_is_truncated; ++i)
+            {
+                push_index(i);
+                write_line(' ', a[static_cast<std::ptrdiff_t>(i)]);
+                m_path.resize(size);
+            }
+        }
+        /**
+         * @brief 比较序列
+         * @tparam T 序列类型
+         * @param a 原序列
+         * @param b 新序列
+         * @note 随机访问序列先去掉相同的首尾，再按最短编辑脚本输出插入、删除与修改；
+         *       其余序列按下标逐个比较
+         */
+        template<class T>
+        void compare_sequence(const T& a, const T& b)
+        {
+            using Iterator = decltype(std::begin(a));
+            if constexpr (std::random_access_iterator<Iterator>)
+            {
+                const Iterator a_first = std::begin(a);
+                const Iterator b_first = std::begin(b);
+                const auto a_count = static_cast<std::size_t>(std::end(a) - a_first);
+                const auto b_count = static_cast<std::size_t>(std::end(b) - b_first);
+                const std::size_t min_count = a_count < b_count ? a_count : b_count;
+                std::size_t prefix = 0;
+                while (prefix < min_count && is_equal(a_first[prefix], b_first[prefix]))
+                {
+                    ++prefix;
+                }
+                std::size_t suffix = 0;
+                while (suffix < min_count - prefix &&
+                    is_equal(a_first[a_count - 1 - suffix], b_first[b_count - 1 - suffix]))
+                {
+                    ++suffix;
+                }
+                if (prefix == a_count && prefix == b_count)
+                {
+                    return;
+                }
+                std::vector<DiffEdit> edits;
+                if (!find_shortest_edit(a_first + prefix, a_count - prefix - suffix,
+                    b_first + prefix, b_count - prefix - suffix, edits))
+                {
+                    compare_by_index(a_first + prefix, a_first + (a_count - suffix),
+                        b_first + prefix, b_first + (b_count - suffix), prefix);
+                    return;
+                }
+                write_edits(a_first, a_count, b_first, edits, prefix);
+            }
+            else
+            {
+                compare_by_index(std::begin(a), std::end(a), std::begin(b), std::end(b), 0);
+            }
+        }
+        /**
+         * @brief 按编辑脚本输出差异与上下文
+         * @tparam Iterator 随机访问迭代器类型
+         * @param a_first 原序列起始位置
+         * @param a_count 原序列长度
+         * @param b_first 新序列起始位置
+         * @param edits 编辑脚本，位置相对于去掉相同开头后的序列
+         * @param prefix 相同开头的长度
+         * @note 相邻的删除与插入两两配对为修改，按原序列下标展开比较
+         */
+        template<class Iterator>
+        void write_edits(Iterator a_first, std::size_t a_count, Iterator b_first,
+            const std::vector<DiffEdit>& edits, std::size_t prefix)
+        {
+            const std::size_t size = m_path.size();
+            const std::size_t context_count = m_options.context_count;
+            std::vector<std::size_t> deletes;
+            std::vector<std::size_t> inserts;
+            std::size_t context_end = 0;
+            for (std::size_t i = 0; i < edits.size() && !m_is_truncated;)
+            {
+                // 连续的编辑组成一段
+                const std::size_t a_begin = edits[i].a_index + prefix;
+                std::size_t a_index = a_begin;
+                std::size_t b_index = edits[i].b_index + prefix;
+                deletes.clear();
+                inserts.clear();
+                while (i < edits.size() && edits[i].a_index + prefix == a_index && edits[i].b_index + prefix == b_index)
+                {
+                    if (edits[i].is_insert)
+                    {
+                        inserts.push_back(b_index++);
+                    }
+                    else
+                    {
+                        deletes.push_back(a_index++);
+                    }
+                    ++i;
+                }
+                const std::size_t context_begin = a_begin - std::min(a_begin - context_end, context_count);
+                write_context(a_first, context_begin, a_begin);
+                const std::size_t pair_count = std::min(deletes.size(), inserts.size());
+                for (std::size_t j = 0; j < pair_count && !m_is_truncated; ++j)
+                {
+                    push_index(deletes[j]);
+                    compare(a_first[static_cast<std::ptrdiff_t>(deletes[j])],
+                        b_first[static_cast<std::ptrdiff_t>(inserts[j])]);
+                    m_path.resize(size);
+                }
+                for (std::size_t j = pair_count; j < deletes.size() && !m_is_truncated; ++j)
+                {
+                    push_index(deletes[j]);
+                    write_edit('-', a_first[static_cast<std::ptrdiff_t>(deletes[j])]);
+                    m_path.resize(size);
+                }
+                for (std::size_t j = pair_count; j < inserts.size() && !m_is_truncated; ++j)
+                {
+                    push_index(inserts[j]);
+                    write_edit('+', b_first[static_cast<std::ptrdiff_t>(inserts[j])]);
+                    m_path.resize(size);
+                }
+                const std::size_t next_begin = i < edits.size() ? edits[i].a_index + prefix : a_count;
+                context_end = std::min(a_index + context_count, next_begin);
+                write_context(a_first, a_index, context_end);
+            }
+        }
+        /// @brief 输出
+        std::string& m_out;
+        /// @brief 选项
+        const StringifyDiffOptions& m_options;
+        /// @brief 配置
+        const StringifyConfig& m_config;
+        /// @brief 当前路径
+        std::string m_path;
+        /// @brief 已报告的差异数量
+        std::size_t m_difference_count = 0;
+        /// @brief 是否因数量上限而停止
+        bool m_is_truncated = false;
+    };
+    /**
+     * @brief 比较两个值并输出差异
+     * @tparam T 类型
+     * @param a 原值
+     * @param b 新值
+     * @param options 选项
+     * @param config 配置
+     * @return 每行一处差异，相同时为空字符串
+     */
+    template<class T>
+    std::string stringify_diff(const T& a, const T& b, const StringifyDiffOptions& options,
+        const StringifyConfig& config)
+    {
+        std::string result;
+        StringifyDiffer differ(result, options, config);
+        differ.compare(a, b);
+        return result;
+    }
+    /**
+     * @brief 使用全局配置比较两个值并输出差异
+     * @tparam T 类型
+     * @param a 原值
+     * @param b 新值
+     * @param options 选项
+     * @return 每行一处差异，相同时为空字符串
+     */
+    template<class T>
+    std::string stringify_diff(const T& a, const T& b, const StringifyDiffOptions& options = StringifyDiffOptions())
+    {
+        return stringify_diff(a, b, options, *StringifyConfigManager::get_config_snapshot());
+    }
+}
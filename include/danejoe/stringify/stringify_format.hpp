@@ -10,8 +10,12 @@
 #include <cstdint>
 #include <string>
 #include <vector>
+#include <charconv>
+#include <string_view>
+#include <memory_resource>
 
 #include "danejoe/stringify/stringify_config.hpp"
+#include "danejoe/stringify/stringify_append.hpp"
 
  /**
   * @namespace DaneJoe
@@ -34,6 +38,12 @@ namespace DaneJoe
         /// @brief 未知位置
         Unknown
     };
+    /**
+     * @brief 获取格式化位置枚举名（调试用）
+     * @param position 格式化位置
+     * @return 对应的枚举名，指向字符串字面量
+     */
+    std::string_view get_format_position_name(FormatPosition position) noexcept;
     /**
      * @brief 将格式化位置转换为字符串（调试用）
      * @param position 格式化位置
@@ -90,6 +100,56 @@ namespace DaneJoe
      * @return 存储单位符号
      */
     std::string get_storage_unit_symbol(StorageUnit unit);
+    /**
+     * @brief 从指定符号集中获取存储单位符号
+     * @param symbol 存储单位符号集
+     * @param unit 存储单位
+     * @return 存储单位符号的引用，未知单位返回空字符串
+     */
+    const std::string& get_storage_unit_symbol(const StorageSymbol& symbol, StorageUnit unit) noexcept;
+    /**
+     * @brief 获取适合显示容量大小的单位
+     * @param size 容量大小(Bytes)
+     * @param config 配置，使用storage_units
+     * @return 使数值不小于1的最大单位
+     */
+    StorageUnit get_capacity_unit(uint64_t size, const StringifyConfig& config) noexcept;
+    /**
+     * @brief 追加格式化后的容量大小
+     * @tparam Out 输出类型
+     * @param out 输出缓冲
+     * @param size 容量大小(Bytes)
+     * @param dest_unit 目标单位
+     * @param precision 精度
+     * @param config 配置
+     */
+    template<class Out>
+    void append_capacity_size(
+        Out& out,
+        uint64_t size,
+        StorageUnit dest_unit,
+        std::size_t precision,
+        const StringifyConfig& config)
+    {
+        DANEJOE_STRINGIFY_STATS_SCOPE(StringifyBranch::CapacitySize, out);
+        int exponent = static_cast<int>(dest_unit);
+        if (exponent <= 0)
+        {
+            append_integer(out, size);
+        }
+        else
+        {
+            uint64_t cardinal_number = 1;
+            for (int i = 0; i < exponent; ++i)
+            {
+                cardinal_number *= config.storage_units;
+            }
+            double value = size / (double)cardinal_number;
+            append_floating(out, value, std::chars_format::fixed, static_cast<int>(precision));
+        }
+        append_text(out, config.storage_symbol.space_maker);
+        append_text(out, get_storage_unit_symbol(config.storage_symbol, dest_unit));
+    }
     /**
      * @brief 格式化容量大小
      * @param size 容量大小(Bytes)
@@ -101,4 +161,29 @@ namespace DaneJoe
         uint64_t size,
         StorageUnit dest_unit,
         std::size_t precision = 0);
+    /**
+     * @brief 格式化容量大小到指定内存资源
+     * @param size 容量大小(Bytes)
+     * @param dest_unit 目标单位
+     * @param precision 精度
+     * @param resource 内存资源
+     * @return 格式化后的容量大小，由resource分配
+     */
+    std::pmr::string format_capacity_size(
+        uint64_t size,
+        StorageUnit dest_unit,
+        std::size_t precision,
+        std::pmr::memory_resource* resource);
+    /**
+     * @brief 格式化位置的追加重载，与DaneJoe::to_string(FormatPosition)输出一致
+     * @tparam Out 输出类型
+     * @param out 输出缓冲
+     * @param position 格式化位置
+     * @note 输出不受配置影响，配置参数仅为与通用分发的签名一致
+     */
+    template<class Out>
+    void append_to_string(Out& out, FormatPosition position, const StringifyConfig&)
+    {
+        append_text(out, get_format_position_name(position));
+    }
 }
@@ -0,0 +1,286 @@
+/**
+ * @file stringify_generator.hpp
+ * @brief 协程式分块字符串化
+ * @author DaneJoe001
+ * @version 0.2.0
+ * @date 2026-10-18
+ * @details 基于StringifyTraversal的分段执行，每次恢复只渲染约一个块的输出并交出，
+ *          调用者可在块之间处理其他I/O，从而限制单次占用线程的时间。
+ */
+#pragma once
+
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+
+#include <memory>
+#include <string>
+#include <cstddef>
+#include <utility>
+#include <iterator>
+#include <coroutine>
+#include <exception>
+#include <algorithm>
+#include <string_view>
+
+#include "danejoe/stringify/stringify_config.hpp"
+#include "danejoe/stringify/stringify_traversal.hpp"
+
+/// @brief 编译器是否支持协程，即stringify_chunks是否可用
+#define DANEJOE_STRINGIFY_HAS_GENERATOR 1
+
+ /**
+  * @namespace DaneJoe
+  * @brief DaneJoe 命名空间
+  */
+namespace DaneJoe
+{
+    /**
+     * @class StringifyChunkGenerator
+     * @brief 按块产生输出的协程生成器
+     * @note 产生的std::string_view在下一次推进前有效；仅可移动
+     */
+    class StringifyChunkGenerator
+    {
+    public:
+        /**
+         * @struct promise_type
+         * @brief 协程承诺对象
+         */
+        struct promise_type
+        {
+            /// @brief 当前块
+            std::string_view chunk;
+            /// @brief 协程内抛出的异常
+            std::exception_ptr exception;
+            StringifyChunkGenerator get_return_object()
+            {
+                return StringifyChunkGenerator(std::coroutine_handle<promise_type>::from_promise(*this));
+            }
+            std::suspend_always initial_suspend() noexcept
+            {
+                return {};
+            }
+            std::suspend_always final_suspend() noexcept
+            {
+                return {};
+            }
+            std::suspend_always yield_value(std::string_view value) noexcept
+            {
+                chunk = value;
+                return {};
+            }
+            void return_void() noexcept {}
+            void unhandled_exception() noexcept
+            {
+                exception = std::current_exception();
+            }
+        };
+        /**
+         * @class Iterator
+         * @brief 输入迭代器，推进时恢复协程
+         */
+        class Iterator
+        {
+        public:
+            using iterator_category = std::input_iterator_tag;
+            using value_type = std::string_view;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const std::string_view*;
+            using reference = const std::string_view&;
+            Iterator() = default;
+            /**
+             * @brief 构造函数
+             * @param handle 协程句柄
+             */
+            explicit Iterator(std::coroutine_handle<promise_type> handle) : m_handle(handle) {}
+            reference operator*() const
+            {
+                return m_handle.promise().chunk;
+            }
+            pointer operator->() const
+            {
+                return &m_handle.promise().chunk;
+            }
+            Iterator& operator++()
+            {
+                resume(m_handle);
+                return *this;
+            }
+            void operator++(int)
+            {
+                ++*this;
+            }
+            friend bool operator==(const Iterator& iterator, std::default_sentinel_t)
+            {
+                return !iterator.m_handle || iterator.m_handle.done();
+            }
+        private:
+            /// @brief 协程句柄
+            std::coroutine_handle<promise_type> m_handle = nullptr;
+        };
+        /**
+         * @brief 构造函数
+         * @param handle 协程句柄
+         */
+        explicit StringifyChunkGenerator(std::coroutine_handle<promise_type> handle) : m_handle(handle) {}
+        StringifyChunkGenerator(StringifyChunkGenerator&& other) noexcept
+            : m_handle(std::exchange(other.m_handle, nullptr))
+        {}
+        StringifyChunkGenerator& operator=(StringifyChunkGenerator&& other) noexcept
+        {
+            if (this != &other)
+            {
+                if (m_handle)
+                {
+                    m_handle.destroy();
+                }
+                m_handle = std::exchange(other.m_handle, nullptr);
+            }
+            return *this;
+        }
+        StringifyChunkGenerator(const StringifyChunkGenerator&) = delete;
+        StringifyChunkGenerator& operator=(const StringifyChunkGenerator&) = delete;
+        /**
+         * @brief 析构函数，未完成的遍历随协程帧一同释放
+         */
+        ~StringifyChunkGenerator()
+        {
+            if (m_handle)
+            {
+                m_handle.destroy();
+            }
+        }
+        /**
+         * @brief 开始遍历，渲染第一个块
+         * @return 指向第一个块的迭代器
+         * @note 只能调用一次
+         */
+        Iterator begin()
+        {
+            resume(m_handle);
+            return Iterator(m_handle);
+        }
+        /**
+         * @brief 结束哨兵
+         * @return 默认哨兵
+         */
+        std::default_sentinel_t end() const noexcept
+        {
+            return std::default_sentinel;
+        }
+        /**
+         * @brief 渲染下一个块
+         * @return 是否产生了新块，遍历完成后返回false
+         * @note 供事件循环在每个时间片中调用，块通过get_chunk获取；不与begin混用
+         */
+        bool next()
+        {
+            if (!m_handle || m_handle.done())
+            {
+                return false;
+            }
+            resume(m_handle);
+            return !m_handle.done();
+        }
+        /**
+         * @brief 获取当前块
+         * @return 当前块，在下一次推进前有效
+         */
+        std::string_view get_chunk() const
+        {
+            return m_handle.promise().chunk;
+        }
+    private:
+        /**
+         * @brief 恢复协程并重新抛出其中的异常
+         * @param handle 协程句柄
+         */
+        static void resume(std::coroutine_handle<promise_type> handle)
+        {
+            handle.resume();
+            if (handle.promise().exception)
+            {
+                std::rethrow_exception(std::exchange(handle.promise().exception, nullptr));
+            }
+        }
+    private:
+        /// @brief 协程句柄
+        std::coroutine_handle<promise_type> m_handle;
+    };
+    /**
+     * @brief 按块字符串化的协程体
+     * @tparam T 类型
+     * @param value 对象，须在生成器使用期间保持有效且不被修改
+     * @param chunk_size 块大小
+     * @param config 配置，由协程帧持有
+     * @return 生成器；除最后一块外每块恰为chunk_size字节
+     */
+    template<class T>
+    StringifyChunkGenerator generate_stringify_chunks(const T& value, std::size_t chunk_size,
+        std::shared_ptr<const StringifyConfig> config)
+    {
+        chunk_size = std::max<std::size_t>(chunk_size, 1);
+        StringifyTraversal<std::string> traversal(value, *config);
+        std::string buffer;
+        buffer.reserve(chunk_size);
+        bool is_done = false;
+        while (true)
+        {
+            // 单个叶子值可能超出预算，超出部分在后续块中交出
+            while (!is_done && buffer.size() < chunk_size)
+            {
+                is_done = traversal.run(buffer, chunk_size - buffer.size());
+            }
+            std::size_t offset = 0;
+            for (; buffer.size() - offset >= chunk_size; offset += chunk_size)
+            {
+                co_yield std::string_view(buffer.data() + offset, chunk_size);
+            }
+            if (is_done)
+            {
+                if (offset < buffer.size())
+                {
+                    co_yield std::string_view(buffer.data() + offset, buffer.size() - offset);
+                }
+                co_return;
+            }
+            buffer.erase(0, offset);
+        }
+    }
+    /**
+     * @brief 按块字符串化
+     * @tparam T 类型
+     * @param value 对象，须在生成器使用期间保持有效且不被修改
+     * @param chunk_size 块大小
+     * @param config 配置，复制到协程帧中
+     * @return 生成器，输出拼接后与to_string_iterative一致
+     */
+    template<class T>
+    StringifyChunkGenerator stringify_chunks(const T& value, std::size_t chunk_size, const StringifyConfig& config)
+    {
+        return generate_stringify_chunks(value, chunk_size, std::make_shared<const StringifyConfig>(config));
+    }
+    /**
+     * @brief 使用全局配置快照按块字符串化
+     * @tparam T 类型
+     * @param value 对象，须在生成器使用期间保持有效且不被修改
+     * @param chunk_size 块大小
+     * @return 生成器
+     */
+    template<class T>
+    StringifyChunkGenerator stringify_chunks(const T& value, std::size_t chunk_size = 64 * 1024)
+    {
+        return generate_stringify_chunks(value, chunk_size, StringifyConfigManager::get_config_snapshot());
+    }
+    /**
+     * @brief 禁止对临时对象按块字符串化，协程帧只保存引用，首次取块时临时对象已销毁
+     */
+    template<class T>
+    StringifyChunkGenerator stringify_chunks(const T&& value, std::size_t chunk_size, const StringifyConfig& config) = delete;
+    /**
+     * @brief 禁止对临时对象按块字符串化
+     */
+    template<class T>
+    StringifyChunkGenerator stringify_chunks(const T&& value, std::size_t chunk_size = 64 * 1024) = delete;
+}
+
+#endif
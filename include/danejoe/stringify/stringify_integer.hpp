@@ -0,0 +1,380 @@
+/**
+ * @file stringify_integer.hpp
+ * @brief 整数的进制、补零与分组输出
+ * @author DaneJoe001
+ * @version 0.2.0
+ * @date 2026-10-18
+ * @details 数字由查找表按组从低位向高位写入栈缓冲：十进制每次两位，十六进制每次一字节，
+ *          八进制每次六位，二进制每次四位，再一次性追加到输出。
+ *          128位整数的十进制输出先按10^19拆段，每段用64位除法处理。
+ */
+#pragma once
+
+#include <string>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+
+#include "danejoe/stringify/stringify_config.hpp"
+#include "danejoe/stringify/stringify_traits.hpp"
+
+ /**
+  * @namespace DaneJoe
+  * @brief DaneJoe 命名空间
+  */
+namespace DaneJoe
+{
+    /**
+     * @struct IntegerDigitTable
+     * @brief 整数数字查找表
+     */
+    struct IntegerDigitTable
+    {
+        /// @brief 00-99的十进制两位数字
+        char decimal_pairs[200];
+        /// @brief 00-ff的十六进制两位数字
+        char hexadecimal_pairs[512];
+        /// @brief 00-77的八进制两位数字
+        char octal_pairs[128];
+        /// @brief 0000-1111的二进制四位数字
+        char binary_nibbles[64];
+    };
+    /**
+     * @brief 生成整数数字查找表
+     * @return 查找表
+     */
+    constexpr IntegerDigitTable make_integer_digit_table()
+    {
+        constexpr char digits[] = "0123456789abcdef";
+        IntegerDigitTable table{};
+        for (int i = 0; i < 100; ++i)
+        {
+            table.decimal_pairs[i * 2] = digits[i / 10];
+            table.decimal_pairs[i * 2 + 1] = digits[i % 10];
+        }
+        for (int i = 0; i < 256; ++i)
+        {
+            table.hexadecimal_pairs[i * 2] = digits[i >> 4];
+            table.hexadecimal_pairs[i * 2 + 1] = digits[i & 0xF];
+        }
+        for (int i = 0; i < 64; ++i)
+        {
+            table.octal_pairs[i * 2] = digits[i >> 3];
+            table.octal_pairs[i * 2 + 1] = digits[i & 0x7];
+        }
+        for (int i = 0; i < 16; ++i)
+        {
+            for (int bit = 0; bit < 4; ++bit)
+            {
+                table.binary_nibbles[i * 4 + bit] = digits[(i >> (3 - bit)) & 1];
+            }
+        }
+        return table;
+    }
+    /// @brief 整数数字查找表
+    inline constexpr IntegerDigitTable integer_digit_table = make_integer_digit_table();
+    /**
+     * @brief 整数类型是否有符号
+     * @tparam T 整数类型
+     * @note 严格标准模式下std::is_signed不包含__int128
+     */
+    template<class T>
+    inline constexpr bool is_signed_integer_v = static_cast<T>(-1) < static_cast<T>(0);
+    /**
+     * @brief 整数是否为负
+     * @tparam T 整数类型
+     * @param value 整数
+     * @return 为负时为true
+     */
+    template<class T>
+    constexpr bool is_negative_integer(T value)
+    {
+        if constexpr (is_signed_integer_v<T>)
+        {
+            return value < 0;
+        }
+        else
+        {
+            return false;
+        }
+    }
+    /**
+     * @brief 取整数的绝对值
+     * @tparam T 整数类型
+     * @param value 整数
+     * @return 对应无符号类型的绝对值，最小负数也可表示
+     */
+    template<class T>
+    constexpr typename make_unsigned_integer<T>::type get_integer_magnitude(T value)
+    {
+        using U = typename make_unsigned_integer<T>::type;
+        return is_negative_integer(value) ? static_cast<U>(U(0) - static_cast<U>(value)) : static_cast<U>(value);
+    }
+    /**
+     * @brief 取进制的基数
+     * @param base 进制
+     * @return 基数
+     */
+    constexpr unsigned get_integer_radix(IntegerBase base)
+    {
+        switch (base)
+        {
+        case IntegerBase::Binary:
+            return 2;
+        case IntegerBase::Octal:
+            return 8;
+        case IntegerBase::Hexadecimal:
+            return 16;
+        case IntegerBase::Decimal:
+        default:
+            return 10;
+        }
+    }
+    /**
+     * @brief 取进制前缀
+     * @param base 进制
+     * @return 前缀，十进制为空
+     */
+    constexpr std::string_view get_integer_prefix(IntegerBase base)
+    {
+        switch (base)
+        {
+        case IntegerBase::Binary:
+            return "0b";
+        case IntegerBase::Octal:
+            return "0";
+        case IntegerBase::Hexadecimal:
+            return "0x";
+        case IntegerBase::Decimal:
+        default:
+            return {};
+        }
+    }
+    /**
+     * @brief 从后向前写入十进制数字
+     * @tparam U 无符号整数类型
+     * @param end 写入结束位置
+     * @param value 数值
+     * @return 写入的起始位置
+     * @note 调用方须保证end之前有足够空间
+     */
+    template<class U>
+    char* write_decimal_backward(char* end, U value)
+    {
+        if constexpr (sizeof(U) > sizeof(uint64_t))
+        {
+            // 高位段按10^19拆分，每段固定19位
+            constexpr uint64_t chunk_divisor = 10000000000000000000ull;
+            constexpr std::size_t chunk_digits = 19;
+            while (value > static_cast<U>(UINT64_MAX))
+            {
+                const U quotient = value / chunk_divisor;
+                const auto chunk = static_cast<uint64_t>(value - quotient * chunk_divisor);
+                value = quotient;
+                char* chunk_begin = write_decimal_backward(end, chunk);
+                end -= chunk_digits;
+                std::memset(end, '0', static_cast<std::size_t>(chunk_begin - end));
+            }
+            return write_decimal_backward(end, static_cast<uint64_t>(value));
+        }
+        else
+        {
+            const char* pairs = integer_digit_table.decimal_pairs;
+            while (value >= 100)
+            {
+                const auto index = static_cast<std::size_t>(value % 100) * 2;
+                value /= 100;
+                end -= 2;
+                std::memcpy(end, pairs + index, 2);
+            }
+            if (value >= 10)
+            {
+                end -= 2;
+                std::memcpy(end, pairs + static_cast<std::size_t>(value) * 2, 2);
+            }
+            else
+            {
+                *--end = static_cast<char>('0' + value);
+            }
+            return end;
+        }
+    }
+    /**
+     * @brief 从后向前写入指定进制的数字
+     * @tparam U 无符号整数类型
+     * @param end 写入结束位置
+     * @param value 数值
+     * @param base 进制
+     * @return 写入的起始位置
+     * @note 调用方须保证end之前至少有sizeof(U) * 8字节
+     */
+    template<class U>
+    char* write_integer_backward(char* end, U value, IntegerBase base)
+    {
+        switch (base)
+        {
+        case IntegerBase::Hexadecimal:
+        {
+            const char* pairs = integer_digit_table.hexadecimal_pairs;
+            while (value >= 0x100)
+            {
+                end -= 2;
+                std::memcpy(end, pairs + static_cast<std::size_t>(value & 0xFF) * 2, 2);
+                value >>= 8;
+            }
+            if (value >= 0x10)
+            {
+                end -= 2;
+                std::memcpy(end, pairs + static_cast<std::size_t>(value) * 2, 2);
+            }
+            else
+            {
+                *--end = pairs[static_cast<std::size_t>(value) * 2 + 1];
+            }
+            return end;
+        }
+        case IntegerBase::Octal:
+        {
+            const char* pairs = integer_digit_table.octal_pairs;
+            while (value >= 0100)
+            {
+                end -= 2;
+                std::memcpy(end, pairs + static_cast<std::size_t>(value & 077) * 2, 2);
+                value >>= 6;
+            }
+            if (value >= 010)
+            {
+                end -= 2;
+                std::memcpy(end, pairs + static_cast<std::size_t>(value) * 2, 2);
+            }
+            else
+            {
+                *--end = static_cast<char>('0' + static_cast<unsigned>(value));
+            }
+            return end;
+        }
+        case IntegerBase::Binary:
+        {
+            const char* nibbles = integer_digit_table.binary_nibbles;
+            while (value >= 0x10)
+            {
+                end -= 4;
+                std::memcpy(end, nibbles + static_cast<std::size_t>(value & 0xF) * 4, 4);
+                value >>= 4;
+            }
+            do
+            {
+                *--end = static_cast<char>('0' + static_cast<unsigned>(value & 1));
+                value >>= 1;
+            } while (value != 0);
+            return end;
+        }
+        case IntegerBase::Decimal:
+        default:
+            return write_decimal_backward(end, value);
+        }
+    }
+    /**
+     * @brief 追加n个字符'0'
+     * @tparam Out 输出类型
+     * @param out 输出缓冲
+     * @param count 个数
+     */
+    template<class Out>
+    void append_zeros(Out& out, std::size_t count)
+    {
+        constexpr std::string_view zeros = "00000000000000000000000000000000";
+        while (count > zeros.size())
+        {
+            out.append(zeros.data(), zeros.size());
+            count -= zeros.size();
+        }
+        out.append(zeros.data(), count);
+    }
+    /**
+     * @brief 追加十进制整数
+     * @tparam Out 输出类型
+     * @tparam T 整数类型
+     * @param out 输出缓冲
+     * @param value 整数
+     * @note 与std::to_string一致
+     */
+    template<class Out, class T, std::enable_if_t<
+        is_integer_value<T>::value, int> = 0>
+    void append_integer(Out& out, T value)
+    {
+        // 128位最多39位数字，另加符号
+        char buffer[sizeof(T) * 3 + 2];
+        char* end = buffer + sizeof(buffer);
+        char* begin = write_decimal_backward(end, get_integer_magnitude(value));
+        if (is_negative_integer(value))
+        {
+            *--begin = '-';
+        }
+        out.append(begin, static_cast<std::size_t>(end - begin));
+    }
+    /**
+     * @brief 按配置追加整数
+     * @tparam Out 输出类型
+     * @tparam T 整数类型
+     * @param out 输出缓冲
+     * @param value 整数
+     * @param config 配置，使用integer_base、is_show_integer_prefix、integer_width与分组选项
+     * @note 分组从最低位开始，补齐的0参与分组；负数为符号加前缀加绝对值
+     */
+    template<class Out, class T, std::enable_if_t<
+        is_integer_value<T>::value, int> = 0>
+    void append_integer(Out& out, T value, const StringifyConfig& config)
+    {
+        const std::size_t group_size = config.integer_group_symbol.empty() ? 0 : config.integer_group_size;
+        if (config.integer_base == IntegerBase::Decimal && config.integer_width == 0 && group_size == 0)
+        {
+            append_integer(out, value);
+            return;
+        }
+        const auto magnitude = get_integer_magnitude(value);
+        char buffer[sizeof(T) * 8];
+        char* end = buffer + sizeof(buffer);
+        const char* digits = write_integer_backward(end, magnitude, config.integer_base);
+        const auto digit_count = static_cast<std::size_t>(end - digits);
+        const std::size_t total_count = digit_count < config.integer_width ? config.integer_width : digit_count;
+        const std::size_t padding_count = total_count - digit_count;
+        if (is_negative_integer(value))
+        {
+            out.push_back('-');
+        }
+        // 八进制前缀"0"在数字本身以0开头时省略
+        if (config.is_show_integer_prefix &&
+            !(config.integer_base == IntegerBase::Octal && (padding_count != 0 || magnitude == 0)))
+        {
+            const std::string_view prefix = get_integer_prefix(config.integer_base);
+            out.append(prefix.data(), prefix.size());
+        }
+        // 按位置输出补零与数字拼接后的[position, position + count)
+        auto append_digits = [&](std::size_t position, std::size_t count)
+            {
+                if (position < padding_count)
+                {
+                    const std::size_t zero_count = padding_count - position < count ? padding_count - position : count;
+                    append_zeros(out, zero_count);
+                    position += zero_count;
+                    count -= zero_count;
+                }
+                out.append(digits + (position - padding_count), count);
+            };
+        if (group_size == 0)
+        {
+            append_digits(0, total_count);
+            return;
+        }
+        const std::size_t head_count = total_count % group_size == 0 ? group_size : total_count % group_size;
+        append_digits(0, head_count);
+        for (std::size_t position = head_count; position < total_count; position += group_size)
+        {
+            out.append(config.integer_group_symbol.data(), config.integer_group_symbol.size());
+            append_digits(position, group_size);
+        }
+    }
+}
@@ -0,0 +1,252 @@
+/**
+ * @file stringify_join.hpp
+ * @brief 单次分配的拼接与连接
+ * @author DaneJoe001
+ * @version 0.2.0
+ * @date 2026-10-18
+ * @details 先估算每个参数的输出长度并一次预留，再将各参数直接渲染到结果中，
+ *          避免逐个to_string产生的临时字符串与operator+的重复分配。
+ */
+#pragma once
+
+#include <bit>
+#include <cmath>
+#include <limits>
+#include <string>
+#include <cstdint>
+#include <cstring>
+#include <cstddef>
+#include <iterator>
+#include <algorithm>
+#include <string_view>
+#include <type_traits>
+
+#include "danejoe/common/type_traits/std_type_traits.hpp"
+#include "danejoe/stringify/stringify_config.hpp"
+#include "danejoe/stringify/stringify_traits.hpp"
+#include "danejoe/stringify/stringify_integer.hpp"
+#include "danejoe/stringify/stringify_append.hpp"
+
+ /**
+  * @namespace DaneJoe
+  * @brief DaneJoe 命名空间
+  */
+namespace DaneJoe
+{
+    /// @brief 无法预先估算长度的类型（容器、自定义类型等）使用的估算值
+    inline constexpr std::size_t default_stringify_size_hint = 16;
+    /**
+     * @brief 获取十进制位数
+     * @param value 数值
+     * @return 位数，0为1位
+     */
+    inline std::size_t get_decimal_digit_count(uint64_t value) noexcept
+    {
+        static constexpr uint64_t powers[] = {
+            1ull, 10ull, 100ull, 1000ull, 10000ull, 100000ull, 1000000ull, 10000000ull, 100000000ull,
+            1000000000ull, 10000000000ull, 100000000000ull, 1000000000000ull, 10000000000000ull,
+            100000000000000ull, 1000000000000000ull, 10000000000000000ull, 100000000000000000ull,
+            1000000000000000000ull, 10000000000000000000ull };
+        // bit_width * log10(2)近似位数，再与10的幂比较修正
+        const auto estimate = static_cast<std::size_t>((std::bit_width(value | 1) * 1233) >> 12);
+        return estimate - ((value | 1) < powers[estimate]) + 1;
+    }
+    /**
+     * @brief 估算整数的输出长度
+     * @tparam T 整数类型
+     * @param value 整数
+     * @param config 配置
+     * @return 默认十进制格式下为精确值，其他格式下为上界
+     */
+    template<class T>
+    std::size_t get_integer_size_hint(T value, const StringifyConfig& config) noexcept
+    {
+        const std::size_t sign_count = is_negative_integer(value) ? 1 : 0;
+        const auto magnitude = get_integer_magnitude(value);
+        if constexpr (sizeof(magnitude) <= sizeof(uint64_t))
+        {
+            if (config.integer_base == IntegerBase::Decimal && config.integer_width == 0 &&
+                (config.integer_group_symbol.empty() || config.integer_group_size == 0))
+            {
+                return sign_count + get_decimal_digit_count(static_cast<uint64_t>(magnitude));
+            }
+        }
+        // 按二进制的最大位数估算，另加符号与进制前缀
+        const std::size_t digit_count = std::max(sizeof(magnitude) * 8, config.integer_width);
+        const std::size_t group_count = config.integer_group_size == 0 ? 0 : digit_count / config.integer_group_size;
+        return sign_count + 2 + digit_count + group_count * config.integer_group_symbol.size();
+    }
+    /**
+     * @brief 估算浮点数的输出长度
+     * @tparam T 浮点类型
+     * @param value 浮点数
+     * @param config 配置
+     * @return 估算值；定点格式下按二进制指数估算整数部分
+     */
+    template<class T>
+    std::size_t get_floating_size_hint(T value, const StringifyConfig& config) noexcept
+    {
+        const std::size_t precision = config.float_precision < 0 ?
+            static_cast<std::size_t>(std::numeric_limits<T>::max_digits10) :
+            static_cast<std::size_t>(config.float_precision);
+        // 符号、小数点与e-4932形式的指数
+        constexpr std::size_t extra_count = 8;
+        if (config.float_format != FloatFormat::Fixed || !std::isfinite(value))
+        {
+            return precision + extra_count;
+        }
+        int exponent = 0;
+        std::frexp(value, &exponent);
+        const std::size_t integer_count = exponent > 0 ? static_cast<std::size_t>(exponent) * 30103 / 100000 + 1 : 1;
+        return integer_count + precision + extra_count;
+    }
+    /**
+     * @brief 估算对象的输出长度
+     * @tparam T 类型
+     * @param value 对象
+     * @param config 配置
+     * @return 字符串、字符、布尔与十进制整数为精确值，其余为估算值
+     * @note 只用于预留容量，估算偏小时结果仍正确，只是会再次分配
+     */
+    template<class T>
+    std::size_t get_stringify_size_hint(const T& value, const StringifyConfig& config) noexcept
+    {
+        if constexpr (has_stringify_append<T, std::string>::value)
+        {
+            return default_stringify_size_hint;
+        }
+        else if constexpr (is_unicode_string<T>::value)
+        {
+            // UTF-8的代码单元原样输出，UTF-16的一个代码单元至多3字节，UTF-32至多4字节
+            constexpr std::size_t unit_size = sizeof(typename T::value_type);
+            return value.size() * (unit_size == 1 ? 1 : unit_size == 2 ? 3 : 4);
+        }
+        else if constexpr (is_std_string_view<T>::value || is_basic_string<T>::value)
+        {
+            return value.size();
+        }
+        else if constexpr (is_c_string<T>::value)
+        {
+            const char* text = value;
+            return text == nullptr ? config.null_value_symbol.size() : std::strlen(text);
+        }
+        else if constexpr (std::is_same_v<T, char> || std::is_same_v<T, unsigned char>)
+        {
+            return 1;
+        }
+        else if constexpr (is_unicode_char<T>::value)
+        {
+            return 4;
+        }
+        else if constexpr (std::is_same_v<T, bool>)
+        {
+            return value ? config.bool_symbol.true_symbol.size() : config.bool_symbol.false_symbol.size();
+        }
+        else if constexpr (is_integer_value<T>::value && !std::is_enum_v<T>)
+        {
+            return get_integer_size_hint(value, config);
+        }
+        else if constexpr (std::is_floating_point_v<T>)
+        {
+            return get_floating_size_hint(value, config);
+        }
+        else
+        {
+            return default_stringify_size_hint;
+        }
+    }
+    /**
+     * @brief 为追加预留容量
+     * @tparam Out 输出类型
+     * @param out 输出缓冲
+     * @param size 将要追加的字节数
+     */
+    template<class Out>
+    void reserve_append(Out& out, std::size_t size)
+    {
+        if constexpr (requires { out.reserve(std::size_t()); out.size(); out.capacity(); })
+        {
+            if (out.capacity() - out.size() < size)
+            {
+                out.reserve(out.size() + size);
+            }
+        }
+    }
+    /**
+     * @brief 依次追加各参数，不加分隔符
+     * @tparam Out 输出类型
+     * @tparam Args 参数类型
+     * @param out 输出缓冲
+     * @param config 配置
+     * @param args 参数
+     */
+    template<class Out, class... Args>
+    void append_str_cat(Out& out, const StringifyConfig& config, const Args&... args)
+    {
+        reserve_append(out, (std::size_t(0) + ... + get_stringify_size_hint(args, config)));
+        (append_to_string(out, args, config), ...);
+    }
+    /**
+     * @brief 拼接各参数的字符串化结果
+     * @tparam Args 参数类型
+     * @param args 参数
+     * @return 拼接结果，长度可预先确定时只分配一次
+     */
+    template<class... Args>
+    std::string str_cat(const Args&... args)
+    {
+        std::string result;
+        append_str_cat(result, *StringifyConfigManager::get_config_snapshot(), args...);
+        return result;
+    }
+    /**
+     * @brief 以分隔符连接范围内各元素的字符串化结果
+     * @tparam Out 输出类型
+     * @tparam Range 范围类型
+     * @param out 输出缓冲
+     * @param range 范围，不输出容器的起止符号，也不受max_stringify_element_count限制
+     * @param separator 分隔符
+     * @param config 配置
+     */
+    template<class Out, class Range>
+    void append_join(Out& out, const Range& range, std::string_view separator, const StringifyConfig& config)
+    {
+        auto first = std::begin(range);
+        const auto last = std::end(range);
+        if constexpr (std::forward_iterator<decltype(first)>)
+        {
+            // 可多次遍历时先累计长度
+            std::size_t size = 0;
+            std::size_t count = 0;
+            for (auto it = first; it != last; ++it, ++count)
+            {
+                size += get_stringify_size_hint(*it, config);
+            }
+            reserve_append(out, size + (count == 0 ? 0 : (count - 1) * separator.size()));
+        }
+        if (first == last)
+        {
+            return;
+        }
+        append_to_string(out, *first, config);
+        for (++first; first != last; ++first)
+        {
+            append_text(out, separator);
+            append_to_string(out, *first, config);
+        }
+    }
+    /**
+     * @brief 以分隔符连接范围内各元素的字符串化结果
+     * @tparam Range 范围类型
+     * @param range 范围
+     * @param separator 分隔符
+     * @return 连接结果
+     */
+    template<class Range>
+    std::string join(const Range& range, std::string_view separator)
+    {
+        std::string result;
+        append_join(result, range, separator, *StringifyConfigManager::get_config_snapshot());
+        return result;
+    }
+}
@@ -0,0 +1,723 @@
+/**
+ * @file stringify_parse.hpp
+ * @brief 字符串化结果的反向解析
+ * @author DaneJoe001
+ * @version 0.2.0
+ * @date 2026-10-18
+ * @details 依据当前StringifyConfig的分隔符，将to_string的输出解析回类型化的值。
+ *          解析在std::string_view上单次前向扫描完成，不创建中间子串；
+ *          出错时报告错误类型与相对输入起始的偏移。
+ * @note 字符串元素不带引号，若其内容包含所在容器的分隔符或结束符则无法还原
+ */
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <string>
+#include <cstddef>
+#include <utility>
+#include <charconv>
+#include <optional>
+#include <typeinfo>
+#include <string_view>
+#include <type_traits>
+#include <system_error>
+
+#include "danejoe/common/type_traits/std_type_traits.hpp"
+#include "danejoe/common/type_traits/container_traits.hpp"
+#include "danejoe/stringify/stringify_config.hpp"
+#include "danejoe/stringify/stringify_traits.hpp"
+#include "danejoe/stringify/stringify_integer.hpp"
+
+ /**
+  * @namespace DaneJoe
+  * @brief DaneJoe 命名空间
+  */
+namespace DaneJoe
+{
+    /**
+     * @enum FromStringError
+     * @brief 解析错误
+     */
+    enum class FromStringError
+    {
+        /// @brief 无错误
+        None = 0,
+        /// @brief 输入提前结束
+        UnexpectedEnd,
+        /// @brief 缺少预期的符号
+        ExpectedSymbol,
+        /// @brief 数值格式错误
+        InvalidNumber,
+        /// @brief 数值超出范围
+        NumberOutOfRange,
+        /// @brief 布尔值格式错误
+        InvalidBool,
+        /// @brief 枚举类型名不匹配
+        TypeMismatch,
+        /// @brief 定长容器元素过多或过少
+        ElementCountMismatch,
+        /// @brief 解析完成后仍有剩余字符
+        TrailingCharacters
+    };
+    /**
+     * @brief 获取解析错误描述
+     * @param error 解析错误
+     * @return 错误描述
+     */
+    const char* get_from_string_error_message(FromStringError error) noexcept;
+    /**
+     * @struct FromStringStatus
+     * @brief 解析状态
+     */
+    struct FromStringStatus
+    {
+        /// @brief 错误
+        FromStringError error = FromStringError::None;
+        /// @brief 停止位置相对输入起始的偏移
+        std::size_t offset = 0;
+        /**
+         * @brief 是否成功
+         * @return 成功时为true
+         */
+        explicit operator bool() const
+        {
+            return error == FromStringError::None;
+        }
+    };
+    /**
+     * @struct FromStringResult
+     * @brief 解析结果
+     * @tparam T 值类型
+     */
+    template<class T>
+    struct FromStringResult
+    {
+        /// @brief 解析出的值，失败时为部分结果
+        T value{};
+        /// @brief 错误
+        FromStringError error = FromStringError::None;
+        /// @brief 停止位置相对输入起始的偏移
+        std::size_t offset = 0;
+        /**
+         * @brief 是否成功
+         * @return 成功时为true
+         */
+        explicit operator bool() const
+        {
+            return error == FromStringError::None;
+        }
+    };
+    /**
+     * @struct ParseElement
+     * @brief 容器元素的解析类型
+     * @tparam T 容器的value_type
+     */
+    template<class T>
+    struct ParseElement
+    {
+        using type = T;
+    };
+    /**
+     * @struct ParseElement
+     * @brief 关联容器的value_type为std::pair<const Key, Value>，先解析为可修改的键值对
+     * @tparam Key 键类型
+     * @tparam Value 值类型
+     */
+    template<class Key, class Value>
+    struct ParseElement<std::pair<const Key, Value>>
+    {
+        using type = std::pair<Key, Value>;
+    };
+    /**
+     * @struct ParseTerminator
+     * @brief 字符串叶子值的结束标记，取自所在复合值的分隔符与结束符
+     */
+    struct ParseTerminator
+    {
+        /// @brief 元素分隔符
+        std::string_view separator;
+        /// @brief 结束符
+        std::string_view end;
+    };
+    /**
+     * @class StringifyParser
+     * @brief 单次前向扫描的解析器
+     */
+    class StringifyParser
+    {
+    public:
+        /**
+         * @brief 构造函数
+         * @param text 输入
+         * @param config 配置，须与生成输入时的配置一致
+         */
+        StringifyParser(std::string_view text, const StringifyConfig& config)
+            : m_text(text), m_config(config)
+        {}
+        /**
+         * @brief 解析一个值
+         * @tparam T 类型
+         * @param value 输出值
+         * @param terminator 字符串叶子值的结束标记
+         * @return 是否成功
+         */
+        template<class T>
+        bool parse(T& value, const ParseTerminator& terminator = {})
+        {
+            if constexpr ((is_std_string_view<T>::value || is_basic_string<T>::value) && !is_unicode_string<T>::value)
+            {
+                std::string_view token = scan_token(terminator);
+                value = T(token.data(), token.size());
+                return true;
+            }
+            else if constexpr (std::is_same_v<T, bool>)
+            {
+                if (consume(m_config.bool_symbol.true_symbol))
+                {
+                    value = true;
+                    return true;
+                }
+                if (consume(m_config.bool_symbol.false_symbol))
+                {
+                    value = false;
+                    return true;
+                }
+                return fail(FromStringError::InvalidBool);
+            }
+            else if constexpr (std::is_same_v<T, char> || std::is_same_v<T, unsigned char>)
+            {
+                if (m_offset >= m_text.size())
+                {
+                    return fail(FromStringError::UnexpectedEnd);
+                }
+                value = static_cast<T>(m_text[m_offset++]);
+                return true;
+            }
+            else if constexpr (std::is_enum_v<T>)
+            {
+                return parse_enum(value);
+            }
+            else if constexpr (is_integer_value<T>::value)
+            {
+                return parse_integer(value);
+            }
+            else if constexpr (std::is_arithmetic_v<T>)
+            {
+                return parse_number(value);
+            }
+            else if constexpr (is_chrono_duration<T>::value)
+            {
+                return parse_duration(value);
+            }
+            else if constexpr (is_std_pair<T>::value)
+            {
+                return parse_pair(value);
+            }
+            else if constexpr (is_std_optional<T>::value)
+            {
+                if (consume(m_config.null_value_symbol))
+                {
+                    value.reset();
+                    return true;
+                }
+                typename T::value_type inner{};
+                if (!parse(inner, terminator))
+                {
+                    return false;
+                }
+                value = std::move(inner);
+                return true;
+            }
+            else if constexpr (is_std_tuple<T>::value)
+            {
+                return parse_tuple(value, std::make_index_sequence<std::tuple_size_v<T>>());
+            }
+            else if constexpr (has_iterator<T>::value && !is_unicode_string<T>::value)
+            {
+                return parse_container(value);
+            }
+            else
+            {
+                static_assert(has_iterator<T>::value && !is_unicode_string<T>::value, "from_string: unsupported type");
+                return false;
+            }
+        }
+        /**
+         * @brief 当前偏移
+         * @return 相对输入起始的偏移
+         */
+        std::size_t offset() const
+        {
+            return m_offset;
+        }
+        /**
+         * @brief 当前错误
+         * @return 错误
+         */
+        FromStringError error() const
+        {
+            return m_error;
+        }
+        /**
+         * @brief 是否已到达输入结尾
+         * @return 到达时为true
+         */
+        bool is_at_end() const
+        {
+            return m_offset == m_text.size();
+        }
+        /**
+         * @brief 标记错误
+         * @param error 错误
+         * @return 总是false
+         */
+        bool fail(FromStringError error)
+        {
+            if (m_error == FromStringError::None)
+            {
+                m_error = error;
+            }
+            return false;
+        }
+    private:
+        /**
+         * @brief 当前位置是否以符号开头
+         * @param symbol 符号
+         * @return 是时为true
+         */
+        bool starts_with(std::string_view symbol) const
+        {
+            return m_text.substr(m_offset, symbol.size()) == symbol;
+        }
+        /**
+         * @brief 若当前位置以符号开头则跳过
+         * @param symbol 符号
+         * @return 是否跳过
+         */
+        bool consume(std::string_view symbol)
+        {
+            if (!starts_with(symbol))
+            {
+                return false;
+            }
+            m_offset += symbol.size();
+            return true;
+        }
+        /**
+         * @brief 跳过必需的符号
+         * @param symbol 符号
+         * @return 是否成功
+         */
+        bool expect(std::string_view symbol)
+        {
+            if (consume(symbol))
+            {
+                return true;
+            }
+            return fail(m_offset >= m_text.size() ? FromStringError::UnexpectedEnd : FromStringError::ExpectedSymbol);
+        }
+        /**
+         * @brief 跳过分隔符及其后的空格占位
+         * @param symbol 分隔符号
+         * @return 是否成功
+         */
+        bool expect_separator(const DelimiterSymbol& symbol)
+        {
+            if (!expect(symbol.element_separator))
+            {
+                return false;
+            }
+            consume(symbol.space_maker);
+            return true;
+        }
+        /**
+         * @brief 扫描字符串叶子值直至结束标记或输入结尾
+         * @param terminator 结束标记
+         * @return 指向输入的字符串片段
+         */
+        std::string_view scan_token(const ParseTerminator& terminator)
+        {
+            const std::size_t start = m_offset;
+            if (terminator.separator.empty() && terminator.end.empty())
+            {
+                m_offset = m_text.size();
+                return m_text.substr(start);
+            }
+            while (m_offset < m_text.size())
+            {
+                const char ch = m_text[m_offset];
+                if ((!terminator.separator.empty() && ch == terminator.separator.front() && starts_with(terminator.separator)) ||
+                    (!terminator.end.empty() && ch == terminator.end.front() && starts_with(terminator.end)))
+                {
+                    break;
+                }
+                ++m_offset;
+            }
+            return m_text.substr(start, m_offset - start);
+        }
+        /**
+         * @brief 解析数值
+         * @tparam T 算术类型
+         * @param value 输出值
+         * @return 是否成功
+         */
+        template<class T>
+        bool parse_number(T& value)
+        {
+            const char* first = m_text.data() + m_offset;
+            const char* last = m_text.data() + m_text.size();
+            // to_string对小整型先做整型提升，这里以提升后的类型解析再收窄
+            using U = std::conditional_t<std::is_integral_v<T>, decltype(+value), T>;
+            U parsed{};
+            auto result = std::from_chars(first, last, parsed);
+            if (result.ec == std::errc::invalid_argument)
+            {
+                return fail(first == last ? FromStringError::UnexpectedEnd : FromStringError::InvalidNumber);
+            }
+            if (result.ec == std::errc::result_out_of_range ||
+                (std::is_integral_v<T> && static_cast<U>(static_cast<T>(parsed)) != parsed))
+            {
+                return fail(FromStringError::NumberOutOfRange);
+            }
+            value = static_cast<T>(parsed);
+            m_offset += static_cast<std::size_t>(result.ptr - first);
+            return true;
+        }
+        /**
+         * @brief 按配置的进制、前缀与分组解析整数
+         * @tparam T 整数类型
+         * @param value 输出值
+         * @return 是否成功
+         * @note 分组符号仅在其后紧跟数字时视为分组
+         */
+        template<class T>
+        bool parse_integer(T& value)
+        {
+            const IntegerBase base = m_config.integer_base;
+            const std::string_view group_symbol = m_config.integer_group_size == 0 ?
+                std::string_view() : std::string_view(m_config.integer_group_symbol);
+            if constexpr (!is_int128<T>::value)
+            {
+                if (base == IntegerBase::Decimal && group_symbol.empty())
+                {
+                    return parse_number(value);
+                }
+            }
+            using U = typename make_unsigned_integer<T>::type;
+            const unsigned radix = get_integer_radix(base);
+            auto get_digit = [radix](char ch) -> unsigned
+                {
+                    unsigned digit = radix;
+                    if (ch >= '0' && ch <= '9')
+                    {
+                        digit = static_cast<unsigned>(ch - '0');
+                    }
+                    else if (ch >= 'a' && ch <= 'f')
+                    {
+                        digit = static_cast<unsigned>(ch - 'a') + 10;
+                    }
+                    else if (ch >= 'A' && ch <= 'F')
+                    {
+                        digit = static_cast<unsigned>(ch - 'A') + 10;
+                    }
+                    return digit < radix ? digit : radix;
+                };
+            const std::size_t start = m_offset;
+            const bool is_negative = is_signed_integer_v<T> && consume("-");
+            bool has_digit = false;
+            if (m_config.is_show_integer_prefix)
+            {
+                // 八进制前缀在数字以0开头时省略，前缀本身即是一位0
+                if (base == IntegerBase::Octal)
+                {
+                    has_digit = starts_with("0");
+                }
+                else if (!expect(get_integer_prefix(base)))
+                {
+                    return false;
+                }
+            }
+            const U max_magnitude = static_cast<U>(static_cast<U>(-1) >> (is_signed_integer_v<T> ? 1 : 0)) +
+                (is_negative ? 1 : 0);
+            U magnitude = 0;
+            bool is_overflow = false;
+            while (m_offset < m_text.size())
+            {
+                const unsigned digit = get_digit(m_text[m_offset]);
+                if (digit == radix)
+                {
+                    if (has_digit && !group_symbol.empty() && starts_with(group_symbol) &&
+                        m_offset + group_symbol.size() < m_text.size() &&
+                        get_digit(m_text[m_offset + group_symbol.size()]) != radix)
+                    {
+                        m_offset += group_symbol.size();
+                        continue;
+                    }
+                    break;
+                }
+                if (magnitude > static_cast<U>((max_magnitude - digit) / radix))
+                {
+                    is_overflow = true;
+                }
+                else
+                {
+                    magnitude = static_cast<U>(magnitude * radix + digit);
+                }
+                has_digit = true;
+                ++m_offset;
+            }
+            if (!has_digit)
+            {
+                m_offset = start;
+                return fail(m_offset >= m_text.size() ? FromStringError::UnexpectedEnd : FromStringError::InvalidNumber);
+            }
+            if (is_overflow)
+            {
+                m_offset = start;
+                return fail(FromStringError::NumberOutOfRange);
+            }
+            value = is_negative ? static_cast<T>(U(0) - magnitude) : static_cast<T>(magnitude);
+            return true;
+        }
+        /**
+         * @brief 解析枚举，格式为<类型名>(底层值)
+         * @tparam T 枚举类型
+         * @param value 输出值
+         * @return 是否成功
+         */
+        template<class T>
+        bool parse_enum(T& value)
+        {
+            const EnumSymbol& symbol = m_config.enum_symbol;
+            if (!expect(symbol.type_symbol.start_maker))
+            {
+                return false;
+            }
+            const std::size_t type_offset = m_offset;
+            if (!consume(typeid(T).name()))
+            {
+                m_offset = type_offset;
+                return fail(FromStringError::TypeMismatch);
+            }
+            std::underlying_type_t<T> underlying{};
+            if (!expect(symbol.type_symbol.end_maker) ||
+                !expect(symbol.value_symbol.start_maker) ||
+                !parse_number(underlying) ||
+                !expect(symbol.value_symbol.end_maker))
+            {
+                return false;
+            }
+            value = static_cast<T>(underlying);
+            return true;
+        }
+        /**
+         * @brief 解析时长，格式为计数加单位符号
+         * @tparam T 时长类型
+         * @param value 输出值
+         * @return 是否成功
+         */
+        template<class T>
+        bool parse_duration(T& value)
+        {
+            typename T::rep count{};
+            if constexpr (is_integer_value<typename T::rep>::value)
+            {
+                if (!parse_integer(count))
+                {
+                    return false;
+                }
+            }
+            else if (!parse_number(count))
+            {
+                return false;
+            }
+            const TimeSymbol& symbol = m_config.time_symbol;
+            bool is_unit_matched = true;
+            if constexpr (is_chrono_microseconds<T>::value)
+            {
+                is_unit_matched = expect(symbol.microsecond_symbol);
+            }
+            else if constexpr (is_chrono_milliseconds<T>::value)
+            {
+                is_unit_matched = expect(symbol.millisecond_symbol);
+            }
+            else if constexpr (is_chrono_nanoseconds<T>::value)
+            {
+                is_unit_matched = expect(symbol.nanosecond_symbol);
+            }
+            else if constexpr (is_chrono_seconds<T>::value)
+            {
+                is_unit_matched = expect(symbol.second_symbol);
+            }
+            if (!is_unit_matched)
+            {
+                return false;
+            }
+            value = T(count);
+            return true;
+        }
+        /**
+         * @brief 解析std::pair
+         * @tparam T 键值对类型
+         * @param value 输出值
+         * @return 是否成功
+         */
+        template<class T>
+        bool parse_pair(T& value)
+        {
+            const DelimiterSymbol& symbol = m_config.pair_symbol;
+            return expect(symbol.start_maker) &&
+                parse(value.first, ParseTerminator{ symbol.element_separator, symbol.end_maker }) &&
+                expect_separator(symbol) &&
+                parse(value.second, ParseTerminator{ symbol.element_separator, symbol.end_maker }) &&
+                expect(symbol.end_maker);
+        }
+        /**
+         * @brief 解析std::tuple
+         * @tparam T 元组类型
+         * @tparam Indexes 下标序列
+         * @param value 输出值
+         * @return 是否成功
+         */
+        template<class T, std::size_t... Indexes>
+        bool parse_tuple(T& value, std::index_sequence<Indexes...>)
+        {
+            const DelimiterSymbol& symbol = m_config.tuple_symbol;
+            const ParseTerminator terminator{ symbol.element_separator, symbol.end_maker };
+            if (!expect(symbol.start_maker))
+            {
+                return false;
+            }
+            bool is_ok = true;
+            ((is_ok = is_ok &&
+                (Indexes == 0 || expect_separator(symbol)) &&
+                parse(std::get<Indexes>(value), terminator)), ...);
+            return is_ok && expect(symbol.end_maker);
+        }
+        /**
+         * @brief 解析容器
+         * @tparam T 容器类型
+         * @param value 输出值
+         * @return 是否成功
+         * @note 序列容器使用push_back，关联容器使用insert，std::array按位置赋值
+         */
+        template<class T>
+        bool parse_container(T& value)
+        {
+            const DelimiterSymbol& symbol = m_config.container_symbol;
+            const ParseTerminator terminator{ symbol.element_separator, symbol.end_maker };
+            if (!expect(symbol.start_maker))
+            {
+                return false;
+            }
+            constexpr bool is_fixed_size = requires { std::tuple_size<T>::value; };
+            if constexpr (!is_fixed_size)
+            {
+                value.clear();
+            }
+            std::size_t count = 0;
+            if (!consume(symbol.end_maker))
+            {
+                do
+                {
+                    if constexpr (is_fixed_size)
+                    {
+                        if (count >= std::tuple_size<T>::value)
+                        {
+                            return fail(FromStringError::ElementCountMismatch);
+                        }
+                        if (!parse(value[count], terminator))
+                        {
+                            return false;
+                        }
+                    }
+                    else
+                    {
+                        typename ParseElement<typename T::value_type>::type element{};
+                        if (!parse(element, terminator))
+                        {
+                            return false;
+                        }
+                        if constexpr (requires { value.push_back(std::move(element)); })
+                        {
+                            value.push_back(std::move(element));
+                        }
+                        else
+                        {
+                            value.insert(std::move(element));
+                        }
+                    }
+                    ++count;
+                } while (!consume(symbol.end_maker) && expect_separator(symbol));
+            }
+            if (m_error != FromStringError::None)
+            {
+                return false;
+            }
+            if constexpr (is_fixed_size)
+            {
+                if (count != std::tuple_size<T>::value)
+                {
+                    return fail(FromStringError::ElementCountMismatch);
+                }
+            }
+            return true;
+        }
+    private:
+        /// @brief 输入
+        std::string_view m_text;
+        /// @brief 配置
+        const StringifyConfig& m_config;
+        /// @brief 当前偏移
+        std::size_t m_offset = 0;
+        /// @brief 错误
+        FromStringError m_error = FromStringError::None;
+    };
+    /**
+     * @brief 使用指定配置将字符串解析为值
+     * @tparam T 类型
+     * @param text 输入
+     * @param value 输出值
+     * @param config 配置
+     * @return 解析状态
+     * @note T为std::string_view时结果指向输入
+     */
+    template<class T>
+    FromStringStatus from_string(std::string_view text, T& value, const StringifyConfig& config)
+    {
+        StringifyParser parser(text, config);
+        if (parser.parse(value) && !parser.is_at_end())
+        {
+            parser.fail(FromStringError::TrailingCharacters);
+        }
+        return { parser.error(), parser.offset() };
+    }
+    /**
+     * @brief 将字符串解析为值
+     * @tparam T 类型
+     * @param text 输入
+     * @param value 输出值
+     * @return 解析状态
+     */
+    template<class T>
+    FromStringStatus from_string(std::string_view text, T& value)
+    {
+        return from_string(text, value, *StringifyConfigManager::get_config_snapshot());
+    }
+    /**
+     * @brief 将字符串解析为值
+     * @tparam T 类型
+     * @param text 输入
+     * @return 解析结果
+     */
+    template<class T>
+    FromStringResult<T> from_string(std::string_view text)
+    {
+        FromStringResult<T> result;
+        FromStringStatus status = from_string(text, result.value);
+        result.error = status.error;
+        result.offset = status.offset;
+        return result;
+    }
+}
@@ -0,0 +1,62 @@
+/**
+ * @file stringify_prebuilt.hpp
+ * @brief 常用类型的预编译实例
+ * @author DaneJoe001
+ * @version 0.2.0
+ * @date 2026-10-18
+ * @details 基本类型及其容器的to_string与append_to_string已在DaneJoeStringify中显式实例化，
+ *          此处以extern template声明，避免每个翻译单元重复实例化。
+ * @note 定义DANEJOE_STRINGIFY_NO_PREBUILT可关闭extern声明，恢复隐式实例化
+ */
+#pragma once
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "danejoe/stringify/stringify_to_string.hpp"
+
+/**
+ * @brief 对每个预编译类型展开宏X
+ * @note 类型可含逗号，X须以可变参数接收
+ */
+#define DANEJOE_STRINGIFY_FOR_EACH_PREBUILT_TYPE(X) \
+    X(int) \
+    X(long) \
+    X(long long) \
+    X(unsigned int) \
+    X(unsigned long) \
+    X(unsigned long long) \
+    X(float) \
+    X(double) \
+    X(bool) \
+    X(char) \
+    X(std::string) \
+    X(std::vector<int>) \
+    X(std::vector<long>) \
+    X(std::vector<long long>) \
+    X(std::vector<unsigned int>) \
+    X(std::vector<unsigned long>) \
+    X(std::vector<unsigned long long>) \
+    X(std::vector<float>) \
+    X(std::vector<double>) \
+    X(std::vector<bool>) \
+    X(std::vector<std::string>) \
+    X(std::map<int, int>) \
+    X(std::map<std::string, int>) \
+    X(std::map<std::string, double>) \
+    X(std::map<std::string, std::string>)
+
+#ifndef DANEJOE_STRINGIFY_NO_PREBUILT
+
+/// @brief 声明单个类型的预编译实例
+#define DANEJOE_STRINGIFY_EXTERN_PREBUILT(...) \
+    extern template std::string DaneJoe::to_string<__VA_ARGS__>(const __VA_ARGS__&); \
+    extern template void DaneJoe::append_to_string<std::string, __VA_ARGS__>( \
+        std::string&, const __VA_ARGS__&, const DaneJoe::StringifyConfig&);
+
+DANEJOE_STRINGIFY_FOR_EACH_PREBUILT_TYPE(DANEJOE_STRINGIFY_EXTERN_PREBUILT)
+
+#undef DANEJOE_STRINGIFY_EXTERN_PREBUILT
+
+#endif
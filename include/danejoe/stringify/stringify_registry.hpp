@@ -0,0 +1,317 @@
+/**
+ * @file stringify_registry.hpp
+ * @brief 运行时格式化器注册表
+ * @author DaneJoe001
+ * @version 0.2.0
+ * @date 2026-10-18
+ * @details 编译期无法提供to_string成员或operator<<的类型（如插件中定义的类型）
+ *          可在运行时按std::type_info注册格式化器。注册表为开放寻址的扁平哈希表，
+ *          注册时复制并整体替换，查找只做一次共享指针的原子加载，不加互斥锁；
+ *          旧表在最后一个持有者释放后回收。
+ *          仅在编译期分发落入fallback分支的类型与std::any中的值才会查找注册表，
+ *          其余分支不受影响。
+ */
+#pragma once
+
+#include <any>
+#include <mutex>
+#include <atomic>
+#include <string>
+#include <vector>
+#include <string_view>
+#include <memory>
+#include <cstddef>
+#include <typeinfo>
+#include <functional>
+#include <type_traits>
+
+#include "danejoe/stringify/stringify_config.hpp"
+
+ /**
+  * @namespace DaneJoe
+  * @brief DaneJoe 命名空间
+  */
+namespace DaneJoe
+{
+    /**
+     * @class StringifyFormatOutput
+     * @brief 类型擦除的输出引用，注册的格式化器经它直接写入调用方的输出缓冲
+     * @note 提供append、push_back与operator+=，可作为append_to_string的输出类型
+     */
+    class StringifyFormatOutput
+    {
+    public:
+        /**
+         * @brief 构造函数
+         * @tparam Out 输出类型，须提供append(const char*, size)
+         * @param out 输出缓冲
+         */
+        template<class Out, std::enable_if_t<
+            !std::is_same_v<Out, StringifyFormatOutput>, int> = 0>
+        explicit StringifyFormatOutput(Out& out) noexcept
+            : m_out(&out),
+            m_append([](void* target, const char* data, std::size_t size)
+                {
+                    static_cast<Out*>(target)->append(data, size);
+                })
+        {
+            if constexpr (std::is_same_v<Out, std::string>)
+            {
+                m_string = &out;
+            }
+        }
+        /**
+         * @brief 追加字符序列
+         * @param data 字符序列
+         * @param size 字符数量
+         */
+        void append(const char* data, std::size_t size)
+        {
+            m_append(m_out, data, size);
+        }
+        /**
+         * @brief 追加字符串片段
+         * @param text 字符串片段
+         */
+        void append(std::string_view text)
+        {
+            m_append(m_out, text.data(), text.size());
+        }
+        /**
+         * @brief 追加单个字符
+         * @param ch 字符
+         */
+        void push_back(char ch)
+        {
+            m_append(m_out, &ch, 1);
+        }
+        StringifyFormatOutput& operator+=(std::string_view text)
+        {
+            append(text);
+            return *this;
+        }
+        StringifyFormatOutput& operator+=(char ch)
+        {
+            push_back(ch);
+            return *this;
+        }
+        /**
+         * @brief 获取底层的std::string
+         * @return 输出为std::string时为其地址，否则为nullptr
+         */
+        std::string* get_string() const noexcept
+        {
+            return m_string;
+        }
+    private:
+        /// @brief 输出缓冲
+        void* m_out;
+        /// @brief 追加函数
+        void (*m_append)(void*, const char*, std::size_t);
+        /// @brief 输出为std::string时的地址
+        std::string* m_string = nullptr;
+    };
+    /**
+     * @struct StringifyFormatter
+     * @brief 类型擦除的格式化器
+     */
+    struct StringifyFormatter
+    {
+        /// @brief 将对象追加到输出，对象以const void*传入
+        std::function<void(StringifyFormatOutput&, const void*, const StringifyConfig&)> format;
+        /// @brief 从std::any中取出对象地址，类型不符时返回nullptr
+        const void* (*get_any_value)(const std::any&) = nullptr;
+    };
+    /// @brief 注册表使用的扁平哈希表，定义于stringify_registry.cpp
+    struct StringifyFormatterTable;
+    /**
+     * @class StringifyFormatterRegistry
+     * @brief 格式化器注册表
+     * @note 基本类型、std::string及预编译实例中的容器类型已预先注册，使std::any中的常见值可直接输出
+     */
+    class StringifyFormatterRegistry
+    {
+    public:
+        /**
+         * @brief 查找格式化器
+         * @param type 类型
+         * @return 格式化器，未注册时为nullptr
+         * @note 除首次调用安装预注册格式化器外不加互斥锁；返回值持有所在的表，注销或重新注册后仍可安全使用
+         */
+        static std::shared_ptr<const StringifyFormatter> find(const std::type_info& type);
+        /**
+         * @brief 注册或替换格式化器
+         * @param type 类型
+         * @param formatter 格式化器
+         */
+        static void set(const std::type_info& type, StringifyFormatter formatter);
+        /**
+         * @brief 注销格式化器
+         * @param type 类型
+         * @return 是否存在并已注销
+         * @note 插件卸载前应注销其注册的类型
+         */
+        static bool remove(const std::type_info& type);
+        /**
+         * @brief 已注册的类型数量
+         * @return 数量
+         */
+        static std::size_t size();
+    private:
+        /**
+         * @brief 获取当前表，首次调用时安装预注册的格式化器
+         * @return 当前表
+         */
+        static std::shared_ptr<const StringifyFormatterTable> get_table();
+        /**
+         * @brief 以新表替换当前表，调用方须持有m_mutex
+         * @param table 新表
+         * @return 旧表，由调用方在锁外释放
+         */
+        static std::shared_ptr<const StringifyFormatterTable> publish(std::shared_ptr<const StringifyFormatterTable> table);
+#if defined(__cpp_lib_atomic_shared_ptr)
+        /// @brief 当前表，读者持有快照引用，旧表在最后一个读者释放后回收
+        static std::atomic<std::shared_ptr<const StringifyFormatterTable>> m_table;
+#else
+        /// @brief 当前表，经std::atomic_load/atomic_exchange访问
+        static std::shared_ptr<const StringifyFormatterTable> m_table;
+#endif
+        /// @brief 互斥锁，串行化注册
+        static std::mutex m_mutex;
+    };
+    /**
+     * @brief 注册类型T的格式化器
+     * @tparam T 类型
+     * @tparam Function 可调用类型：void(StringifyFormatOutput&, const T&, const StringifyConfig&)
+     *                  （含以auto&接收输出的泛型lambda）直接写入调用方的输出；
+     *                  void(std::string&, const T&, const StringifyConfig&)在输出不是std::string时经临时字符串；
+     *                  std::string(const T&)追加返回的字符串
+     * @param function 格式化函数
+     */
+    template<class T, class Function>
+    void register_formatter(Function function)
+    {
+        constexpr bool is_output_function =
+            std::is_invocable_v<const Function&, StringifyFormatOutput&, const T&, const StringifyConfig&>;
+        constexpr bool is_string_function =
+            std::is_invocable_v<const Function&, std::string&, const T&, const StringifyConfig&>;
+        static_assert(is_output_function || is_string_function ||
+            std::is_invocable_r_v<std::string, const Function&, const T&>,
+            "register_formatter: function must be std::string(const T&) or "
+            "void(Out&, const T&, const StringifyConfig&) with Out StringifyFormatOutput or std::string");
+        StringifyFormatter formatter;
+        formatter.format = [function = std::move(function)](StringifyFormatOutput& out, const void* value,
+            const StringifyConfig& config)
+            {
+                const T& object = *static_cast<const T*>(value);
+                if constexpr (is_output_function)
+                {
+                    function(out, object, config);
+                }
+                else if constexpr (is_string_function)
+                {
+                    if (std::string* string_out = out.get_string())
+                    {
+                        function(*string_out, object, config);
+                    }
+                    else
+                    {
+                        std::string text;
+                        function(text, object, config);
+                        out.append(text);
+                    }
+                }
+                else
+                {
+                    const std::string text(function(object));
+                    out.append(text);
+                }
+            };
+        formatter.get_any_value = [](const std::any& value) -> const void*
+            {
+                return std::any_cast<T>(&value);
+            };
+        StringifyFormatterRegistry::set(typeid(T), std::move(formatter));
+    }
+    /**
+     * @brief 注销类型T的格式化器
+     * @tparam T 类型
+     * @return 是否存在并已注销
+     */
+    template<class T>
+    bool unregister_formatter()
+    {
+        return StringifyFormatterRegistry::remove(typeid(T));
+    }
+    /**
+     * @brief 类型T是否已注册格式化器
+     * @tparam T 类型
+     * @return 已注册时为true
+     */
+    template<class T>
+    bool has_formatter()
+    {
+        return StringifyFormatterRegistry::find(typeid(T)) != nullptr;
+    }
+    /**
+     * @brief 以注册的格式化器追加对象
+     * @tparam Out 输出类型
+     * @param out 输出缓冲
+     * @param formatter 格式化器
+     * @param value 对象地址
+     * @param config 配置
+     */
+    template<class Out>
+    void append_formatted(Out& out, const StringifyFormatter& formatter, const void* value,
+        const StringifyConfig& config)
+    {
+        StringifyFormatOutput output(out);
+        formatter.format(output, value, config);
+    }
+    /**
+     * @brief 若类型已注册则以其格式化器追加对象
+     * @tparam Out 输出类型
+     * @param out 输出缓冲
+     * @param value 对象地址
+     * @param type 对象类型
+     * @param config 配置
+     * @return 是否已注册并追加
+     */
+    template<class Out>
+    bool append_registered(Out& out, const void* value, const std::type_info& type,
+        const StringifyConfig& config)
+    {
+        const auto formatter = StringifyFormatterRegistry::find(type);
+        if (formatter == nullptr)
+        {
+            return false;
+        }
+        append_formatted(out, *formatter, value, config);
+        return true;
+    }
+    /**
+     * @brief 追加std::any
+     * @tparam Out 输出类型
+     * @param out 输出缓冲
+     * @param value 对象
+     * @param config 配置
+     * @note 空值输出null_value_symbol，所含类型未注册时输出unsupported_type_place_holder
+     */
+    template<class Out>
+    void append_std_any(Out& out, const std::any& value, const StringifyConfig& config)
+    {
+        if (!value.has_value())
+        {
+            out.append(config.null_value_symbol.data(), config.null_value_symbol.size());
+            return;
+        }
+        const auto formatter = StringifyFormatterRegistry::find(value.type());
+        const void* object = formatter == nullptr ? nullptr : formatter->get_any_value(value);
+        if (object == nullptr)
+        {
+            out.append(config.unsupported_type_place_holder.data(), config.unsupported_type_place_holder.size());
+            return;
+        }
+        append_formatted(out, *formatter, object, config);
+    }
+}
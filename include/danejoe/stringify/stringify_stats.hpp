@@ -0,0 +1,264 @@
+/**
+ * @file stringify_stats.hpp
+ * @brief 字符串化统计
+ * @author DaneJoe001
+ * @version 0.2.0
+ * @date 2026-10-18
+ * @details 定义DANEJOE_STRINGIFY_ENABLE_STATS（CMake选项同名）后，
+ *          各分发分支按线程记录调用次数、输出字节、耗时与期间输出缓冲扩容的调用次数，
+ *          并记录StringifyConfigManager的锁等待；未定义时记录宏展开为空。
+ * @note 启用后线程首次记录时会分配并加锁注册计数器，之后的记录仅为原子累加；
+ *       实时线程可在开始时调用register_stringify_stats_thread预先注册。
+ */
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+ /**
+  * @namespace DaneJoe
+  * @brief DaneJoe 命名空间
+  */
+namespace DaneJoe
+{
+    /**
+     * @enum StringifyBranch
+     * @brief 字符串化分发分支
+     */
+    enum class StringifyBranch
+    {
+        /// @brief from_std_string
+        StdString = 0,
+        /// @brief from_std_string_view
+        StdStringView,
+        /// @brief from_c_string
+        CString,
+        /// @brief from_unicode_string
+        UnicodeString,
+        /// @brief from_enum
+        Enum,
+        /// @brief from_char
+        Char,
+        /// @brief from_unicode_char
+        UnicodeChar,
+        /// @brief from_bool
+        Bool,
+        /// @brief from_bit_sequence
+        BitSequence,
+        /// @brief from_stringify_append
+        CustomAppend,
+        /// @brief from_member_to_string
+        MemberToString,
+        /// @brief from_std_to_string
+        StdToString,
+        /// @brief format_time_duration
+        TimeDuration,
+        /// @brief format_time_point
+        TimePoint,
+        /// @brief from_std_pair
+        StdPair,
+        /// @brief from_std_optional
+        StdOptional,
+        /// @brief from_std_variant
+        StdVariant,
+        /// @brief from_std_tuple
+        StdTuple,
+        /// @brief from_std_any
+        StdAny,
+        /// @brief from_has_iterator
+        HasIterator,
+        /// @brief from_c_array
+        CArray,
+        /// @brief from_input_range
+        InputRange,
+        /// @brief from_stream_out
+        StreamOut,
+        /// @brief from_fallback
+        Fallback,
+        /// @brief format_capacity_size
+        CapacitySize,
+        /// @brief 分支数量
+        Count
+    };
+    /**
+     * @brief 获取分支名称
+     * @param branch 分支
+     * @return 分支对应的函数名
+     */
+    const char* get_stringify_branch_name(StringifyBranch branch) noexcept;
+    /**
+     * @struct StringifyBranchStats
+     * @brief 单个分支的统计
+     * @note 耗时、字节数与扩容调用数均包含嵌套元素
+     */
+    struct StringifyBranchStats
+    {
+        /// @brief 调用次数
+        uint64_t call_count = 0;
+        /// @brief 输出字节数
+        uint64_t output_bytes = 0;
+        /// @brief 耗时（纳秒）
+        uint64_t nanoseconds = 0;
+        /**
+         * @brief 期间输出缓冲容量发生变化的调用次数
+         * @note 一次调用内多次扩容只计1次，嵌套元素引起的扩容在外层与该元素的分支各计1次，
+         *       因此不等于实际分配次数，只用于定位哪些分支在未预留的输出上运行
+         */
+        uint64_t growth_call_count = 0;
+    };
+    /**
+     * @struct StringifyStats
+     * @brief 统计快照
+     */
+    struct StringifyStats
+    {
+        /// @brief 各分支统计，以StringifyBranch为下标
+        std::array<StringifyBranchStats, static_cast<std::size_t>(StringifyBranch::Count)> branches = {};
+        /// @brief 配置锁获取次数
+        uint64_t config_lock_count = 0;
+        /// @brief 配置锁发生等待的次数
+        uint64_t config_lock_wait_count = 0;
+        /// @brief 配置锁等待耗时（纳秒）
+        uint64_t config_lock_wait_nanoseconds = 0;
+        /**
+         * @brief 获取分支统计
+         * @param branch 分支
+         * @return 分支统计
+         */
+        const StringifyBranchStats& operator[](StringifyBranch branch) const
+        {
+            return branches[static_cast<std::size_t>(branch)];
+        }
+    };
+    /**
+     * @brief 统计是否在编译期启用
+     * @return 启用时为true
+     */
+    constexpr bool is_stringify_stats_enabled()
+    {
+#if defined(DANEJOE_STRINGIFY_ENABLE_STATS)
+        return true;
+#else
+        return false;
+#endif
+    }
+    /**
+     * @brief 汇总所有线程的统计
+     * @return 统计快照，未启用时全为0
+     */
+    StringifyStats stringify_stats();
+    /**
+     * @brief 清零所有线程的统计
+     */
+    void reset_stringify_stats();
+    /**
+     * @brief 预先注册当前线程的计数器
+     * @note 注册需加锁并可能分配；要求无锁、无分配的线程（如使用stringify_to的实时线程）应在开始时调用，
+     *       之后的记录不再注册。未启用统计时为空操作
+     */
+    void register_stringify_stats_thread();
+    /**
+     * @brief 记录一次分支调用
+     * @param branch 分支
+     * @param output_bytes 输出字节数
+     * @param nanoseconds 耗时（纳秒）
+     * @param is_grown 期间输出缓冲容量是否发生变化
+     * @note 首次在某线程调用时注册该线程的计数器，注册失败时丢弃本次记录
+     */
+    void record_stringify_branch(
+        StringifyBranch branch,
+        uint64_t output_bytes,
+        uint64_t nanoseconds,
+        bool is_grown) noexcept;
+    /**
+     * @brief 记录一次配置锁获取
+     * @param is_waited 是否发生等待
+     * @param nanoseconds 等待耗时（纳秒）
+     * @note 首次在某线程调用时注册该线程的计数器，注册失败时丢弃本次记录
+     */
+    void record_stringify_config_lock(bool is_waited, uint64_t nanoseconds) noexcept;
+#if defined(DANEJOE_STRINGIFY_ENABLE_STATS)
+    /**
+     * @class StringifyStatsScope
+     * @brief 分支统计作用域，析构时记录一次调用
+     * @tparam Out 输出类型
+     */
+    template<class Out>
+    class StringifyStatsScope
+    {
+    public:
+        /**
+         * @brief 构造函数
+         * @param branch 分支
+         * @param out 输出缓冲
+         */
+        StringifyStatsScope(StringifyBranch branch, const Out& out) noexcept
+            : m_branch(branch), m_out(out),
+            m_start_size(size_of(out)), m_start_capacity(capacity_of(out)),
+            m_start_time(std::chrono::steady_clock::now())
+        {}
+        /**
+         * @brief 析构函数
+         */
+        ~StringifyStatsScope()
+        {
+            auto elapsed = std::chrono::steady_clock::now() - m_start_time;
+            std::size_t end_size = size_of(m_out);
+            record_stringify_branch(m_branch,
+                end_size >= m_start_size ? end_size - m_start_size : 0,
+                static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()),
+                capacity_of(m_out) != m_start_capacity);
+        }
+        StringifyStatsScope(const StringifyStatsScope&) = delete;
+        StringifyStatsScope& operator=(const StringifyStatsScope&) = delete;
+    private:
+        /**
+         * @brief 获取输出大小
+         * @param out 输出缓冲
+         * @return 输出大小，不支持时为0
+         */
+        static std::size_t size_of(const Out& out) noexcept
+        {
+            if constexpr (requires { out.size(); })
+            {
+                return out.size();
+            }
+            return 0;
+        }
+        /**
+         * @brief 获取输出容量
+         * @param out 输出缓冲
+         * @return 输出容量，不支持时为0
+         */
+        static std::size_t capacity_of(const Out& out) noexcept
+        {
+            if constexpr (requires { out.capacity(); })
+            {
+                return out.capacity();
+            }
+            return 0;
+        }
+    private:
+        /// @brief 分支
+        StringifyBranch m_branch;
+        /// @brief 输出缓冲
+        const Out& m_out;
+        /// @brief 起始大小
+        std::size_t m_start_size = 0;
+        /// @brief 起始容量
+        std::size_t m_start_capacity = 0;
+        /// @brief 起始时间
+        std::chrono::steady_clock::time_point m_start_time;
+    };
+    /// @brief 在当前作用域记录分支统计
+#define DANEJOE_STRINGIFY_STATS_SCOPE(branch, out) \
+    ::DaneJoe::StringifyStatsScope<std::remove_cv_t<std::remove_reference_t<decltype(out)>>> \
+        danejoe_stringify_stats_scope((branch), (out))
+#else
+    /// @brief 统计未启用，展开为空
+#define DANEJOE_STRINGIFY_STATS_SCOPE(branch, out) ((void)0)
+#endif
+}
@@ -0,0 +1,325 @@
+/**
+ * @file stringify_strided.hpp
+ * @brief 多维跨步视图的字符串化
+ * @author DaneJoe001
+ * @version 0.2.0
+ * @date 2026-10-18
+ * @details StridedView以数据指针、各维长度与各维步长描述一块多维内存，
+ *          按行嵌套输出为[[a, b], [c, d]]，不复制数据；每一维按
+ *          max_stringify_dimension_element_count截断，超出部分以省略号表示，
+ *          因此大矩阵只遍历输出的预览部分。
+ * @note std::span经容器分支输出；标准库提供std::mdspan时可经make_strided_view转换
+ */
+#pragma once
+
+#include <array>
+#include <limits>
+#include <utility>
+#include <cstddef>
+#include <type_traits>
+#include <version>
+
+#if defined(__cpp_lib_mdspan)
+#include <mdspan>
+#endif
+
+#include "danejoe/stringify/stringify_config.hpp"
+#include "danejoe/stringify/stringify_traits.hpp"
+#include "danejoe/stringify/stringify_append.hpp"
+
+ /**
+  * @namespace DaneJoe
+  * @brief DaneJoe 命名空间
+  */
+namespace DaneJoe
+{
+    /**
+     * @brief 获取多维视图某一维的最大输出元素数量
+     * @param config 配置
+     * @param dimension 维度，0为最外层
+     * @return 最大输出元素数量，不限制时为std::size_t的最大值
+     */
+    inline std::size_t get_dimension_element_limit(const StringifyConfig& config, std::size_t dimension)
+    {
+        int limit = config.max_stringify_element_count;
+        if (dimension < config.max_stringify_dimension_element_count.size() &&
+            config.max_stringify_dimension_element_count[dimension] >= 0)
+        {
+            limit = config.max_stringify_dimension_element_count[dimension];
+        }
+        return limit < 0 ? std::numeric_limits<std::size_t>::max() : static_cast<std::size_t>(limit);
+    }
+    /**
+     * @brief 输出一行元素
+     * @tparam Out 输出类型
+     * @tparam T 元素类型
+     * @param out 输出
+     * @param first 首元素
+     * @param extent 行长度
+     * @param stride 元素步长
+     * @param limit 最大输出元素数量
+     * @param config 配置
+     * @note 步长为1时按连续内存逐个指针遍历
+     */
+    template<class Out, class T>
+    void append_strided_row(Out& out, const T* first, std::size_t extent, std::ptrdiff_t stride,
+        std::size_t limit, const StringifyConfig& config)
+    {
+        const DelimiterSymbol& symbol = config.container_symbol;
+        const std::size_t count = extent < limit ? extent : limit;
+        append_text(out, symbol.start_maker);
+        if (stride == 1)
+        {
+            for (const T* current = first, *last = first + count; current != last; ++current)
+            {
+                if constexpr (has_exhausted<Out>::value)
+                {
+                    if (out.exhausted())
+                    {
+                        break;
+                    }
+                }
+                if (current != first)
+                {
+                    append_text(out, symbol.element_separator);
+                    append_text(out, symbol.space_maker);
+                }
+                append_to_string(out, *current, config);
+            }
+        }
+        else
+        {
+            // 只在元素之间前移，不形成越过末元素的指针
+            const T* current = first;
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                if constexpr (has_exhausted<Out>::value)
+                {
+                    if (out.exhausted())
+                    {
+                        break;
+                    }
+                }
+                if (i != 0)
+                {
+                    current += stride;
+                    append_text(out, symbol.element_separator);
+                    append_text(out, symbol.space_maker);
+                }
+                append_to_string(out, *current, config);
+            }
+        }
+        if (count < extent)
+        {
+            if (count != 0)
+            {
+                append_text(out, symbol.element_separator);
+                append_text(out, symbol.space_maker);
+            }
+            append_text(out, config.ellipsis_symbol);
+        }
+        append_text(out, symbol.end_maker);
+    }
+    /**
+     * @brief 从指定维度开始按行嵌套输出
+     * @tparam Dimension 当前维度
+     * @tparam Rank 维数
+     * @tparam Out 输出类型
+     * @tparam T 元素类型
+     * @param out 输出
+     * @param first 当前子块的首元素
+     * @param extents 各维长度
+     * @param strides 各维步长
+     * @param config 配置
+     */
+    template<std::size_t Dimension, std::size_t Rank, class Out, class T>
+    void append_strided_dimension(Out& out, const T* first, const std::array<std::size_t, Rank>& extents,
+        const std::array<std::ptrdiff_t, Rank>& strides, const StringifyConfig& config)
+    {
+        const std::size_t limit = get_dimension_element_limit(config, Dimension);
+        if constexpr (Dimension + 1 == Rank)
+        {
+            append_strided_row(out, first, extents[Dimension], strides[Dimension], limit, config);
+        }
+        else
+        {
+            const DelimiterSymbol& symbol = config.container_symbol;
+            const std::size_t extent = extents[Dimension];
+            const std::size_t count = extent < limit ? extent : limit;
+            append_text(out, symbol.start_maker);
+            const T* current = first;
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                if constexpr (has_exhausted<Out>::value)
+                {
+                    if (out.exhausted())
+                    {
+                        break;
+                    }
+                }
+                if (i != 0)
+                {
+                    current += strides[Dimension];
+                    append_text(out, symbol.element_separator);
+                    append_text(out, symbol.space_maker);
+                }
+                append_strided_dimension<Dimension + 1>(out, current, extents, strides, config);
+            }
+            if (count < extent)
+            {
+                if (count != 0)
+                {
+                    append_text(out, symbol.element_separator);
+                    append_text(out, symbol.space_maker);
+                }
+                append_text(out, config.ellipsis_symbol);
+            }
+            append_text(out, symbol.end_maker);
+        }
+    }
+    /**
+     * @class StridedView
+     * @brief 多维跨步视图，不持有数据
+     * @tparam T 元素类型
+     * @tparam Rank 维数
+     * @note 步长以元素为单位，可为负；行优先布局时最后一维步长为1
+     */
+    template<class T, std::size_t Rank>
+    class StridedView
+    {
+    public:
+        /**
+         * @brief 以行优先布局构造
+         * @param data 首元素
+         * @param extents 各维长度
+         */
+        StridedView(const T* data, const std::array<std::size_t, Rank>& extents) noexcept
+            : m_data(data), m_extents(extents)
+        {
+            std::ptrdiff_t stride = 1;
+            for (std::size_t i = Rank; i > 0; --i)
+            {
+                m_strides[i - 1] = stride;
+                stride *= static_cast<std::ptrdiff_t>(extents[i - 1]);
+            }
+        }
+        /**
+         * @brief 以给定步长构造
+         * @param data 首元素
+         * @param extents 各维长度
+         * @param strides 各维步长
+         */
+        StridedView(const T* data, const std::array<std::size_t, Rank>& extents,
+            const std::array<std::ptrdiff_t, Rank>& strides) noexcept
+            : m_data(data), m_extents(extents), m_strides(strides)
+        {}
+        /**
+         * @brief 获取首元素
+         * @return 首元素指针
+         */
+        const T* get_data() const noexcept
+        {
+            return m_data;
+        }
+        /**
+         * @brief 获取某一维的长度
+         * @param dimension 维度
+         * @return 长度
+         */
+        std::size_t get_extent(std::size_t dimension) const noexcept
+        {
+            return m_extents[dimension];
+        }
+        /**
+         * @brief 获取某一维的步长
+         * @param dimension 维度
+         * @return 步长
+         */
+        std::ptrdiff_t get_stride(std::size_t dimension) const noexcept
+        {
+            return m_strides[dimension];
+        }
+        /**
+         * @brief 获取维数
+         * @return 维数
+         */
+        static constexpr std::size_t get_rank() noexcept
+        {
+            return Rank;
+        }
+        /**
+         * @brief 交换前两维得到转置视图
+         * @return 转置视图，不复制数据
+         */
+        template<std::size_t R = Rank, std::enable_if_t<(R >= 2), int> = 0>
+        StridedView get_transposed() const noexcept
+        {
+            StridedView view = *this;
+            std::swap(view.m_extents[0], view.m_extents[1]);
+            std::swap(view.m_strides[0], view.m_strides[1]);
+            return view;
+        }
+        /**
+         * @brief 按行嵌套输出视图
+         * @tparam Out 输出类型
+         * @param writer 写入器
+         * @param view 视图
+         */
+        template<class Out>
+        friend void stringify_append(StringifyWriter<Out>& writer, const StridedView& view)
+        {
+            if constexpr (Rank == 0)
+            {
+                writer.write(*view.m_data);
+            }
+            else
+            {
+                append_strided_dimension<0>(writer.get_output(), view.m_data,
+                    view.m_extents, view.m_strides, writer.get_config());
+            }
+        }
+    private:
+        /// @brief 首元素
+        const T* m_data;
+        /// @brief 各维长度
+        std::array<std::size_t, Rank> m_extents{};
+        /// @brief 各维步长
+        std::array<std::ptrdiff_t, Rank> m_strides{};
+    };
+    /**
+     * @brief 以行优先布局创建视图
+     * @tparam T 元素类型
+     * @tparam Extents 长度类型
+     * @param data 首元素
+     * @param extents 各维长度
+     * @return 视图
+     */
+    template<class T, class... Extents>
+    StridedView<T, sizeof...(Extents)> make_strided_view(const T* data, Extents... extents) noexcept
+    {
+        return StridedView<T, sizeof...(Extents)>(data, { static_cast<std::size_t>(extents)... });
+    }
+#if defined(__cpp_lib_mdspan)
+    /**
+     * @brief 由std::mdspan创建视图
+     * @tparam T 元素类型
+     * @tparam Extents 长度类型
+     * @tparam Layout 布局
+     * @param value mdspan，须为default_accessor
+     * @return 视图
+     */
+    template<class T, class Extents, class Layout>
+    StridedView<std::remove_const_t<T>, Extents::rank()> make_strided_view(
+        const std::mdspan<T, Extents, Layout, std::default_accessor<T>>& value)
+    {
+        std::array<std::size_t, Extents::rank()> extents{};
+        std::array<std::ptrdiff_t, Extents::rank()> strides{};
+        for (std::size_t i = 0; i < Extents::rank(); ++i)
+        {
+            extents[i] = static_cast<std::size_t>(value.extent(i));
+            strides[i] = static_cast<std::ptrdiff_t>(value.stride(i));
+        }
+        return StridedView<std::remove_const_t<T>, Extents::rank()>(value.data_handle(), extents, strides);
+    }
+#endif
+}
@@ -0,0 +1,276 @@
+/**
+ * @file stringify_to.hpp
+ * @brief 定长缓冲字符串化
+ * @author DaneJoe001
+ * @version 0.2.0
+ * @date 2026-10-18
+ * @details 类似std::to_chars：直接写入调用方提供的[first, last)缓冲，
+ *          不分配内存、不加锁、不抛出异常，可用于信号处理函数与实时线程。
+ * @note 启用DANEJOE_STRINGIFY_ENABLE_STATS时，线程首次记录统计会加锁注册计数器；
+ *       此类线程应先调用register_stringify_stats_thread。
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <type_traits>
+
+#include "danejoe/common/type_traits/std_type_traits.hpp"
+#include "danejoe/common/type_traits/container_traits.hpp"
+#include "danejoe/stringify/stringify_config.hpp"
+#include "danejoe/stringify/stringify_traits.hpp"
+#include "danejoe/stringify/stringify_append.hpp"
+#include "danejoe/stringify/stringify_format.hpp"
+
+ /**
+  * @namespace DaneJoe
+  * @brief DaneJoe 命名空间
+  */
+namespace DaneJoe
+{
+    /**
+     * @struct StringifyToResult
+     * @brief 定长缓冲字符串化结果
+     */
+    struct StringifyToResult
+    {
+        /// @brief 写入内容的结尾位置
+        char* ptr = nullptr;
+        /// @brief 是否因缓冲不足而截断
+        bool truncated = false;
+    };
+    /**
+     * @class FixedBufferWriter
+     * @brief 定长缓冲输出，满足追加引擎对输出类型的要求
+     * @note 超出容量的内容被丢弃并记录截断
+     */
+    class FixedBufferWriter
+    {
+    public:
+        /**
+         * @brief 构造函数
+         * @param first 缓冲起始位置
+         * @param last 缓冲结束位置
+         */
+        FixedBufferWriter(char* first, char* last) noexcept
+            : m_first(first), m_current(first), m_last(last)
+        {}
+        /**
+         * @brief 追加字符序列
+         * @param data 字符序列
+         * @param size 字符数量
+         */
+        void append(const char* data, std::size_t size) noexcept
+        {
+            std::size_t rest = static_cast<std::size_t>(m_last - m_current);
+            if (size > rest)
+            {
+                size = rest;
+                m_is_truncated = true;
+            }
+            if (size > 0)
+            {
+                std::memcpy(m_current, data, size);
+                m_current += size;
+            }
+        }
+        /**
+         * @brief 追加单个字符
+         * @param ch 字符
+         */
+        void push_back(char ch) noexcept
+        {
+            if (m_current == m_last)
+            {
+                m_is_truncated = true;
+                return;
+            }
+            *m_current++ = ch;
+        }
+        /**
+         * @brief 是否已写满并发生截断
+         * @return 已截断时为true
+         */
+        bool exhausted() const noexcept
+        {
+            return m_is_truncated;
+        }
+        /**
+         * @brief 已写入的字符数量
+         * @return 字符数量
+         */
+        std::size_t size() const noexcept
+        {
+            return static_cast<std::size_t>(m_current - m_first);
+        }
+        /**
+         * @brief 完成写入
+         * @param ellipsis 截断时覆盖在缓冲末尾的省略号
+         * @return 字符串化结果
+         */
+        StringifyToResult finish(std::string_view ellipsis) noexcept
+        {
+            if (m_is_truncated && ellipsis.size() <= size())
+            {
+                std::memcpy(m_current - ellipsis.size(), ellipsis.data(), ellipsis.size());
+            }
+            return { m_current, m_is_truncated };
+        }
+    private:
+        /// @brief 缓冲起始位置
+        char* m_first = nullptr;
+        /// @brief 当前写入位置
+        char* m_current = nullptr;
+        /// @brief 缓冲结束位置
+        char* m_last = nullptr;
+        /// @brief 是否发生截断
+        bool m_is_truncated = false;
+    };
+    /**
+     * @brief 判断类型能否无分配地写入定长缓冲
+     * @tparam T 类型
+     * @return 可写入时为true
+     * @note 覆盖整数、布尔、字符、枚举、字符串视图、整数计数的时长，
+     *       以及由它们组成的容器、数组、范围视图、std::pair、std::tuple、std::optional与std::variant
+     */
+    template<class T>
+    constexpr bool check_fixed_stringifiable()
+    {
+        if constexpr (has_stringify_append<T, FixedBufferWriter>::value)
+        {
+            // 自定义追加函数直接写入定长缓冲
+            return true;
+        }
+        else if constexpr (is_std_string_view<T>::value || is_basic_string<T>::value || is_c_string<T>::value ||
+            is_unicode_string<T>::value || is_unicode_c_string<T>::value || is_bit_sequence<T>::value)
+        {
+            return true;
+        }
+        else if constexpr (std::is_enum_v<T> || std::is_integral_v<T> || is_int128<T>::value)
+        {
+            return !has_member_to_string<T>::value;
+        }
+        else if constexpr (has_member_to_string<T>::value || has_std_to_string<T>::value)
+        {
+            return false;
+        }
+        else if constexpr (is_chrono_duration<T>::value)
+        {
+            return std::is_integral_v<typename T::rep>;
+        }
+        else if constexpr (is_std_pair<T>::value)
+        {
+            return check_fixed_stringifiable<std::remove_cv_t<typename T::first_type>>() &&
+                check_fixed_stringifiable<std::remove_cv_t<typename T::second_type>>();
+        }
+        else if constexpr (is_std_optional<T>::value)
+        {
+            return check_fixed_stringifiable<std::remove_cv_t<typename T::value_type>>();
+        }
+        else if constexpr (is_std_variant<T>::value || is_std_tuple<T>::value)
+        {
+            return []<template<class...> class Holder, class... Args>(const Holder<Args...>*)
+            {
+                return (check_fixed_stringifiable<std::remove_cv_t<Args>>() && ...);
+            }(static_cast<const T*>(nullptr));
+        }
+        else if constexpr (has_iterator<T>::value || is_c_array<T>::value)
+        {
+            using Element = std::remove_cv_t<std::remove_reference_t<
+                decltype(*std::begin(std::declval<const T&>()))>>;
+            return check_fixed_stringifiable<Element>();
+        }
+        else if constexpr (is_input_range<T>::value)
+        {
+            return check_fixed_stringifiable<std::remove_cvref_t<std::ranges::range_reference_t<T>>>();
+        }
+        else
+        {
+            return false;
+        }
+    }
+    /**
+     * @brief 判断类型能否无分配地写入定长缓冲
+     * @tparam T 类型
+     */
+    template<class T>
+    struct is_fixed_stringifiable : std::bool_constant<check_fixed_stringifiable<T>()> {};
+    /**
+     * @brief 将变量写入定长缓冲
+     * @tparam T 类型，须满足is_fixed_stringifiable
+     * @param first 缓冲起始位置
+     * @param last 缓冲结束位置
+     * @param value 变量
+     * @param config 配置
+     * @return 写入结尾位置与是否截断；截断时末尾以省略号覆盖
+     * @note 不以'\0'结尾
+     */
+    template<class T>
+    StringifyToResult stringify_to(char* first, char* last, const T& value,
+        const StringifyConfig& config) noexcept
+    {
+        static_assert(is_fixed_stringifiable<T>::value,
+            "stringify_to: type may allocate, use to_string instead");
+        FixedBufferWriter writer(first, last);
+        append_to_string(writer, value, config);
+        return writer.finish(config.ellipsis_symbol);
+    }
+    /**
+     * @brief 使用默认配置将变量写入定长缓冲
+     * @tparam T 类型，须满足is_fixed_stringifiable
+     * @param first 缓冲起始位置
+     * @param last 缓冲结束位置
+     * @param value 变量
+     * @return 写入结尾位置与是否截断
+     * @note 不读取StringifyConfigManager的全局配置，因而不加锁
+     */
+    template<class T>
+    StringifyToResult stringify_to(char* first, char* last, const T& value) noexcept
+    {
+        return stringify_to(first, last, value, StringifyConfigManager::get_default_config());
+    }
+    /**
+     * @brief 将容量大小写入定长缓冲
+     * @param first 缓冲起始位置
+     * @param last 缓冲结束位置
+     * @param size 容量大小(Bytes)
+     * @param dest_unit 目标单位
+     * @param precision 精度，超过64时按64处理
+     * @param config 配置
+     * @return 写入结尾位置与是否截断
+     */
+    inline StringifyToResult format_capacity_size_to(
+        char* first,
+        char* last,
+        uint64_t size,
+        StorageUnit dest_unit,
+        std::size_t precision,
+        const StringifyConfig& config) noexcept
+    {
+        FixedBufferWriter writer(first, last);
+        // 限制精度以保证浮点格式化始终落在栈缓冲内
+        append_capacity_size(writer, size, dest_unit, precision < 64 ? precision : 64, config);
+        return writer.finish(config.ellipsis_symbol);
+    }
+    /**
+     * @brief 使用默认配置将容量大小写入定长缓冲
+     * @param first 缓冲起始位置
+     * @param last 缓冲结束位置
+     * @param size 容量大小(Bytes)
+     * @param dest_unit 目标单位
+     * @param precision 精度
+     * @return 写入结尾位置与是否截断
+     */
+    inline StringifyToResult format_capacity_size_to(
+        char* first,
+        char* last,
+        uint64_t size,
+        StorageUnit dest_unit,
+        std::size_t precision = 0) noexcept
+    {
+        return format_capacity_size_to(first, last, size, dest_unit, precision,
+            StringifyConfigManager::get_default_config());
+    }
+}
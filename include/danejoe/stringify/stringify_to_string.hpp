@@ -7,6 +7,7 @@
  */
 #pragma once
 
+#include <any>
 #include <string>
 #include <chrono>
 #include <ctime>
@@ -18,11 +19,13 @@
 #include <iomanip>
 #include <string_view>
 #include <type_traits>
+#include <memory_resource>
 
 #include "danejoe/common/type_traits/std_type_traits.hpp"
 #include "danejoe/common/type_traits/container_traits.hpp"
 #include "danejoe/stringify/stringify_config.hpp"
 #include "danejoe/stringify/stringify_traits.hpp"
+#include "danejoe/stringify/stringify_append.hpp"
 
  /// @brief 将变量并转为字符串
 #define VARIABLE_NAME_TO_STRING(x) #x
@@ -77,6 +80,21 @@ namespace DaneJoe
     {
         return std::string(value);
     }
+    /**
+     * @brief 尝试将宽字符或Unicode字符串转为UTF-8字符串
+     * @tparam T 类型
+     * @param value 对象
+     * @return UTF-8字符串，非法序列替换为U+FFFD
+     */
+    template<class T, std::enable_if_t<
+        is_unicode_string<T>::value, int> = 0>
+    std::string from_unicode_string(const T& value)
+    {
+        std::string result;
+        result.reserve(value.size());
+        append_utf8(result, value.data(), value.size());
+        return result;
+    }
     /**
      * @brief 尝试将枚举转为字符串
      * @tparam T 类型
@@ -87,15 +105,9 @@ namespace DaneJoe
         std::is_enum<T>::value, int> = 0>
     std::string from_enum(const T& value)
     {
-        using U = typename std::underlying_type<T>::type;
-        std::ostringstream oss;
-        oss << StringifyConfigManager::get_config().enum_symbol.type_symbol.start_maker <<
-            std::string(typeid(value).name()) <<
-            StringifyConfigManager::get_config().enum_symbol.type_symbol.end_maker <<
-            StringifyConfigManager::get_config().enum_symbol.value_symbol.start_maker <<
-            std::to_string(static_cast<U>(value)) <<
-            StringifyConfigManager::get_config().enum_symbol.value_symbol.end_maker;
-        return oss.str();
+        std::string result;
+        append_enum(result, value, *StringifyConfigManager::get_config_snapshot());
+        return result;
     }
     /**
      * @brief 尝试将字符转为字符串
@@ -110,6 +122,20 @@ namespace DaneJoe
     {
         return std::string(1, static_cast<char>(value));
     }
+    /**
+     * @brief 尝试将宽字符或Unicode字符转为UTF-8字符串
+     * @tparam T 类型
+     * @param value 对象
+     * @return UTF-8字符串
+     */
+    template<class T, std::enable_if_t<
+        is_unicode_char<T>::value, int> = 0>
+    std::string from_unicode_char(const T& value)
+    {
+        std::string result;
+        append_unicode_char(result, value);
+        return result;
+    }
     /**
      * @brief 尝试将布尔转为字符串
      * @tparam T 类型
@@ -120,9 +146,23 @@ namespace DaneJoe
         std::is_same<T, bool>::value, int> = 0>
     std::string from_bool(const T& value)
     {
-        return value ?
-            StringifyConfigManager::get_config().bool_symbol.true_symbol :
-            StringifyConfigManager::get_config().bool_symbol.false_symbol;
+        std::string result;
+        append_bool(result, value, *StringifyConfigManager::get_config_snapshot());
+        return result;
+    }
+    /**
+     * @brief 尝试将位序列转为字符串
+     * @tparam T 类型，std::vector<bool>、std::bitset或BitSpan
+     * @param value 对象
+     * @return 尝试转换后的字符串
+     */
+    template<class T, std::enable_if_t<
+        is_bit_sequence<T>::value, int> = 0>
+    std::string from_bit_sequence(const T& value)
+    {
+        std::string result;
+        append_bit_sequence(result, value, *StringifyConfigManager::get_config_snapshot());
+        return result;
     }
     /**
      * @brief 尝试将std::chrono::duration转为字符串
@@ -134,25 +174,9 @@ namespace DaneJoe
         is_chrono_duration<Period>::value, int> = 0>
     std::string format_time_duration(const Period& period)
     {
-        std::ostringstream oss;
-        oss << period.count();
-        if constexpr (is_chrono_microseconds<Period>::value)
-        {
-            oss << StringifyConfigManager::get_config().time_symbol.microsecond_symbol;
-        }
-        else if constexpr (is_chrono_milliseconds<Period>::value)
-        {
-            oss << StringifyConfigManager::get_config().time_symbol.millisecond_symbol;
-        }
-        else if constexpr (is_chrono_nanoseconds<Period>::value)
-        {
-            oss << StringifyConfigManager::get_config().time_symbol.nanosecond_symbol;
-        }
-        else if constexpr (is_chrono_seconds<Period>::value)
-        {
-            oss << StringifyConfigManager::get_config().time_symbol.second_symbol;
-        }
-        return oss.str();
+        std::string result;
+        append_time_duration(result, period, *StringifyConfigManager::get_config_snapshot());
+        return result;
     }
     /**
      * @brief 尝试将std::chrono::time_point转为字符串
@@ -165,24 +189,9 @@ namespace DaneJoe
         is_chrono_time_point<Period>::value, int> = 0>
     std::string format_time_point(const Period& period, const std::string& format = "%Y-%m-%d %H:%M:%S")
     {
-        std::time_t raw_time_t = std::chrono::system_clock::to_time_t(period);
-        std::tm time_info;
-        std::tm* time_info_ptr = nullptr;
-#if defined(_WIN32)
-        localtime_s(&time_info, &raw_time_t); // Windows
-        time_info_ptr = &time_info;
-#elif defined(__linux__)
-        localtime_r(&raw_time_t, &time_info); // Linux
-        time_info_ptr = &time_info;
-#elif defined(__APPLE__)
-        localtime_r(&raw_time_t, &time_info); // macOS
-        time_info_ptr = &time_info;
-#else
-        time_info_ptr = std::localtime(&raw_time_t);
-#endif
-        std::ostringstream oss;
-        oss << std::put_time(time_info_ptr, format.c_str());
-        return oss.str();
+        std::string result;
+        append_time_point(result, period, format.c_str());
+        return result;
     }
     /**
      * @brief 含有std::to_string分支
@@ -191,10 +200,27 @@ namespace DaneJoe
      * @return 尝试转换后的字符串
      */
     template<class T, std::enable_if_t<
-        has_std_to_string<T>::value, int> = 0>
+        has_std_to_string<T>::value || is_int128<T>::value, int> = 0>
     std::string from_std_to_string(const T& value)
     {
-        return std::to_string(value);
+        std::string result;
+        append_std_to_string(result, value, *StringifyConfigManager::get_config_snapshot());
+        return result;
+    }
+    /**
+     * @brief 自定义追加函数分支
+     * @tparam T 类型
+     * @param value 对象
+     * @return 转换后的字符串
+     */
+    template<class T, std::enable_if_t<
+        has_stringify_append<T>::value, int> = 0>
+    std::string from_stringify_append(const T& value)
+    {
+        std::string result;
+        StringifyWriter<std::string> writer(result, *StringifyConfigManager::get_config_snapshot());
+        stringify_append(writer, value);
+        return result;
     }
     /**
      * @brief 含有to_string成员函数分支
@@ -216,22 +242,12 @@ namespace DaneJoe
      */
     template <class T, std::enable_if_t<
         has_iterator<T>::value &&
-        !std::is_same_v<T, std::string>, int> = 0>
+        !is_basic_string<T>::value, int> = 0>
     std::string from_has_iterator(const T& value)
     {
-        std::ostringstream oss;
-        oss << StringifyConfigManager::get_config().container_symbol.start_maker;
-        for (auto iter = std::begin(value); iter != std::end(value);)
-        {
-            oss << to_string(*iter);
-            if (++iter != std::end(value))
-            {
-                oss << StringifyConfigManager::get_config().container_symbol.element_separator;
-                oss << StringifyConfigManager::get_config().container_symbol.space_maker;
-            }
-        }
-        oss << StringifyConfigManager::get_config().container_symbol.end_maker;
-        return oss.str();
+        std::string result;
+        append_has_iterator(result, value, *StringifyConfigManager::get_config_snapshot());
+        return result;
     }
     /**
      * @brief 尝试将C数组转为字符串
@@ -243,24 +259,9 @@ namespace DaneJoe
     template<class T>
     std::string from_c_ptr(const T* ptr, std::size_t count)
     {
-        if (ptr == nullptr || count == 0)
-        {
-            return StringifyConfigManager::get_config().container_symbol.start_maker +
-                StringifyConfigManager::get_config().container_symbol.end_maker;
-        }
-        std::ostringstream oss;
-        oss << StringifyConfigManager::get_config().container_symbol.start_maker;
-        for (std::size_t i = 0; i < count; ++i)
-        {
-            oss << DaneJoe::to_string(*(ptr + i));
-            if (i + 1 < count)
-            {
-                oss << StringifyConfigManager::get_config().container_symbol.element_separator;
-                oss << StringifyConfigManager::get_config().container_symbol.space_maker;
-            }
-        }
-        oss << StringifyConfigManager::get_config().container_symbol.end_maker;
-        return oss.str();
+        std::string result;
+        append_c_ptr(result, ptr, count, *StringifyConfigManager::get_config_snapshot());
+        return result;
     }
     /**
      * @brief 尝试将C数组转为字符串
@@ -274,6 +275,22 @@ namespace DaneJoe
     {
         return from_c_ptr(array, N);
     }
+    /**
+     * @brief 将输入范围转为字符串
+     * @tparam Range 范围类型
+     * @param range 范围，只能非const遍历的范围须以非const引用传入
+     * @return 转换后的字符串
+     * @note 单程遍历，不物化到临时容器
+     */
+    template<class Range, std::enable_if_t<
+        is_input_range<std::remove_cvref_t<Range>>::value ||
+        is_mutable_input_range<std::remove_reference_t<Range>>::value, int> = 0>
+    std::string from_input_range(Range&& range)
+    {
+        std::string result;
+        append_input_range(result, range, *StringifyConfigManager::get_config_snapshot());
+        return result;
+    }
     /**
      * @brief 尝试将std::pair转为字符串
      * @tparam Key 键类型
@@ -285,14 +302,9 @@ namespace DaneJoe
         is_std_pair<T>::value, int> = 0>
     std::string from_std_pair(const T& pair)
     {
-        std::ostringstream oss;
-        oss << StringifyConfigManager::get_config().pair_symbol.start_maker;
-        oss << DaneJoe::to_string(pair.first);
-        oss << StringifyConfigManager::get_config().pair_symbol.element_separator +
-            StringifyConfigManager::get_config().pair_symbol.space_maker;
-        oss << DaneJoe::to_string(pair.second);
-        oss << StringifyConfigManager::get_config().pair_symbol.end_maker;
-        return oss.str();
+        std::string result;
+        append_std_pair(result, pair, *StringifyConfigManager::get_config_snapshot());
+        return result;
     }
     /**
      * @brief 尝试将std::optional转为字符串
@@ -304,14 +316,9 @@ namespace DaneJoe
         is_std_optional<T>::value, int> = 0>
     std::string from_std_optional(const T& value)
     {
-        if (value.has_value())
-        {
-            return DaneJoe::to_string(value.value());
-        }
-        else
-        {
-            return StringifyConfigManager::get_config().null_value_symbol;
-        }
+        std::string result;
+        append_std_optional(result, value, *StringifyConfigManager::get_config_snapshot());
+        return result;
     }
     /**
      * @brief 尝试将std::variant转为字符串
@@ -323,17 +330,9 @@ namespace DaneJoe
         is_std_variant<T>::value, int> = 0>
     std::string from_std_variant(const T& value)
     {
-        if (value.valueless_by_exception())
-        {
-            return StringifyConfigManager::get_config().variant_valueless_placeholder;
-        }
-        else
-        {
-            return std::visit([](const auto& arg)
-                {
-                    return DaneJoe::to_string(arg);
-                }, value);
-        }
+        std::string result;
+        append_std_variant(result, value, *StringifyConfigManager::get_config_snapshot());
+        return result;
     }
     /**
      * @brief 尝试将std::tuple转为字符串
@@ -345,24 +344,20 @@ namespace DaneJoe
         is_std_tuple<T>::value, int> = 0>
     std::string from_std_tuple(const T& value)
     {
-        std::ostringstream oss;
-        oss << StringifyConfigManager::get_config().tuple_symbol.start_maker;
-        std::apply([&](auto&&... args)
-            {
-                ((oss << DaneJoe::to_string(args) <<
-                    StringifyConfigManager::get_config().tuple_symbol.element_separator <<
-                    StringifyConfigManager::get_config().tuple_symbol.space_maker), ...);
-            }, value);
-        // 元素不为空时去掉最后一个元素分隔符
-        std::string str = oss.str();
-        if (str != StringifyConfigManager::get_config().tuple_symbol.start_maker)
-        {
-            str = str.substr(0, str.size() -
-                StringifyConfigManager::get_config().tuple_symbol.element_separator.size() -
-                StringifyConfigManager::get_config().tuple_symbol.space_maker.size());
-        }
-        str += StringifyConfigManager::get_config().tuple_symbol.end_maker;
-        return str;
+        std::string result;
+        append_std_tuple(result, value, *StringifyConfigManager::get_config_snapshot());
+        return result;
+    }
+    /**
+     * @brief 将std::any转为字符串
+     * @param value 对象
+     * @return 转换后的字符串，所含类型须已注册格式化器
+     */
+    inline std::string from_std_any(const std::any& value)
+    {
+        std::string result;
+        append_std_any(result, value, *StringifyConfigManager::get_config_snapshot());
+        return result;
     }
     /**
      * @brief 尝试将类型转为字符串
@@ -374,18 +369,25 @@ namespace DaneJoe
         has_stream_out<T>::value, int> = 0>
     std::string from_stream_out(const T& value)
     {
-        std::stringstream ss;
-        ss << value;
-        return ss.str();
+        std::string result;
+        append_stream_out(result, value);
+        return result;
     }
     /**
      * @brief 无to_string分支
      * @tparam T 类型
+     * @note 类型已在运行时注册格式化器时使用该格式化器
      */
     template<class T>
     std::string from_fallback(const T& value)
     {
-        return StringifyConfigManager::get_config().unsupported_type_place_holder;
+        auto config = StringifyConfigManager::get_config_snapshot();
+        std::string result;
+        if (!append_registered(result, &value, typeid(T), *config))
+        {
+            result = config->unsupported_type_place_holder;
+        }
+        return result;
     }
     /**
      * @brief 尝试将变量转为字符串
@@ -395,78 +397,44 @@ namespace DaneJoe
     template<class T>
     std::string to_string(const T& value)
     {
-        if constexpr (is_std_string_view<T>::value)
-        {
-            return from_std_string_view(value);
-        }
-        else if constexpr (std::is_same_v<T, std::string>)
-        {
-            return from_std_string(value);
-        }
-        else if constexpr (is_c_string<T>::value)
-        {
-            return from_c_string(value);
-        }
-        else if constexpr (std::is_enum_v<T>)
-        {
-            return from_enum(value);
-        }
-        else if constexpr (std::is_same_v<T, char> || std::is_same_v<T, unsigned char>)
-        {
-            return from_char(value);
-        }
-        else if constexpr (std::is_same_v<T, bool>)
-        {
-            return from_bool(value);
-        }
-        else if constexpr (has_member_to_string<T>::value)
-        {
-            return from_member_to_string(value);
-        }
-        else if constexpr (has_std_to_string<T>::value)
-        {
-            return from_std_to_string(value);
-        }
-        else if constexpr (is_chrono_duration<T>::value)
-        {
-            return format_time_duration(value);
-        }
-        else if constexpr (is_chrono_time_point<T>::value)
-        {
-            return format_time_point(value);
-        }
-        else if constexpr (is_std_pair<T>::value)
-        {
-            return from_std_pair(value);
-        }
-        else if constexpr (is_std_optional<T>::value)
-        {
-            return from_std_optional(value);
-        }
-        else if constexpr (is_std_variant<T>::value)
-        {
-            return from_std_variant(value);
-        }
-        else if constexpr (is_std_tuple<T>::value)
-        {
-            return from_std_tuple(value);
-        }
-        else if constexpr (has_iterator<T>::value && !std::is_same_v<T, std::string>)
-        {
-            return from_has_iterator(value);
-        }
-        else if constexpr (is_c_array<T>::value)
-        {
-            return from_c_array(value);
-        }
-        else if constexpr (has_stream_out<T>::value)
-        {
-            return from_stream_out(value);
-        }
-        else
-        {
-            return from_fallback(value);
-        }
+        std::string result;
+        append_to_string(result, value, *StringifyConfigManager::get_config_snapshot());
+        return result;
+    }
+    /**
+     * @brief 将变量转为使用指定内存资源的字符串
+     * @tparam T 类型
+     * @param value 变量
+     * @param resource 内存资源
+     * @return 转换后的字符串，结果及输出的中间缓冲均由resource分配
+     * @note 例外：成员to_string返回的字符串、无序容器排序用的元素指针数组与无法比较的键的文本
+     *       仍使用全局分配
+     */
+    template<class T>
+    std::pmr::string to_string(const T& value, std::pmr::memory_resource* resource)
+    {
+        std::pmr::string result(resource);
+        append_to_string(result, value, *StringifyConfigManager::get_config_snapshot());
+        return result;
+    }
+    /**
+     * @brief 将变量转为使用指定分配器的字符串
+     * @tparam T 类型
+     * @tparam Allocator char分配器类型
+     * @param value 变量
+     * @param allocator 分配器
+     * @return 转换后的字符串，结果及输出的中间缓冲均由allocator分配
+     * @note 例外：成员to_string返回的字符串、无序容器排序用的元素指针数组与无法比较的键的文本
+     *       仍使用全局分配
+     */
+    template<class T, class Allocator, std::enable_if_t<
+        is_char_allocator<Allocator>::value, int> = 0>
+    std::basic_string<char, std::char_traits<char>, Allocator> to_string(
+        const T& value, const Allocator& allocator)
+    {
+        std::basic_string<char, std::char_traits<char>, Allocator> result(allocator);
+        append_to_string(result, value, *StringifyConfigManager::get_config_snapshot());
+        return result;
     }
     /**
      * @brief 尝试将C数组转为字符串
@@ -480,6 +448,20 @@ namespace DaneJoe
     {
         return from_c_ptr(ptr, count);
     }
+    /**
+     * @brief 将只能非const遍历的范围转为字符串，如std::generator与std::views::filter
+     * @tparam Range 范围类型
+     * @param range 范围，单程范围遍历后即耗尽
+     * @return 转换后的字符串
+     */
+    template<class Range, std::enable_if_t<
+        is_mutable_input_range<std::remove_reference_t<Range>>::value, int> = 0>
+    std::string to_string(Range&& range)
+    {
+        std::string result;
+        append_to_string(result, range, *StringifyConfigManager::get_config_snapshot());
+        return result;
+    }
     /**
      * @brief 尝试将时间点转为字符串
      * @tparam T 时间点类型
@@ -495,3 +477,6 @@ namespace DaneJoe
     }
 
 }
+
+// 常用类型的extern template声明，须在模板定义之后
+#include "danejoe/stringify/stringify_prebuilt.hpp"
@@ -7,10 +7,21 @@
  */
 #pragma once
 
+#include <array>
+#include <bitset>
+#include <vector>
+#include <ranges>
 #include <utility>
 #include <type_traits>
 #include <string>
+#include <string_view>
 #include <ostream>
+#include <cstddef>
+
+#if defined(__SIZEOF_INT128__)
+/// @brief 编译器是否提供__int128
+#define DANEJOE_STRINGIFY_HAS_INT128 1
+#endif
 
  /**
   * @namespace DaneJoe
@@ -46,6 +57,31 @@ namespace DaneJoe
     template <typename T>
     struct has_member_to_string<T,
         std::void_t<decltype(std::declval<T>().to_string())>> : std::true_type {};
+    /**
+     * @class StringifyWriter
+     * @brief 传给自定义追加函数的输出包装，定义于stringify_append.hpp
+     * @tparam Out 输出类型
+     */
+    template<class Out>
+    class StringifyWriter;
+    /**
+     * @brief 判断类型是否提供自定义追加函数
+     * @tparam T 类型
+     * @tparam Out 输出类型
+     * @note 自定义点为可经ADL找到的stringify_append(StringifyWriter<Out>&, const T&)，
+     *       通常在T所在命名空间中以template<class Out>定义，以支持所有输出类型
+     */
+    template <typename T, typename Out = std::string, typename = void>
+    struct has_stringify_append : std::false_type {};
+    /**
+     * @brief has_stringify_append的匹配分支：当stringify_append(writer, value)可调用时为true
+     * @tparam T 类型
+     * @tparam Out 输出类型
+     */
+    template <typename T, typename Out>
+    struct has_stringify_append<T, Out,
+        std::void_t<decltype(stringify_append(std::declval<StringifyWriter<Out>&>(), std::declval<const T&>()))>> :
+        std::true_type {};
     /**
      * @brief 检测类型是否支持流输出
      * @tparam T 类型
@@ -60,4 +96,265 @@ namespace DaneJoe
     template <typename T>
     struct has_stream_out<T,
         std::void_t<decltype(std::declval<std::ostream&>() << std::declval<const T&>())>> : std::true_type {};
+    /**
+     * @brief 判断类型是否为字符类型的std::basic_string（允许自定义traits与分配器）
+     * @tparam T 类型
+     * @note 用于将std::pmr::string等与std::string一样按文本处理
+     */
+    template <typename T>
+    struct is_basic_string : std::false_type {};
+    /**
+     * @brief is_basic_string的匹配分支：当T为std::basic_string<char, Traits, Allocator>时为true
+     * @tparam Traits 字符特征
+     * @tparam Allocator 分配器
+     */
+    template <typename Traits, typename Allocator>
+    struct is_basic_string<std::basic_string<char, Traits, Allocator>> : std::true_type {};
+    /**
+     * @brief 判断类型是否为char分配器
+     * @tparam Allocator 分配器类型
+     * @note is_char_allocator<Allocator>::value为true表示Allocator可用于分配char
+     */
+    template <typename Allocator, typename = void>
+    struct is_char_allocator : std::false_type {};
+    /**
+     * @brief is_char_allocator的匹配分支：当Allocator::value_type为char且可分配时为true
+     * @tparam Allocator 分配器类型
+     */
+    template <typename Allocator>
+    struct is_char_allocator<Allocator,
+        std::enable_if_t<std::is_same_v<typename Allocator::value_type, char> &&
+        std::is_same_v<decltype(std::declval<Allocator&>().allocate(std::size_t{})), char*>>> : std::true_type {};
+    /**
+     * @brief 判断输出类型是否可报告已写满
+     * @tparam Out 输出类型
+     * @note has_exhausted<Out>::value为true表示Out提供exhausted()，引擎据此提前结束遍历
+     */
+    template <typename Out, typename = void>
+    struct has_exhausted : std::false_type {};
+    /**
+     * @brief has_exhausted的匹配分支：当Out有exhausted()成员函数时为true
+     * @tparam Out 输出类型
+     */
+    template <typename Out>
+    struct has_exhausted<Out,
+        std::void_t<decltype(std::declval<const Out&>().exhausted())>> : std::true_type {};
+    /**
+     * @brief 判断类型是否为非char的字符类型
+     * @tparam T 类型
+     * @note 包括wchar_t、char8_t、char16_t与char32_t，按UTF编码转为UTF-8输出
+     */
+    template <typename T>
+    struct is_unicode_char : std::bool_constant<
+        std::is_same_v<T, wchar_t> ||
+#if defined(__cpp_char8_t)
+        std::is_same_v<T, char8_t> ||
+#endif
+        std::is_same_v<T, char16_t> ||
+        std::is_same_v<T, char32_t>> {};
+    /**
+     * @brief 判断类型是否为非char字符的std::basic_string或std::basic_string_view
+     * @tparam T 类型
+     */
+    template <typename T>
+    struct is_unicode_string : std::false_type {};
+    /**
+     * @brief is_unicode_string的std::basic_string分支
+     * @tparam CharT 字符类型
+     * @tparam Traits 字符特征
+     * @tparam Allocator 分配器
+     */
+    template <typename CharT, typename Traits, typename Allocator>
+    struct is_unicode_string<std::basic_string<CharT, Traits, Allocator>> : is_unicode_char<CharT> {};
+    /**
+     * @brief is_unicode_string的std::basic_string_view分支
+     * @tparam CharT 字符类型
+     * @tparam Traits 字符特征
+     */
+    template <typename CharT, typename Traits>
+    struct is_unicode_string<std::basic_string_view<CharT, Traits>> : is_unicode_char<CharT> {};
+    /**
+     * @brief 判断类型是否为指向非char字符的C字符串
+     * @tparam T 类型
+     * @note 数组按退化后的指针判断，与is_c_string一致
+     */
+    template <typename T>
+    struct is_unicode_c_string : std::bool_constant<
+        std::is_pointer_v<std::decay_t<T>> &&
+        is_unicode_char<std::remove_cv_t<std::remove_pointer_t<std::decay_t<T>>>>::value> {};
+    /**
+     * @brief 判断类型是否支持operator<
+     * @tparam T 类型
+     */
+    template <typename T, typename = void>
+    struct has_less_than : std::false_type {};
+    /**
+     * @brief has_less_than的匹配分支：当a < b可转换为bool时为true
+     * @tparam T 类型
+     */
+    template <typename T>
+    struct has_less_than<T, std::enable_if_t<std::is_convertible_v<
+        decltype(std::declval<const T&>() < std::declval<const T&>()), bool>>> : std::true_type {};
+    /**
+     * @brief 判断类型是否支持operator==
+     * @tparam T 类型
+     */
+    template <typename T, typename = void>
+    struct has_equal_to : std::false_type {};
+    /**
+     * @brief has_equal_to的匹配分支：当a == b可转换为bool时为true
+     * @tparam T 类型
+     */
+    template <typename T>
+    struct has_equal_to<T, std::enable_if_t<std::is_convertible_v<
+        decltype(std::declval<const T&>() == std::declval<const T&>()), bool>>> : std::true_type {};
+    /**
+     * @brief 判断类型是否为std::array
+     * @tparam T 类型
+     */
+    template <typename T>
+    struct is_std_array : std::false_type {};
+    /**
+     * @brief is_std_array的匹配分支
+     * @tparam Element 元素类型
+     * @tparam N 元素个数
+     */
+    template <typename Element, std::size_t N>
+    struct is_std_array<std::array<Element, N>> : std::true_type {};
+    /**
+     * @brief 判断类型是否为std::bitset
+     * @tparam T 类型
+     */
+    template <typename T>
+    struct is_std_bitset : std::false_type {};
+    /**
+     * @brief is_std_bitset的匹配分支
+     * @tparam N 位数
+     */
+    template <std::size_t N>
+    struct is_std_bitset<std::bitset<N>> : std::true_type {};
+    /**
+     * @brief 判断类型是否为std::vector<bool>（允许自定义分配器）
+     * @tparam T 类型
+     */
+    template <typename T>
+    struct is_std_vector_bool : std::false_type {};
+    /**
+     * @brief is_std_vector_bool的匹配分支
+     * @tparam Allocator 分配器类型
+     */
+    template <typename Allocator>
+    struct is_std_vector_bool<std::vector<bool, Allocator>> : std::true_type {};
+    /**
+     * @brief 判断类型能否经const引用按输入范围遍历
+     * @tparam T 类型
+     * @note 覆盖std::views::transform、iota等无iterator成员类型的视图；
+     *       filter等只能非const遍历的视图须可复制，遍历时复制视图本身，不复制元素
+     */
+    template <typename T>
+    struct is_input_range : std::bool_constant<
+        std::ranges::input_range<const T> ||
+        (std::ranges::view<T> && std::ranges::input_range<T> && std::copy_constructible<T>)> {};
+    /**
+     * @brief 判断类型是否只能非const遍历
+     * @tparam T 类型
+     * @note 如std::generator与std::views::filter，须以非const引用传入to_string
+     */
+    template <typename T>
+    struct is_mutable_input_range : std::bool_constant<
+        std::ranges::input_range<T> && !std::ranges::input_range<const T>> {};
+    /**
+     * @brief 判断类型是否为char字符串（std::basic_string<char>或std::string_view）
+     * @tparam T 类型
+     * @note 比较顺序与按unsigned char逐字节比较一致
+     */
+    template <typename T>
+    struct is_narrow_std_string : std::false_type {};
+    /**
+     * @brief is_narrow_std_string的std::basic_string<char>分支，含任意分配器
+     * @tparam Allocator 分配器类型
+     */
+    template <typename Allocator>
+    struct is_narrow_std_string<std::basic_string<char, std::char_traits<char>, Allocator>> : std::true_type {};
+    /**
+     * @brief is_narrow_std_string的std::string_view分支
+     */
+    template <>
+    struct is_narrow_std_string<std::string_view> : std::true_type {};
+    /**
+     * @brief 判断类型是否为无序关联容器
+     * @tparam T 类型
+     * @note 以hasher、key_equal与key_type判断，覆盖std::unordered_map/set及其multi与pmr版本
+     */
+    template <typename T, typename = void>
+    struct is_unordered_container : std::false_type {};
+    /**
+     * @brief is_unordered_container的匹配分支
+     * @tparam T 类型
+     */
+    template <typename T>
+    struct is_unordered_container<T, std::void_t<
+        typename T::hasher, typename T::key_equal, typename T::key_type>> : std::true_type {};
+    /**
+     * @brief 判断类型是否为有序关联容器（std::map、std::set等）
+     * @tparam T 类型
+     */
+    template <typename T, typename = void>
+    struct is_ordered_container : std::false_type {};
+    /**
+     * @brief is_ordered_container的匹配分支
+     * @tparam T 类型
+     */
+    template <typename T>
+    struct is_ordered_container<T, std::void_t<
+        typename T::key_compare, typename T::key_type>> : std::true_type {};
+    /**
+     * @brief 判断关联容器是否为映射（含mapped_type）
+     * @tparam T 类型
+     */
+    template <typename T, typename = void>
+    struct has_mapped_type : std::false_type {};
+    /**
+     * @brief has_mapped_type的匹配分支
+     * @tparam T 类型
+     */
+    template <typename T>
+    struct has_mapped_type<T, std::void_t<typename T::mapped_type>> : std::true_type {};
+    /**
+     * @brief 判断类型是否为128位整数
+     * @tparam T 类型
+     * @note 编译器提供__int128时（DANEJOE_STRINGIFY_HAS_INT128）覆盖__int128与unsigned __int128
+     */
+    template <typename T>
+    struct is_int128 : std::false_type {};
+#if defined(DANEJOE_STRINGIFY_HAS_INT128)
+    template <>
+    struct is_int128<__int128> : std::true_type {};
+    template <>
+    struct is_int128<unsigned __int128> : std::true_type {};
+#endif
+    /**
+     * @brief 判断类型是否为按数值输出的整数（不含bool，含128位整数）
+     * @tparam T 类型
+     * @note 严格标准模式下std::is_integral不包含__int128，此处统一判断
+     */
+    template <typename T>
+    struct is_integer_value : std::bool_constant<
+        (std::is_integral_v<T> && !std::is_same_v<T, bool>) || is_int128<T>::value> {};
+    /**
+     * @brief 整数对应的无符号类型
+     * @tparam T 整数类型
+     */
+    template <typename T, typename = void>
+    struct make_unsigned_integer
+    {
+        using type = std::make_unsigned_t<T>;
+    };
+#if defined(DANEJOE_STRINGIFY_HAS_INT128)
+    template <typename T>
+    struct make_unsigned_integer<T, std::enable_if_t<is_int128<T>::value>>
+    {
+        using type = unsigned __int128;
+    };
+#endif
 }
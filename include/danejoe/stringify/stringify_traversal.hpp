@@ -0,0 +1,514 @@
+/**
+ * @file stringify_traversal.hpp
+ * @brief 迭代式字符串化遍历
+ * @author DaneJoe001
+ * @version 0.2.0
+ * @date 2026-10-18
+ * @details 容器、std::pair与std::tuple不再递归调用，而是压入堆上的显式工作栈，
+ *          嵌套深度只受内存限制而与线程栈大小无关；遍历可分段执行，
+ *          每次只产生指定字节数的输出。
+ */
+#pragma once
+
+#include <new>
+#include <tuple>
+#include <vector>
+#include <cstddef>
+#include <utility>
+#include <iterator>
+#include <type_traits>
+
+#include "danejoe/common/type_traits/std_type_traits.hpp"
+#include "danejoe/common/type_traits/container_traits.hpp"
+#include "danejoe/stringify/stringify_config.hpp"
+#include "danejoe/stringify/stringify_traits.hpp"
+#include "danejoe/stringify/stringify_append.hpp"
+
+ /**
+  * @namespace DaneJoe
+  * @brief DaneJoe 命名空间
+  */
+namespace DaneJoe
+{
+    /**
+     * @class StringifyTraversal
+     * @brief 基于显式工作栈的字符串化遍历
+     * @tparam Out 输出类型
+     * @note 遍历期间被字符串化的对象必须保持有效且不被修改
+     */
+    template<class Out>
+    class StringifyTraversal
+    {
+    public:
+        /**
+         * @brief 构造函数
+         * @tparam T 类型
+         * @param value 待字符串化的对象
+         * @param config 配置，须在遍历期间保持有效
+         */
+        template<class T>
+        StringifyTraversal(const T& value, const StringifyConfig& config)
+            : m_config(config)
+        {
+            Frame& frame = push_frame(&value);
+            frame.step = &step_root<T>;
+        }
+        /**
+         * @brief 析构函数
+         */
+        ~StringifyTraversal()
+        {
+            while (!m_stack.empty())
+            {
+                pop_frame();
+            }
+        }
+        StringifyTraversal(const StringifyTraversal&) = delete;
+        StringifyTraversal& operator=(const StringifyTraversal&) = delete;
+        /**
+         * @brief 执行遍历直至完成
+         * @param out 输出缓冲
+         */
+        void run(Out& out)
+        {
+            while (!m_stack.empty())
+            {
+                Frame& frame = m_stack.back();
+                frame.step(*this, out, frame);
+            }
+        }
+        /**
+         * @brief 执行遍历直至完成或本次输出达到指定字节数
+         * @param out 输出缓冲
+         * @param budget 本次输出的字节数上限（单个叶子值可能超出）
+         * @return 遍历是否已完成
+         */
+        bool run(Out& out, std::size_t budget)
+        {
+            const std::size_t start_size = out.size();
+            while (!m_stack.empty() && out.size() - start_size < budget)
+            {
+                Frame& frame = m_stack.back();
+                frame.step(*this, out, frame);
+            }
+            return m_stack.empty();
+        }
+        /**
+         * @brief 遍历是否已完成
+         * @return 已完成时为true
+         */
+        bool is_done() const
+        {
+            return m_stack.empty();
+        }
+    private:
+        /// @brief 内联保存迭代器状态的字节数
+        static constexpr std::size_t inline_state_size = 4 * sizeof(void*);
+        /**
+         * @struct Frame
+         * @brief 工作栈帧，保持可平凡复制以便栈扩容时直接搬移
+         */
+        struct Frame
+        {
+            /// @brief 推进一步
+            void (*step)(StringifyTraversal&, Out&, Frame&) = nullptr;
+            /// @brief 释放堆上的状态，内联状态时为nullptr
+            void (*destroy)(Frame&) = nullptr;
+            /// @brief 当前对象
+            const void* object = nullptr;
+            /// @brief 阶段或已输出的元素数量
+            std::size_t index = 0;
+            /// @brief 迭代器状态
+            alignas(std::max_align_t) unsigned char storage[inline_state_size];
+        };
+        /**
+         * @struct RangeState
+         * @brief 范围遍历状态
+         * @tparam Iterator 迭代器类型
+         */
+        template<class Iterator>
+        struct RangeState
+        {
+            /// @brief 当前迭代器
+            Iterator current;
+            /// @brief 结束迭代器
+            Iterator last;
+        };
+        /**
+         * @struct SortedRangeState
+         * @brief 排序后的无序容器遍历状态，保存在堆上
+         * @tparam Element 元素类型
+         */
+        template<class Element>
+        struct SortedRangeState
+        {
+            /// @brief 迭代器类型
+            using Iterator = DereferenceIterator<typename std::vector<const Element*>::const_iterator>;
+            /// @brief 排序后的元素指针
+            std::vector<const Element*> elements;
+            /// @brief 当前迭代器
+            Iterator current;
+            /// @brief 结束迭代器
+            Iterator last;
+        };
+        /**
+         * @brief 状态能否内联保存
+         * @tparam State 状态类型
+         */
+        template<class State>
+        static constexpr bool is_inline_state =
+            sizeof(State) <= inline_state_size &&
+            alignof(State) <= alignof(std::max_align_t) &&
+            std::is_trivially_copyable_v<State>;
+        /**
+         * @brief 压入栈帧
+         * @param object 当前对象
+         * @return 新栈帧
+         */
+        Frame& push_frame(const void* object)
+        {
+            Frame& frame = m_stack.emplace_back();
+            frame.object = object;
+            return frame;
+        }
+        /**
+         * @brief 弹出栈顶帧
+         */
+        void pop_frame()
+        {
+            Frame& frame = m_stack.back();
+            if (frame.destroy != nullptr)
+            {
+                frame.destroy(frame);
+            }
+            m_stack.pop_back();
+        }
+        /**
+         * @brief 获取栈帧中的状态
+         * @tparam State 状态类型
+         * @param frame 栈帧
+         * @return 状态
+         */
+        template<class State>
+        static State& get_state(Frame& frame)
+        {
+            if constexpr (is_inline_state<State>)
+            {
+                return *std::launder(reinterpret_cast<State*>(frame.storage));
+            }
+            else
+            {
+                return **std::launder(reinterpret_cast<State**>(frame.storage));
+            }
+        }
+        /**
+         * @brief 在栈帧中构造状态
+         * @tparam State 状态类型
+         * @param frame 栈帧
+         * @param state 状态
+         */
+        template<class State>
+        static void set_state(Frame& frame, State&& state)
+        {
+            using Decayed = std::decay_t<State>;
+            if constexpr (is_inline_state<Decayed>)
+            {
+                ::new (static_cast<void*>(frame.storage)) Decayed(std::forward<State>(state));
+            }
+            else
+            {
+                ::new (static_cast<void*>(frame.storage)) Decayed*(new Decayed(std::forward<State>(state)));
+                frame.destroy = [](Frame& target)
+                    {
+                        delete *std::launder(reinterpret_cast<Decayed**>(target.storage));
+                    };
+            }
+        }
+        /**
+         * @brief 是否已达到最大深度
+         * @return 达到时为true
+         * @note 深度为当前展开的容器、std::pair与std::tuple层数
+         */
+        bool is_depth_exceeded() const
+        {
+            // 栈底为根帧，不计入深度
+            return m_config.max_depth >= 0 &&
+                m_stack.size() > static_cast<std::size_t>(m_config.max_depth);
+        }
+        /**
+         * @brief 访问一个值：复合值压栈，其余直接追加
+         * @tparam T 类型
+         * @param out 输出缓冲
+         * @param value 对象
+         * @note 可能压入新帧，调用后不得再访问调用方持有的栈帧引用
+         */
+        template<class T>
+        void visit(Out& out, const T& value)
+        {
+            // 自定义追加函数内部的嵌套值按递归方式输出
+            constexpr bool is_leaf =
+                has_stringify_append<T, Out>::value ||
+                is_bit_sequence<T>::value ||
+                is_std_string_view<T>::value ||
+                is_basic_string<T>::value ||
+                is_c_string<T>::value ||
+                is_unicode_string<T>::value ||
+                is_unicode_c_string<T>::value ||
+                std::is_enum_v<T> ||
+                std::is_arithmetic_v<T> ||
+                is_int128<T>::value ||
+                has_member_to_string<T>::value ||
+                has_std_to_string<T>::value ||
+                is_chrono_duration<T>::value ||
+                is_chrono_time_point<T>::value;
+            if constexpr (is_leaf)
+            {
+                append_to_string(out, value, m_config);
+            }
+            else if constexpr (is_std_optional<T>::value)
+            {
+                if (value.has_value())
+                {
+                    visit(out, *value);
+                }
+                else
+                {
+                    append_text(out, m_config.null_value_symbol);
+                }
+            }
+            else if constexpr (is_std_variant<T>::value)
+            {
+                if (value.valueless_by_exception())
+                {
+                    append_text(out, m_config.variant_valueless_placeholder);
+                }
+                else
+                {
+                    std::visit([&](const auto& arg)
+                        {
+                            visit(out, arg);
+                        }, value);
+                }
+            }
+            else if constexpr (is_std_pair<T>::value)
+            {
+                if (is_depth_exceeded())
+                {
+                    append_text(out, m_config.ellipsis_symbol);
+                    return;
+                }
+                append_text(out, m_config.pair_symbol.start_maker);
+                Frame& frame = push_frame(&value);
+                frame.step = &step_pair<T>;
+            }
+            else if constexpr (is_std_tuple<T>::value)
+            {
+                if (is_depth_exceeded())
+                {
+                    append_text(out, m_config.ellipsis_symbol);
+                    return;
+                }
+                append_text(out, m_config.tuple_symbol.start_maker);
+                Frame& frame = push_frame(&value);
+                frame.step = &step_tuple<T>;
+            }
+            else if constexpr (has_iterator<T>::value || is_c_array<T>::value)
+            {
+                if (is_depth_exceeded())
+                {
+                    append_text(out, m_config.ellipsis_symbol);
+                    return;
+                }
+                if constexpr (is_unordered_container<T>::value && !has_exhausted<Out>::value)
+                {
+                    if (m_config.is_sort_unordered_container && value.size() > 1)
+                    {
+                        using State = SortedRangeState<typename T::value_type>;
+                        append_text(out, m_config.container_symbol.start_maker);
+                        Frame& frame = push_frame(&value);
+                        frame.step = &step_range<typename State::Iterator, State>;
+                        set_state(frame, State{ get_sorted_elements(value, m_config), {}, {} });
+                        State& state = get_state<State>(frame);
+                        state.current = typename State::Iterator(state.elements.cbegin());
+                        state.last = typename State::Iterator(state.elements.cend());
+                        return;
+                    }
+                }
+                using Iterator = decltype(std::begin(value));
+                append_text(out, m_config.container_symbol.start_maker);
+                Frame& frame = push_frame(&value);
+                frame.step = &step_range<Iterator>;
+                set_state(frame, RangeState<Iterator>{ std::begin(value), std::end(value) });
+            }
+            else
+            {
+                append_to_string(out, value, m_config);
+            }
+        }
+        /**
+         * @brief 根帧：访问根对象后弹出
+         * @tparam T 类型
+         * @param traversal 遍历
+         * @param out 输出缓冲
+         * @param frame 栈帧
+         */
+        template<class T>
+        static void step_root(StringifyTraversal& traversal, Out& out, Frame& frame)
+        {
+            if (frame.index != 0)
+            {
+                traversal.pop_frame();
+                return;
+            }
+            frame.index = 1;
+            traversal.visit(out, *static_cast<const T*>(frame.object));
+        }
+        /**
+         * @brief 范围帧：每步输出一个元素
+         * @tparam Iterator 迭代器类型
+         * @tparam State 状态类型，含current与last
+         * @param traversal 遍历
+         * @param out 输出缓冲
+         * @param frame 栈帧
+         */
+        template<class Iterator, class State = RangeState<Iterator>>
+        static void step_range(StringifyTraversal& traversal, Out& out, Frame& frame)
+        {
+            const StringifyConfig& config = traversal.m_config;
+            auto& state = get_state<State>(frame);
+            if (state.current == state.last)
+            {
+                append_text(out, config.container_symbol.end_maker);
+                traversal.pop_frame();
+                return;
+            }
+            if (frame.index > 0)
+            {
+                append_text(out, config.container_symbol.element_separator);
+                append_text(out, config.container_symbol.space_maker);
+            }
+            if (config.max_stringify_element_count >= 0 &&
+                frame.index >= static_cast<std::size_t>(config.max_stringify_element_count))
+            {
+                append_text(out, config.ellipsis_symbol);
+                append_text(out, config.container_symbol.end_maker);
+                traversal.pop_frame();
+                return;
+            }
+            ++frame.index;
+            Iterator current = state.current++;
+            if constexpr (std::is_reference_v<decltype(*current)>)
+            {
+                traversal.visit(out, *current);
+            }
+            else
+            {
+                // 代理或按值返回的元素无法跨步保存，直接递归追加
+                append_to_string(out, *current, config);
+            }
+        }
+        /**
+         * @brief std::pair帧
+         * @tparam T 键值对类型
+         * @param traversal 遍历
+         * @param out 输出缓冲
+         * @param frame 栈帧
+         */
+        template<class T>
+        static void step_pair(StringifyTraversal& traversal, Out& out, Frame& frame)
+        {
+            const StringifyConfig& config = traversal.m_config;
+            const T& pair = *static_cast<const T*>(frame.object);
+            switch (frame.index++)
+            {
+            case 0:
+                traversal.visit(out, pair.first);
+                break;
+            case 1:
+                append_text(out, config.pair_symbol.element_separator);
+                append_text(out, config.pair_symbol.space_maker);
+                traversal.visit(out, pair.second);
+                break;
+            default:
+                append_text(out, config.pair_symbol.end_maker);
+                traversal.pop_frame();
+                break;
+            }
+        }
+        /**
+         * @brief std::tuple帧
+         * @tparam T 元组类型
+         * @param traversal 遍历
+         * @param out 输出缓冲
+         * @param frame 栈帧
+         */
+        template<class T>
+        static void step_tuple(StringifyTraversal& traversal, Out& out, Frame& frame)
+        {
+            constexpr std::size_t size = std::tuple_size_v<T>;
+            const StringifyConfig& config = traversal.m_config;
+            const std::size_t index = frame.index++;
+            if (index >= size)
+            {
+                append_text(out, config.tuple_symbol.end_maker);
+                traversal.pop_frame();
+                return;
+            }
+            if (index > 0)
+            {
+                append_text(out, config.tuple_symbol.element_separator);
+                append_text(out, config.tuple_symbol.space_maker);
+            }
+            visit_tuple_element<T>(traversal, out, *static_cast<const T*>(frame.object), index,
+                std::make_index_sequence<size>());
+        }
+        /**
+         * @brief 按运行期下标访问元组元素
+         * @tparam T 元组类型
+         * @tparam Indexes 下标序列
+         * @param traversal 遍历
+         * @param out 输出缓冲
+         * @param tuple 元组
+         * @param index 下标
+         */
+        template<class T, std::size_t... Indexes>
+        static void visit_tuple_element(StringifyTraversal& traversal, Out& out,
+            const T& tuple, std::size_t index, std::index_sequence<Indexes...>)
+        {
+            ((index == Indexes ? traversal.visit(out, std::get<Indexes>(tuple)) : void()), ...);
+        }
+    private:
+        /// @brief 配置
+        const StringifyConfig& m_config;
+        /// @brief 工作栈
+        std::vector<Frame> m_stack;
+    };
+    /**
+     * @brief 以迭代遍历方式追加对象
+     * @tparam Out 输出类型
+     * @tparam T 类型
+     * @param out 输出缓冲
+     * @param value 对象
+     * @param config 配置
+     */
+    template<class Out, class T>
+    void append_to_string_iterative(Out& out, const T& value, const StringifyConfig& config)
+    {
+        StringifyTraversal<Out> traversal(value, config);
+        traversal.run(out);
+    }
+    /**
+     * @brief 以迭代遍历方式将变量转为字符串
+     * @tparam T 类型
+     * @param value 变量
+     * @return 转换后的字符串，与to_string输出一致，并遵循max_depth
+     */
+    template<class T>
+    std::string to_string_iterative(const T& value)
+    {
+        std::string result;
+        const auto config = StringifyConfigManager::get_config_snapshot();
+        append_to_string_iterative(result, value, *config);
+        return result;
+    }
+}
@@ -0,0 +1,352 @@
+/**
+ * @file stringify_unicode.hpp
+ * @brief 宽字符与Unicode字符串转UTF-8
+ * @author DaneJoe001
+ * @version 0.2.0
+ * @date 2026-10-18
+ * @details 支持char8_t（UTF-8校验）、char16_t（UTF-16）、char32_t（UTF-32）与wchar_t
+ *          （按宽度视为UTF-16或UTF-32）。连续ASCII段按块批量收窄：
+ *          支持SSE2时每次处理16字节输入，否则以64位整数按字并行处理；
+ *          非法序列（孤立代理、超范围码点、截断或过长的UTF-8）替换为U+FFFD。
+ */
+#pragma once
+
+#include <string>
+#include <cstddef>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "danejoe/stringify/stringify_traits.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+/// @brief 是否使用SSE2收窄ASCII块
+#define DANEJOE_STRINGIFY_UNICODE_SSE2 1
+#endif
+
+ /**
+  * @namespace DaneJoe
+  * @brief DaneJoe 命名空间
+  */
+namespace DaneJoe
+{
+    /**
+     * @class Utf8Writer
+     * @brief 带栈缓冲的UTF-8输出，减少对输出缓冲的追加次数
+     * @tparam Out 输出类型
+     */
+    template<class Out>
+    class Utf8Writer
+    {
+    public:
+        /// @brief 单次批量写入的最大字节数
+        static constexpr std::size_t block_size = 16;
+
+        explicit Utf8Writer(Out& out) : m_out(out) {}
+        ~Utf8Writer()
+        {
+            flush();
+        }
+        Utf8Writer(const Utf8Writer&) = delete;
+        Utf8Writer& operator=(const Utf8Writer&) = delete;
+        /**
+         * @brief 预留空间
+         * @param size 字节数，不超过block_size
+         * @return 可写入的位置
+         */
+        char* reserve(std::size_t size)
+        {
+            if (m_size + size > sizeof(m_buffer))
+            {
+                flush();
+            }
+            return m_buffer + m_size;
+        }
+        /**
+         * @brief 提交已写入的字节
+         * @param size 字节数
+         */
+        void commit(std::size_t size)
+        {
+            m_size += size;
+        }
+        /**
+         * @brief 写入码点，非法码点写入U+FFFD
+         * @param code_point 码点
+         */
+        void put(char32_t code_point)
+        {
+            if ((code_point >= 0xD800 && code_point <= 0xDFFF) || code_point > 0x10FFFF)
+            {
+                code_point = 0xFFFD;
+            }
+            char* data = reserve(4);
+            std::size_t size = 0;
+            if (code_point < 0x80)
+            {
+                data[size++] = static_cast<char>(code_point);
+            }
+            else if (code_point < 0x800)
+            {
+                data[size++] = static_cast<char>(0xC0 | (code_point >> 6));
+                data[size++] = static_cast<char>(0x80 | (code_point & 0x3F));
+            }
+            else if (code_point < 0x10000)
+            {
+                data[size++] = static_cast<char>(0xE0 | (code_point >> 12));
+                data[size++] = static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+                data[size++] = static_cast<char>(0x80 | (code_point & 0x3F));
+            }
+            else
+            {
+                data[size++] = static_cast<char>(0xF0 | (code_point >> 18));
+                data[size++] = static_cast<char>(0x80 | ((code_point >> 12) & 0x3F));
+                data[size++] = static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+                data[size++] = static_cast<char>(0x80 | (code_point & 0x3F));
+            }
+            commit(size);
+        }
+        /**
+         * @brief 将缓冲内容追加到输出
+         */
+        void flush()
+        {
+            if (m_size != 0)
+            {
+                m_out.append(m_buffer, m_size);
+                m_size = 0;
+            }
+        }
+    private:
+        /// @brief 输出
+        Out& m_out;
+        /// @brief 栈缓冲
+        char m_buffer[256];
+        /// @brief 已使用字节数
+        std::size_t m_size = 0;
+    };
+    /**
+     * @brief 若接下来的一块代码单元全为ASCII，则收窄写入
+     * @tparam Out 输出类型
+     * @tparam CharT 代码单元类型
+     * @param writer 输出
+     * @param data 代码单元
+     * @param count 剩余代码单元数
+     * @return 处理的代码单元数，不是整块ASCII时为0
+     */
+    template<class Out, class CharT>
+    std::size_t append_ascii_block(Utf8Writer<Out>& writer, const CharT* data, std::size_t count)
+    {
+        constexpr std::size_t unit_size = sizeof(CharT);
+        constexpr std::size_t block_units = Utf8Writer<Out>::block_size / (unit_size == 1 ? 1 : 2);
+        if (count < block_units)
+        {
+            return 0;
+        }
+#if defined(DANEJOE_STRINGIFY_UNICODE_SSE2)
+        const __m128i* input = reinterpret_cast<const __m128i*>(data);
+        __m128i narrowed;
+        if constexpr (unit_size == 1)
+        {
+            narrowed = _mm_loadu_si128(input);
+            if (_mm_movemask_epi8(narrowed) != 0)
+            {
+                return 0;
+            }
+        }
+        else if constexpr (unit_size == 2)
+        {
+            const __m128i units = _mm_loadu_si128(input);
+            const __m128i high = _mm_and_si128(units, _mm_set1_epi16(static_cast<short>(0xFF80)));
+            if (_mm_movemask_epi8(_mm_cmpeq_epi16(high, _mm_setzero_si128())) != 0xFFFF)
+            {
+                return 0;
+            }
+            narrowed = _mm_packus_epi16(units, units);
+        }
+        else
+        {
+            const __m128i low_units = _mm_loadu_si128(input);
+            const __m128i high_units = _mm_loadu_si128(input + 1);
+            const __m128i mask = _mm_set1_epi32(static_cast<int>(0xFFFFFF80));
+            const __m128i high = _mm_or_si128(_mm_and_si128(low_units, mask), _mm_and_si128(high_units, mask));
+            if (_mm_movemask_epi8(_mm_cmpeq_epi32(high, _mm_setzero_si128())) != 0xFFFF)
+            {
+                return 0;
+            }
+            const __m128i words = _mm_packs_epi32(low_units, high_units);
+            narrowed = _mm_packus_epi16(words, words);
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(writer.reserve(16)), narrowed);
+#else
+        // 按64位字检测最高位，全部为ASCII时逐个收窄
+        constexpr uint64_t ascii_mask =
+            unit_size == 1 ? 0x8080808080808080ull :
+            unit_size == 2 ? 0xFF80FF80FF80FF80ull : 0xFFFFFF80FFFFFF80ull;
+        uint64_t high = 0;
+        for (std::size_t offset = 0; offset < block_units * unit_size; offset += sizeof(uint64_t))
+        {
+            uint64_t word;
+            std::memcpy(&word, reinterpret_cast<const char*>(data) + offset, sizeof(word));
+            high |= word & ascii_mask;
+        }
+        if (high != 0)
+        {
+            return 0;
+        }
+        char* output = writer.reserve(block_units);
+        for (std::size_t i = 0; i < block_units; ++i)
+        {
+            output[i] = static_cast<char>(data[i]);
+        }
+#endif
+        writer.commit(block_units);
+        return block_units;
+    }
+    /**
+     * @brief 从UTF-8代码单元解码一个码点
+     * @tparam CharT 代码单元类型
+     * @param data 代码单元
+     * @param count 剩余代码单元数
+     * @param code_point 输出码点，非法序列为U+FFFD
+     * @return 消耗的代码单元数
+     */
+    template<class CharT>
+    std::size_t decode_utf8(const CharT* data, std::size_t count, char32_t& code_point)
+    {
+        const auto lead = static_cast<unsigned char>(data[0]);
+        std::size_t length = 0;
+        char32_t min_code_point = 0;
+        if (lead < 0x80)
+        {
+            code_point = lead;
+            return 1;
+        }
+        else if (lead >= 0xC2 && lead <= 0xDF)
+        {
+            length = 2;
+            code_point = lead & 0x1F;
+            min_code_point = 0x80;
+        }
+        else if (lead >= 0xE0 && lead <= 0xEF)
+        {
+            length = 3;
+            code_point = lead & 0x0F;
+            min_code_point = 0x800;
+        }
+        else if (lead >= 0xF0 && lead <= 0xF4)
+        {
+            length = 4;
+            code_point = lead & 0x07;
+            min_code_point = 0x10000;
+        }
+        else
+        {
+            code_point = 0xFFFD;
+            return 1;
+        }
+        for (std::size_t i = 1; i < length; ++i)
+        {
+            if (i >= count || (static_cast<unsigned char>(data[i]) & 0xC0) != 0x80)
+            {
+                // 截断的序列整体替换，从下一个非续字节继续
+                code_point = 0xFFFD;
+                return i;
+            }
+            code_point = (code_point << 6) | (static_cast<unsigned char>(data[i]) & 0x3F);
+        }
+        if (code_point < min_code_point || code_point > 0x10FFFF ||
+            (code_point >= 0xD800 && code_point <= 0xDFFF))
+        {
+            code_point = 0xFFFD;
+        }
+        return length;
+    }
+    /**
+     * @brief 从UTF-16代码单元解码一个码点
+     * @tparam CharT 代码单元类型
+     * @param data 代码单元
+     * @param count 剩余代码单元数
+     * @param code_point 输出码点，孤立代理为U+FFFD
+     * @return 消耗的代码单元数
+     */
+    template<class CharT>
+    std::size_t decode_utf16(const CharT* data, std::size_t count, char32_t& code_point)
+    {
+        const char32_t unit = static_cast<char16_t>(data[0]);
+        if (unit < 0xD800 || unit > 0xDFFF)
+        {
+            code_point = unit;
+            return 1;
+        }
+        if (unit <= 0xDBFF && count > 1)
+        {
+            const char32_t low = static_cast<char16_t>(data[1]);
+            if (low >= 0xDC00 && low <= 0xDFFF)
+            {
+                code_point = 0x10000 + ((unit - 0xD800) << 10) + (low - 0xDC00);
+                return 2;
+            }
+        }
+        code_point = 0xFFFD;
+        return 1;
+    }
+    /**
+     * @brief 将代码单元序列转为UTF-8追加
+     * @tparam Out 输出类型
+     * @tparam CharT 代码单元类型
+     * @param out 输出缓冲
+     * @param data 代码单元
+     * @param count 代码单元数
+     */
+    template<class Out, class CharT>
+    void append_utf8(Out& out, const CharT* data, std::size_t count)
+    {
+        static_assert(is_unicode_char<CharT>::value, "append_utf8 requires a unicode code unit type");
+        Utf8Writer<Out> writer(out);
+        std::size_t index = 0;
+        while (index < count)
+        {
+            std::size_t consumed = append_ascii_block(writer, data + index, count - index);
+            if (consumed != 0)
+            {
+                index += consumed;
+                continue;
+            }
+            // 非整块ASCII时逐个码点处理，直到下一个可能的ASCII块
+            const std::size_t block_end = std::min(count, index + Utf8Writer<Out>::block_size);
+            while (index < block_end)
+            {
+                char32_t code_point = 0;
+                if constexpr (sizeof(CharT) == 1)
+                {
+                    index += decode_utf8(data + index, count - index, code_point);
+                }
+                else if constexpr (sizeof(CharT) == 2)
+                {
+                    index += decode_utf16(data + index, count - index, code_point);
+                }
+                else
+                {
+                    code_point = static_cast<char32_t>(data[index]);
+                    ++index;
+                }
+                writer.put(code_point);
+            }
+        }
+    }
+    /**
+     * @brief 将单个字符转为UTF-8追加
+     * @tparam Out 输出类型
+     * @tparam CharT 字符类型
+     * @param out 输出缓冲
+     * @param value 字符，UTF-8与UTF-16的非独立代码单元写入U+FFFD
+     */
+    template<class Out, class CharT>
+    void append_unicode_char(Out& out, CharT value)
+    {
+        append_utf8(out, &value, 1);
+    }
+}
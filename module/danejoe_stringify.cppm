@@ -0,0 +1,164 @@
+/**
+ * @file danejoe_stringify.cppm
+ * @brief DaneJoe.Stringify 模块接口
+ * @author DaneJoe001
+ * @version 0.2.0
+ * @date 2026-10-18
+ * @details 以全局模块片段包含现有头文件，并导出公开接口；
+ *          导入方不再重复解析<sstream>、<iomanip>等标准库头与DaneJoeCommon的类型萃取。
+ * @note 宏（如VARIABLE_NAME_TO_STRING、DANEJOE_STRINGIFY_STATS_SCOPE）无法经模块导出，仍需包含头文件
+ */
+module;
+
+#include "danejoe/stringify/stringify_append.hpp"
+#include "danejoe/stringify/stringify_cache.hpp"
+#include "danejoe/stringify/stringify_capture.hpp"
+#include "danejoe/stringify/stringify_column.hpp"
+#include "danejoe/stringify/stringify_config.hpp"
+#include "danejoe/stringify/stringify_constexpr.hpp"
+#include "danejoe/stringify/stringify_csv.hpp"
+#include "danejoe/stringify/stringify_deep_size.hpp"
+#include "danejoe/stringify/stringify_diff.hpp"
+#include "danejoe/stringify/stringify_format.hpp"
+#include "danejoe/stringify/stringify_generator.hpp"
+#include "danejoe/stringify/stringify_join.hpp"
+#include "danejoe/stringify/stringify_parse.hpp"
+#include "danejoe/stringify/stringify_registry.hpp"
+#include "danejoe/stringify/stringify_stats.hpp"
+#include "danejoe/stringify/stringify_strided.hpp"
+#include "danejoe/stringify/stringify_to.hpp"
+#include "danejoe/stringify/stringify_to_string.hpp"
+#include "danejoe/stringify/stringify_traits.hpp"
+#include "danejoe/stringify/stringify_traversal.hpp"
+
+export module DaneJoe.Stringify;
+
+export namespace DaneJoe
+{
+    // 配置
+    using DaneJoe::BitFormat;
+    using DaneJoe::BoolSymbol;
+    using DaneJoe::DelimiterSymbol;
+    using DaneJoe::EnumSymbol;
+    using DaneJoe::FloatFormat;
+    using DaneJoe::IntegerBase;
+    using DaneJoe::StorageSymbol;
+    using DaneJoe::StorageUnit;
+    using DaneJoe::StringifyConfig;
+    using DaneJoe::StringifyConfigManager;
+    using DaneJoe::TimeSymbol;
+
+    // 类型萃取
+    using DaneJoe::has_member_to_string;
+    using DaneJoe::has_std_to_string;
+    using DaneJoe::has_stringify_append;
+    using DaneJoe::has_stream_out;
+    using DaneJoe::is_basic_string;
+
+    // 字符串化
+    using DaneJoe::StringifyWriter;
+    using DaneJoe::append_to_string;
+    using DaneJoe::format_time_duration;
+    using DaneJoe::format_time_point;
+    using DaneJoe::to_string;
+
+    // 格式化
+    using DaneJoe::FormatPosition;
+    using DaneJoe::format_capacity_size;
+    using DaneJoe::get_capacity_unit;
+    using DaneJoe::format_separator;
+    using DaneJoe::format_string_list;
+    using DaneJoe::format_title;
+    using DaneJoe::get_storage_unit_symbol;
+    using DaneJoe::get_storage_unit_name;
+    using DaneJoe::get_format_position_name;
+
+    // 定长缓冲
+    using DaneJoe::StringifyToResult;
+    using DaneJoe::format_capacity_size_to;
+    using DaneJoe::is_fixed_stringifiable;
+    using DaneJoe::stringify_to;
+
+    // 编译期字符串化
+    using DaneJoe::fixed_string;
+    using DaneJoe::fixed_string_v;
+    using DaneJoe::to_fixed_string;
+
+    // 列式输出
+    using DaneJoe::stringify_column;
+
+    // 位序列
+    using DaneJoe::BitSpan;
+
+    // 多维视图
+    using DaneJoe::StridedView;
+    using DaneJoe::make_strided_view;
+
+    // 差异比较
+    using DaneJoe::StringifyDiffOptions;
+    using DaneJoe::StringifyDiffer;
+    using DaneJoe::stringify_diff;
+
+    // 内存占用
+    using DaneJoe::DeepSize;
+    using DaneJoe::DeepSizeOptions;
+    using DaneJoe::DeepSizeMeasurer;
+    using DaneJoe::deep_size;
+    using DaneJoe::append_deep_size_report;
+    using DaneJoe::format_deep_size;
+
+    // 拼接与连接
+    using DaneJoe::get_stringify_size_hint;
+    using DaneJoe::append_str_cat;
+    using DaneJoe::str_cat;
+    using DaneJoe::append_join;
+    using DaneJoe::join;
+
+    // 导出CSV
+    using DaneJoe::StringifyCsvOptions;
+    using DaneJoe::StringifyCsvWriter;
+    using DaneJoe::stringify_csv;
+
+    // 迭代遍历
+    using DaneJoe::StringifyTraversal;
+    using DaneJoe::append_to_string_iterative;
+    using DaneJoe::to_string_iterative;
+
+#if defined(DANEJOE_STRINGIFY_HAS_GENERATOR)
+    // 分块生成
+    using DaneJoe::StringifyChunkGenerator;
+    using DaneJoe::stringify_chunks;
+#endif
+
+    // 解析
+    using DaneJoe::FromStringError;
+    using DaneJoe::FromStringResult;
+    using DaneJoe::FromStringStatus;
+    using DaneJoe::from_string;
+    using DaneJoe::get_from_string_error_message;
+
+    // 缓存与捕获
+    using DaneJoe::StringifyCache;
+    using DaneJoe::StringifyCacheStats;
+    using DaneJoe::StringifyCapture;
+    using DaneJoe::decode_capture_frames;
+    using DaneJoe::decode_capture_record;
+
+    // 运行时注册
+    using DaneJoe::StringifyFormatOutput;
+    using DaneJoe::StringifyFormatter;
+    using DaneJoe::StringifyFormatterRegistry;
+    using DaneJoe::has_formatter;
+    using DaneJoe::register_formatter;
+    using DaneJoe::unregister_formatter;
+
+    // 统计
+    using DaneJoe::StringifyBranch;
+    using DaneJoe::StringifyBranchStats;
+    using DaneJoe::StringifyStats;
+    using DaneJoe::get_stringify_branch_name;
+    using DaneJoe::is_stringify_stats_enabled;
+    using DaneJoe::register_stringify_stats_thread;
+    using DaneJoe::reset_stringify_stats;
+    using DaneJoe::stringify_stats;
+}
@@ -0,0 +1,122 @@
+#include <functional>
+
+#include "danejoe/stringify/stringify_cache.hpp"
+
+DaneJoe::StringifyCache::StringifyCache(std::size_t memory_budget)
+{
+    m_stats.memory_budget = memory_budget;
+    m_config_version = StringifyConfigManager::get_config_version();
+}
+
+void DaneJoe::StringifyCache::clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_index.clear();
+    m_entries.clear();
+    m_stats.entry_count = 0;
+    m_stats.memory_usage = 0;
+}
+
+DaneJoe::StringifyCacheStats DaneJoe::StringifyCache::get_stats() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_stats;
+}
+
+std::size_t DaneJoe::StringifyCache::EntryKeyHash::operator()(const EntryKey& key) const noexcept
+{
+    std::size_t address_hash = std::hash<const void*>()(key.address);
+    std::size_t type_hash = key.type.hash_code();
+    return address_hash ^ (type_hash + 0x9e3779b9 + (address_hash << 6) + (address_hash >> 2));
+}
+
+std::shared_ptr<const std::string> DaneJoe::StringifyCache::find(
+    const EntryKey& key,
+    uint64_t version,
+    uint64_t config_version)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    sync_config_version(config_version);
+    auto index_iter = m_index.find(key);
+    if (index_iter == m_index.end())
+    {
+        ++m_stats.miss_count;
+        return nullptr;
+    }
+    auto entry_iter = index_iter->second;
+    if (entry_iter->version != version)
+    {
+        // 对象已更新，旧结果不再有用
+        erase_entry(entry_iter);
+        ++m_stats.miss_count;
+        return nullptr;
+    }
+    m_entries.splice(m_entries.begin(), m_entries, entry_iter);
+    ++m_stats.hit_count;
+    return entry_iter->text;
+}
+
+void DaneJoe::StringifyCache::insert(
+    const EntryKey& key,
+    uint64_t version,
+    uint64_t config_version,
+    std::shared_ptr<const std::string> text)
+{
+    std::size_t cost = sizeof(Entry) + sizeof(std::string) + text->capacity();
+    std::lock_guard<std::mutex> lock(m_mutex);
+    sync_config_version(config_version);
+    if (config_version != m_config_version)
+    {
+        // 渲染期间配置已变化，结果已过期
+        return;
+    }
+    auto index_iter = m_index.find(key);
+    if (index_iter != m_index.end())
+    {
+        erase_entry(index_iter->second);
+    }
+    if (cost > m_stats.memory_budget)
+    {
+        return;
+    }
+    while (m_stats.memory_usage + cost > m_stats.memory_budget && !m_entries.empty())
+    {
+        erase_entry(std::prev(m_entries.end()));
+        ++m_stats.eviction_count;
+    }
+    m_entries.push_front(Entry{ key, version, std::move(text), cost });
+    m_index.emplace(key, m_entries.begin());
+    m_stats.memory_usage += cost;
+    m_stats.entry_count = m_entries.size();
+}
+
+void DaneJoe::StringifyCache::erase(const EntryKey& key)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto index_iter = m_index.find(key);
+    if (index_iter != m_index.end())
+    {
+        erase_entry(index_iter->second);
+    }
+}
+
+void DaneJoe::StringifyCache::sync_config_version(uint64_t config_version)
+{
+    if (config_version <= m_config_version)
+    {
+        return;
+    }
+    m_index.clear();
+    m_entries.clear();
+    m_stats.entry_count = 0;
+    m_stats.memory_usage = 0;
+    m_config_version = config_version;
+}
+
+void DaneJoe::StringifyCache::erase_entry(std::list<Entry>::iterator iter)
+{
+    m_stats.memory_usage -= iter->cost;
+    m_index.erase(iter->key);
+    m_entries.erase(iter);
+    m_stats.entry_count = m_entries.size();
+}
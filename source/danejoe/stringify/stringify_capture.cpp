@@ -0,0 +1,666 @@
+#include <bit>
+#include <algorithm>
+
+#include "danejoe/stringify/stringify_capture.hpp"
+#include "danejoe/stringify/stringify_append.hpp"
+
+namespace
+{
+    /// @brief 记录长度前缀类型
+    using FrameLength = uint32_t;
+
+    /// @brief 会话标识计数器
+    std::atomic<uint64_t> g_next_capture_id{ 1 };
+
+    /**
+     * @struct CaptureReader
+     * @brief 记录读取游标
+     */
+    struct CaptureReader
+    {
+        std::string_view data;
+        std::size_t offset = 0;
+
+        template<class T>
+        bool read(T& value)
+        {
+            if (data.size() - offset < sizeof(T))
+            {
+                return false;
+            }
+            std::memcpy(&value, data.data() + offset, sizeof(T));
+            offset += sizeof(T);
+            return true;
+        }
+
+        bool read_text(std::size_t size, std::string_view& text)
+        {
+            if (data.size() - offset < size)
+            {
+                return false;
+            }
+            text = data.substr(offset, size);
+            offset += size;
+            return true;
+        }
+    };
+
+    /**
+     * @struct DiscardOutput
+     * @brief 跳过超出元素数量限制的值时使用的空输出
+     */
+    struct DiscardOutput
+    {
+        void append(const char*, std::size_t) {}
+        void push_back(char) {}
+    };
+
+    /**
+     * @brief 读取并渲染一个整数或浮点数
+     * @tparam Out 输出类型
+     * @param reader 读取游标
+     * @param tag 类型标记
+     * @param out 输出
+     * @param config 配置，浮点数按其格式与精度输出
+     * @return 是否成功
+     */
+    template<class Out>
+    bool decode_number(CaptureReader& reader, DaneJoe::CaptureTag tag, Out& out,
+        const DaneJoe::StringifyConfig& config)
+    {
+        using DaneJoe::CaptureTag;
+        auto decode_integer = [&](auto value)
+            {
+                if (!reader.read(value))
+                {
+                    return false;
+                }
+                DaneJoe::append_integer(out, value, config);
+                return true;
+            };
+        auto decode_floating = [&](auto value)
+            {
+                if (!reader.read(value))
+                {
+                    return false;
+                }
+                DaneJoe::append_floating(out, value, config);
+                return true;
+            };
+        switch (tag)
+        {
+        case CaptureTag::Int8:
+            return decode_integer(int8_t(0));
+        case CaptureTag::Int16:
+            return decode_integer(int16_t(0));
+        case CaptureTag::Int32:
+            return decode_integer(int32_t(0));
+        case CaptureTag::Int64:
+            return decode_integer(int64_t(0));
+        case CaptureTag::UInt16:
+            return decode_integer(uint16_t(0));
+        case CaptureTag::UInt32:
+            return decode_integer(uint32_t(0));
+        case CaptureTag::UInt64:
+            return decode_integer(uint64_t(0));
+#if defined(DANEJOE_STRINGIFY_HAS_INT128)
+        case CaptureTag::Int128:
+            return decode_integer(static_cast<__int128>(0));
+        case CaptureTag::UInt128:
+            return decode_integer(static_cast<unsigned __int128>(0));
+#endif
+        case CaptureTag::Float:
+            return decode_floating(0.0f);
+        case CaptureTag::Double:
+            return decode_floating(0.0);
+        case CaptureTag::LongDouble:
+            return decode_floating(0.0L);
+        default:
+            return false;
+        }
+    }
+
+    /**
+     * @brief 读取并渲染一个值
+     * @tparam Out 输出类型
+     * @param reader 读取游标
+     * @param out 输出
+     * @param config 配置
+     * @return 是否成功
+     */
+    template<class Out>
+    bool decode_value(CaptureReader& reader, Out& out, const DaneJoe::StringifyConfig& config)
+    {
+        using DaneJoe::CaptureTag;
+        CaptureTag tag;
+        if (!reader.read(tag))
+        {
+            return false;
+        }
+        switch (tag)
+        {
+        case CaptureTag::Text:
+        {
+            uint32_t size = 0;
+            std::string_view text;
+            if (!reader.read(size) || !reader.read_text(size, text))
+            {
+                return false;
+            }
+            DaneJoe::append_text(out, text);
+            return true;
+        }
+        case CaptureTag::Null:
+            DaneJoe::append_text(out, config.null_value_symbol);
+            return true;
+        case CaptureTag::Valueless:
+            DaneJoe::append_text(out, config.variant_valueless_placeholder);
+            return true;
+        case CaptureTag::Unsupported:
+            DaneJoe::append_text(out, config.unsupported_type_place_holder);
+            return true;
+        case CaptureTag::Enum:
+        {
+            uint8_t is_signed = 0;
+            uint64_t raw = 0;
+            uint16_t name_size = 0;
+            std::string_view name;
+            if (!reader.read(is_signed) || !reader.read(raw) ||
+                !reader.read(name_size) || !reader.read_text(name_size, name))
+            {
+                return false;
+            }
+            DaneJoe::append_text(out, config.enum_symbol.type_symbol.start_maker);
+            DaneJoe::append_text(out, name);
+            DaneJoe::append_text(out, config.enum_symbol.type_symbol.end_maker);
+            DaneJoe::append_text(out, config.enum_symbol.value_symbol.start_maker);
+            if (is_signed != 0)
+            {
+                DaneJoe::append_integer(out, static_cast<int64_t>(raw));
+            }
+            else
+            {
+                DaneJoe::append_integer(out, raw);
+            }
+            DaneJoe::append_text(out, config.enum_symbol.value_symbol.end_maker);
+            return true;
+        }
+        case CaptureTag::Char:
+        {
+            char value = 0;
+            if (!reader.read(value))
+            {
+                return false;
+            }
+            out.push_back(value);
+            return true;
+        }
+        case CaptureTag::Bool:
+        {
+            uint8_t value = 0;
+            if (!reader.read(value))
+            {
+                return false;
+            }
+            DaneJoe::append_bool(out, value != 0, config);
+            return true;
+        }
+        case CaptureTag::Duration:
+        {
+            DaneJoe::CaptureDurationUnit unit;
+            CaptureTag count_tag;
+            if (!reader.read(unit) || !reader.read(count_tag) ||
+                !decode_number(reader, count_tag, out, config))
+            {
+                return false;
+            }
+            switch (unit)
+            {
+            case DaneJoe::CaptureDurationUnit::Second:
+                DaneJoe::append_text(out, config.time_symbol.second_symbol);
+                break;
+            case DaneJoe::CaptureDurationUnit::Millisecond:
+                DaneJoe::append_text(out, config.time_symbol.millisecond_symbol);
+                break;
+            case DaneJoe::CaptureDurationUnit::Microsecond:
+                DaneJoe::append_text(out, config.time_symbol.microsecond_symbol);
+                break;
+            case DaneJoe::CaptureDurationUnit::Nanosecond:
+                DaneJoe::append_text(out, config.time_symbol.nanosecond_symbol);
+                break;
+            default:
+                break;
+            }
+            return true;
+        }
+        case CaptureTag::TimePoint:
+        {
+            int64_t raw_time = 0;
+            if (!reader.read(raw_time))
+            {
+                return false;
+            }
+            DaneJoe::append_time_point(out,
+                std::chrono::system_clock::from_time_t(static_cast<std::time_t>(raw_time)));
+            return true;
+        }
+        case CaptureTag::Pair:
+        {
+            DaneJoe::append_text(out, config.pair_symbol.start_maker);
+            if (!decode_value(reader, out, config))
+            {
+                return false;
+            }
+            DaneJoe::append_text(out, config.pair_symbol.element_separator);
+            DaneJoe::append_text(out, config.pair_symbol.space_maker);
+            if (!decode_value(reader, out, config))
+            {
+                return false;
+            }
+            DaneJoe::append_text(out, config.pair_symbol.end_maker);
+            return true;
+        }
+        case CaptureTag::Tuple:
+        case CaptureTag::Sequence:
+        {
+            const bool is_tuple = tag == CaptureTag::Tuple;
+            const DaneJoe::DelimiterSymbol& symbol = is_tuple ? config.tuple_symbol : config.container_symbol;
+            uint32_t count = 0;
+            if (!reader.read(count))
+            {
+                return false;
+            }
+            DaneJoe::append_text(out, symbol.start_maker);
+            bool is_truncated = false;
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                if (is_truncated)
+                {
+                    // 与append_sequence一致：超出数量限制的元素只跳过
+                    DiscardOutput discard;
+                    if (!decode_value(reader, discard, config))
+                    {
+                        return false;
+                    }
+                    continue;
+                }
+                if (i != 0)
+                {
+                    DaneJoe::append_text(out, symbol.element_separator);
+                    DaneJoe::append_text(out, symbol.space_maker);
+                }
+                if (!is_tuple && config.max_stringify_element_count >= 0 &&
+                    i >= static_cast<uint32_t>(config.max_stringify_element_count))
+                {
+                    DaneJoe::append_text(out, config.ellipsis_symbol);
+                    is_truncated = true;
+                    DiscardOutput discard;
+                    if (!decode_value(reader, discard, config))
+                    {
+                        return false;
+                    }
+                    continue;
+                }
+                if (!decode_value(reader, out, config))
+                {
+                    return false;
+                }
+            }
+            DaneJoe::append_text(out, symbol.end_maker);
+            return true;
+        }
+        default:
+            return decode_number(reader, tag, out, config);
+        }
+    }
+}
+
+/**
+ * @class CaptureRing
+ * @brief 单生产者单消费者字节环形缓冲，记录以长度前缀分帧
+ */
+class DaneJoe::CaptureRing
+{
+public:
+    explicit CaptureRing(std::size_t capacity)
+        : m_buffer(std::bit_ceil(std::max<std::size_t>(capacity, 64))),
+        m_mask(m_buffer.size() - 1)
+    {}
+    /**
+     * @brief 写入一条记录（仅生产线程调用）
+     * @param record 记录
+     * @return 空间不足时为false
+     */
+    bool try_push(std::string_view record)
+    {
+        const uint64_t frame_size = sizeof(FrameLength) + record.size();
+        const uint64_t head = m_head.load(std::memory_order_relaxed);
+        if (head + frame_size - m_cached_tail > m_buffer.size())
+        {
+            m_cached_tail = m_tail.load(std::memory_order_acquire);
+            if (head + frame_size - m_cached_tail > m_buffer.size())
+            {
+                return false;
+            }
+        }
+        const FrameLength length = static_cast<FrameLength>(record.size());
+        write(head, reinterpret_cast<const char*>(&length), sizeof(length));
+        write(head + sizeof(length), record.data(), record.size());
+        m_head.store(head + frame_size, std::memory_order_release);
+        return true;
+    }
+    /**
+     * @brief 取出一条记录（仅消费线程调用）
+     * @param record 输出，不含长度前缀
+     * @return 为空时为false
+     */
+    bool try_pop(std::string& record)
+    {
+        const uint64_t tail = m_tail.load(std::memory_order_relaxed);
+        if (tail == m_cached_head)
+        {
+            m_cached_head = m_head.load(std::memory_order_acquire);
+            if (tail == m_cached_head)
+            {
+                return false;
+            }
+        }
+        FrameLength length = 0;
+        read(tail, reinterpret_cast<char*>(&length), sizeof(length));
+        record.resize(length);
+        read(tail + sizeof(length), record.data(), length);
+        m_tail.store(tail + sizeof(length) + length, std::memory_order_release);
+        return true;
+    }
+    /**
+     * @brief 标记生产线程已退出（仅生产线程调用，此后不再写入）
+     */
+    void mark_owner_exited() noexcept
+    {
+        m_is_owner_exited.store(true, std::memory_order_release);
+    }
+    /**
+     * @brief 生产线程是否已退出
+     * @return 已退出时为true，此后取空即可释放
+     */
+    bool is_owner_exited() const noexcept
+    {
+        return m_is_owner_exited.load(std::memory_order_acquire);
+    }
+private:
+    void write(uint64_t position, const char* data, std::size_t size)
+    {
+        const std::size_t offset = static_cast<std::size_t>(position & m_mask);
+        const std::size_t first_size = std::min(size, m_buffer.size() - offset);
+        std::memcpy(m_buffer.data() + offset, data, first_size);
+        std::memcpy(m_buffer.data(), data + first_size, size - first_size);
+    }
+    void read(uint64_t position, char* data, std::size_t size) const
+    {
+        const std::size_t offset = static_cast<std::size_t>(position & m_mask);
+        const std::size_t first_size = std::min(size, m_buffer.size() - offset);
+        std::memcpy(data, m_buffer.data() + offset, first_size);
+        std::memcpy(data + first_size, m_buffer.data(), size - first_size);
+    }
+private:
+    /// @brief 缓冲
+    std::vector<char> m_buffer;
+    /// @brief 下标掩码
+    const std::size_t m_mask;
+    /// @brief 写入位置，仅生产线程修改
+    alignas(64) std::atomic<uint64_t> m_head{ 0 };
+    /// @brief 生产线程缓存的读取位置
+    uint64_t m_cached_tail = 0;
+    /// @brief 读取位置，仅消费线程修改
+    alignas(64) std::atomic<uint64_t> m_tail{ 0 };
+    /// @brief 消费线程缓存的写入位置
+    uint64_t m_cached_head = 0;
+    /// @brief 生产线程是否已退出
+    std::atomic<bool> m_is_owner_exited{ false };
+};
+
+bool DaneJoe::decode_capture_record(std::string_view record, std::string& out, const StringifyConfig& config)
+{
+    CaptureReader reader{ record };
+    while (reader.offset < record.size())
+    {
+        if (!decode_value(reader, out, config))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool DaneJoe::decode_capture_frames(std::string_view data,
+    const std::function<void(std::string_view)>& callback,
+    const StringifyConfig& config)
+{
+    CaptureReader reader{ data };
+    std::string text;
+    while (reader.offset < data.size())
+    {
+        FrameLength length = 0;
+        std::string_view record;
+        if (!reader.read(length) || !reader.read_text(length, record))
+        {
+            return false;
+        }
+        text.clear();
+        if (!decode_capture_record(record, text, config))
+        {
+            return false;
+        }
+        callback(text);
+    }
+    return true;
+}
+
+std::string& DaneJoe::get_capture_scratch()
+{
+    thread_local std::string scratch;
+    return scratch;
+}
+
+DaneJoe::StringifyCapture::StringifyCapture(std::size_t ring_capacity)
+    : m_id(g_next_capture_id.fetch_add(1, std::memory_order_relaxed)),
+    m_ring_capacity(ring_capacity)
+{}
+
+DaneJoe::StringifyCapture::~StringifyCapture()
+{
+    stop_background();
+}
+
+std::size_t DaneJoe::StringifyCapture::drain(const std::function<void(std::string_view)>& callback)
+{
+    std::lock_guard<std::mutex> lock(m_drain_mutex);
+    auto config = StringifyConfigManager::get_config_snapshot();
+    std::string text;
+    std::size_t failure_count = 0;
+    const std::size_t count = pop_all([&](const std::string& record)
+        {
+            text.clear();
+            if (!decode_capture_record(record, text, *config))
+            {
+                ++failure_count;
+                return;
+            }
+            callback(text);
+        });
+    m_decode_failure_count.fetch_add(failure_count, std::memory_order_relaxed);
+    return count - failure_count;
+}
+
+std::size_t DaneJoe::StringifyCapture::drain_binary(const std::function<void(std::string_view)>& callback)
+{
+    std::lock_guard<std::mutex> lock(m_drain_mutex);
+    std::string frame;
+    return pop_all([&](const std::string& record)
+        {
+            const FrameLength length = static_cast<FrameLength>(record.size());
+            frame.assign(reinterpret_cast<const char*>(&length), sizeof(length));
+            frame.append(record);
+            callback(frame);
+        });
+}
+
+void DaneJoe::StringifyCapture::start_background(
+    std::function<void(std::string_view)> callback,
+    std::chrono::milliseconds interval)
+{
+    stop_background();
+    {
+        std::lock_guard<std::mutex> lock(m_background_mutex);
+        m_is_stopping = false;
+    }
+    m_background_thread = std::thread([this, callback = std::move(callback), interval]()
+        {
+            std::unique_lock<std::mutex> lock(m_background_mutex);
+            while (!m_is_stopping)
+            {
+                lock.unlock();
+                drain(callback);
+                lock.lock();
+                m_background_condition.wait_for(lock, interval, [this]()
+                    {
+                        return m_is_stopping;
+                    });
+            }
+            lock.unlock();
+            drain(callback);
+        });
+}
+
+void DaneJoe::StringifyCapture::stop_background()
+{
+    if (!m_background_thread.joinable())
+    {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(m_background_mutex);
+        m_is_stopping = true;
+    }
+    m_background_condition.notify_all();
+    m_background_thread.join();
+}
+
+uint64_t DaneJoe::StringifyCapture::get_dropped_count() const
+{
+    return m_dropped_count.load(std::memory_order_relaxed);
+}
+
+uint64_t DaneJoe::StringifyCapture::get_decode_failure_count() const
+{
+    return m_decode_failure_count.load(std::memory_order_relaxed);
+}
+
+std::size_t DaneJoe::StringifyCapture::get_thread_ring_count() const
+{
+    std::lock_guard<std::mutex> lock(m_ring_mutex);
+    return m_rings.size();
+}
+
+bool DaneJoe::StringifyCapture::push_record(std::string_view record)
+{
+    if (get_thread_ring().try_push(record))
+    {
+        return true;
+    }
+    m_dropped_count.fetch_add(1, std::memory_order_relaxed);
+    return false;
+}
+
+DaneJoe::CaptureRing& DaneJoe::StringifyCapture::get_thread_ring()
+{
+    /**
+     * @struct ThreadRing
+     * @brief 线程缓存条目
+     */
+    struct ThreadRing
+    {
+        /// @brief 会话标识
+        uint64_t id;
+        /// @brief 环形缓冲，所属线程存活期间由会话持有
+        CaptureRing* ring;
+        /// @brief 环形缓冲的弱引用，会话销毁后失效
+        std::weak_ptr<CaptureRing> owner;
+    };
+    /**
+     * @struct ThreadRingCache
+     * @brief 线程缓存，线程退出时标记其所有环形缓冲，供会话在取空后释放
+     */
+    struct ThreadRingCache
+    {
+        ~ThreadRingCache()
+        {
+            for (const ThreadRing& entry : entries)
+            {
+                if (std::shared_ptr<CaptureRing> ring = entry.owner.lock())
+                {
+                    ring->mark_owner_exited();
+                }
+            }
+        }
+        /// @brief 缓存条目
+        std::vector<ThreadRing> entries;
+    };
+    // 以会话标识而非地址为键，会话销毁后地址复用也不会误命中
+    thread_local ThreadRingCache thread_rings;
+    for (const ThreadRing& entry : thread_rings.entries)
+    {
+        if (entry.id == m_id)
+        {
+            return *entry.ring;
+        }
+    }
+    // 未命中时清理已销毁会话的条目，长期存活的线程不会因短期会话而无限增长
+    std::erase_if(thread_rings.entries, [](const ThreadRing& entry)
+        {
+            return entry.owner.expired();
+        });
+    auto ring = std::make_shared<CaptureRing>(m_ring_capacity);
+    {
+        std::lock_guard<std::mutex> lock(m_ring_mutex);
+        m_rings.push_back(ring);
+    }
+    thread_rings.entries.push_back(ThreadRing{ m_id, ring.get(), ring });
+    return *ring;
+}
+
+std::size_t DaneJoe::StringifyCapture::pop_all(const std::function<void(const std::string&)>& callback)
+{
+    std::vector<std::shared_ptr<CaptureRing>> rings;
+    {
+        std::lock_guard<std::mutex> lock(m_ring_mutex);
+        rings = m_rings;
+    }
+    std::size_t count = 0;
+    std::string record;
+    std::vector<CaptureRing*> exited_rings;
+    for (const auto& ring : rings)
+    {
+        // 先读退出标记再取空：标记之后所属线程不再写入，取空即为最终状态
+        const bool is_owner_exited = ring->is_owner_exited();
+        while (ring->try_pop(record))
+        {
+            callback(record);
+            ++count;
+        }
+        if (is_owner_exited)
+        {
+            exited_rings.push_back(ring.get());
+        }
+    }
+    if (!exited_rings.empty())
+    {
+        // 已退出线程的环形缓冲不再增长，释放后长期存活的会话不会随线程更替而无限增长
+        std::lock_guard<std::mutex> lock(m_ring_mutex);
+        std::erase_if(m_rings, [&](const std::shared_ptr<CaptureRing>& ring)
+            {
+                return std::find(exited_rings.begin(), exited_rings.end(), ring.get()) != exited_rings.end();
+            });
+    }
+    return count;
+}
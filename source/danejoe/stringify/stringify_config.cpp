@@ -1,6 +1,38 @@
+#include <chrono>
+
 #include "danejoe/stringify/stringify_config.hpp"
+#include "danejoe/stringify/stringify_stats.hpp"
 
-std::string DaneJoe::to_string(StorageUnit unit)
+namespace
+{
+    /**
+     * @brief 获取配置锁
+     * @param mutex 互斥锁
+     * @return 已持有的锁
+     * @note 启用统计时记录获取次数及发生等待时的耗时
+     */
+    std::unique_lock<std::mutex> lock_config(std::mutex& mutex)
+    {
+#if defined(DANEJOE_STRINGIFY_ENABLE_STATS)
+        std::unique_lock<std::mutex> lock(mutex, std::try_to_lock);
+        if (lock.owns_lock())
+        {
+            DaneJoe::record_stringify_config_lock(false, 0);
+            return lock;
+        }
+        auto start_time = std::chrono::steady_clock::now();
+        lock.lock();
+        auto elapsed = std::chrono::steady_clock::now() - start_time;
+        DaneJoe::record_stringify_config_lock(true,
+            static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()));
+        return lock;
+#else
+        return std::unique_lock<std::mutex>(mutex);
+#endif
+    }
+}
+
+std::string_view DaneJoe::get_storage_unit_name(StorageUnit unit) noexcept
 {
     switch (unit)
     {
@@ -28,6 +60,11 @@ std::string DaneJoe::to_string(StorageUnit unit)
     }
 }
 
+std::string DaneJoe::to_string(StorageUnit unit)
+{
+    return std::string(get_storage_unit_name(unit));
+}
+
 template<>
 DaneJoe::StorageUnit DaneJoe::enum_cast<DaneJoe::StorageUnit>(const std::string& enum_string)
 {
@@ -74,17 +111,40 @@ DaneJoe::StorageUnit DaneJoe::enum_cast<DaneJoe::StorageUnit>(const std::string&
     return StorageUnit::Unknown;
 }
 
-DaneJoe::StringifyConfig DaneJoe::StringifyConfigManager::m_config = {};
+std::shared_ptr<const DaneJoe::StringifyConfig> DaneJoe::StringifyConfigManager::m_config =
+std::make_shared<const DaneJoe::StringifyConfig>();
 std::mutex DaneJoe::StringifyConfigManager::m_mutex;
+const DaneJoe::StringifyConfig DaneJoe::StringifyConfigManager::m_default_config = {};
+std::atomic<uint64_t> DaneJoe::StringifyConfigManager::m_config_version{ 0 };
 
 DaneJoe::StringifyConfig DaneJoe::StringifyConfigManager::get_config()
 {
-    std::lock_guard<std::mutex> lock(m_mutex);
+    return *get_config_snapshot();
+}
+
+std::shared_ptr<const DaneJoe::StringifyConfig> DaneJoe::StringifyConfigManager::get_config_snapshot()
+{
+    auto lock = lock_config(m_mutex);
     return m_config;
 }
 
+const DaneJoe::StringifyConfig& DaneJoe::StringifyConfigManager::get_default_config() noexcept
+{
+    return m_default_config;
+}
+
+uint64_t DaneJoe::StringifyConfigManager::get_config_version() noexcept
+{
+    return m_config_version.load(std::memory_order_acquire);
+}
+
 void DaneJoe::StringifyConfigManager::set_config(const StringifyConfig& config)
 {
-    std::lock_guard<std::mutex> lock(m_mutex);
-    m_config = config;
+    auto new_config = std::make_shared<const StringifyConfig>(config);
+    {
+        auto lock = lock_config(m_mutex);
+        m_config.swap(new_config);
+        m_config_version.fetch_add(1, std::memory_order_acq_rel);
+    }
+    // 旧配置在锁外释放
 }
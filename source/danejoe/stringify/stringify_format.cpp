@@ -1,9 +1,10 @@
+#include <limits>
 #include <sstream>
 #include <iomanip>
 
 #include "danejoe/stringify/stringify_format.hpp"
 
-std::string DaneJoe::to_string(FormatPosition position)
+std::string_view DaneJoe::get_format_position_name(FormatPosition position) noexcept
 {
     switch (position)
     {
@@ -19,6 +20,11 @@ std::string DaneJoe::to_string(FormatPosition position)
     }
 }
 
+std::string DaneJoe::to_string(FormatPosition position)
+{
+    return std::string(get_format_position_name(position));
+}
+
 template<>
 DaneJoe::FormatPosition DaneJoe::enum_cast<DaneJoe::FormatPosition>(const std::string& enum_string)
 {
@@ -102,49 +108,73 @@ std::string DaneJoe::format_string_list(
     bool is_add_index,
     int begin_index)
 {
-
-    std::ostringstream oss;
+    if (list.empty())
+    {
+        return std::string();
+    }
+    const auto indent_count = static_cast<std::size_t>(space_counter);
+    // 先累计长度，序号按int的最大位数计，只分配一次
+    std::size_t size = 0;
+    for (const auto& item : list)
+    {
+        size += indent_count + item_sign.size() + item.size() + 1;
+    }
+    if (is_add_index)
+    {
+        size += list.size() * (std::numeric_limits<int>::digits10 + 2);
+    }
+    std::string result;
+    result.reserve(size);
     for (const auto& item : list)
     {
-        oss << std::string(space_counter, ' ');
+        result.append(indent_count, ' ');
         if (is_add_index)
         {
-            oss << begin_index++;
+            append_integer(result, begin_index++);
         }
-        oss << item_sign << item << "\n";
-    }
-    std::string result = oss.str();
-    if (!result.empty())
-    {
-        result.pop_back();
+        result.append(item_sign);
+        result.append(item);
+        result.push_back('\n');
     }
+    result.pop_back();
     return result;
 }
 
 std::string DaneJoe::get_storage_unit_symbol(StorageUnit unit)
+{
+    return get_storage_unit_symbol(StringifyConfigManager::get_config_snapshot()->storage_symbol, unit);
+}
+
+namespace
+{
+    /// @brief 未知单位的空符号（命名空间作用域，避免局部静态变量的初始化加锁）
+    const std::string empty_storage_symbol;
+}
+
+const std::string& DaneJoe::get_storage_unit_symbol(const StorageSymbol& symbol, StorageUnit unit) noexcept
 {
     switch (unit)
     {
     case StorageUnit::Byte:
-        return StringifyConfigManager::get_config().storage_symbol.byte_symbol;
+        return symbol.byte_symbol;
     case StorageUnit::KiloByte:
-        return StringifyConfigManager::get_config().storage_symbol.kilobyte_symbol;
+        return symbol.kilobyte_symbol;
     case StorageUnit::MegaByte:
-        return StringifyConfigManager::get_config().storage_symbol.megabyte_symbol;
+        return symbol.megabyte_symbol;
     case StorageUnit::GigaByte:
-        return StringifyConfigManager::get_config().storage_symbol.gigabyte_symbol;
+        return symbol.gigabyte_symbol;
     case StorageUnit::TeraByte:
-        return StringifyConfigManager::get_config().storage_symbol.terabyte_symbol;
+        return symbol.terabyte_symbol;
     case StorageUnit::PetaByte:
-        return StringifyConfigManager::get_config().storage_symbol.petabyte_symbol;
+        return symbol.petabyte_symbol;
     case StorageUnit::ExaByte:
-        return StringifyConfigManager::get_config().storage_symbol.exabyte_symbol;
+        return symbol.exabyte_symbol;
     case StorageUnit::ZettaByte:
-        return StringifyConfigManager::get_config().storage_symbol.zettabyte_symbol;
+        return symbol.zettabyte_symbol;
     case StorageUnit::YottaByte:
-        return StringifyConfigManager::get_config().storage_symbol.yottabyte_symbol;
+        return symbol.yottabyte_symbol;
     default:
-        return "";
+        return empty_storage_symbol;
     }
 }
 
@@ -153,38 +183,37 @@ std::string DaneJoe::format_capacity_size(
     StorageUnit dest_unit,
     std::size_t precision)
 {
+    std::string result;
+    append_capacity_size(result, size, dest_unit, precision,
+        *StringifyConfigManager::get_config_snapshot());
+    return result;
+}
 
-    std::string symbol = get_storage_unit_symbol(dest_unit);
-    auto storage_units = StringifyConfigManager::get_config().storage_units;
-    int exponent = static_cast<int>(dest_unit);
-    if (dest_unit == StorageUnit::Byte)
-    {
-        precision = 0;
-    }
-    std::ostringstream oss;
-    if (exponent <= 0)
+DaneJoe::StorageUnit DaneJoe::get_capacity_unit(uint64_t size, const StringifyConfig& config) noexcept
+{
+    if (config.storage_units <= 1)
     {
-        oss
-            << std::to_string(size)
-            << StringifyConfigManager::get_config().storage_symbol.space_maker
-            << symbol;
+        return StorageUnit::Byte;
     }
-    else
+    const auto base = static_cast<uint64_t>(config.storage_units);
+    int exponent = 0;
+    for (; size >= base && exponent < static_cast<int>(StorageUnit::YottaByte); size /= base)
     {
-        uint64_t cardinal_number = 1;
-        for (int i = 0; i < exponent; ++i)
-        {
-            cardinal_number *= storage_units;
-        }
-        double value = size / (double)cardinal_number;
-        oss
-            << std::fixed
-            << std::setprecision(precision)
-            << value
-            << StringifyConfigManager::get_config().storage_symbol.space_maker
-            << symbol;
+        ++exponent;
     }
-    return oss.str();
+    return static_cast<StorageUnit>(exponent);
+}
+
+std::pmr::string DaneJoe::format_capacity_size(
+    uint64_t size,
+    StorageUnit dest_unit,
+    std::size_t precision,
+    std::pmr::memory_resource* resource)
+{
+    std::pmr::string result(resource);
+    append_capacity_size(result, size, dest_unit, precision,
+        *StringifyConfigManager::get_config_snapshot());
+    return result;
 }
 
 #ifdef DANEJOE_STRINGIFY_FORMAT_TABLE_ENABLE
@@ -0,0 +1,28 @@
+#include "danejoe/stringify/stringify_parse.hpp"
+
+const char* DaneJoe::get_from_string_error_message(FromStringError error) noexcept
+{
+    switch (error)
+    {
+    case FromStringError::None:
+        return "no error";
+    case FromStringError::UnexpectedEnd:
+        return "unexpected end of input";
+    case FromStringError::ExpectedSymbol:
+        return "expected delimiter symbol";
+    case FromStringError::InvalidNumber:
+        return "invalid number";
+    case FromStringError::NumberOutOfRange:
+        return "number out of range";
+    case FromStringError::InvalidBool:
+        return "invalid bool";
+    case FromStringError::TypeMismatch:
+        return "enum type mismatch";
+    case FromStringError::ElementCountMismatch:
+        return "element count mismatch";
+    case FromStringError::TrailingCharacters:
+        return "trailing characters";
+    default:
+        return "";
+    }
+}
@@ -0,0 +1,10 @@
+#define DANEJOE_STRINGIFY_NO_PREBUILT
+#include "danejoe/stringify/stringify_prebuilt.hpp"
+
+/// @brief 显式实例化单个类型
+#define DANEJOE_STRINGIFY_INSTANTIATE_PREBUILT(...) \
+    template std::string DaneJoe::to_string<__VA_ARGS__>(const __VA_ARGS__&); \
+    template void DaneJoe::append_to_string<std::string, __VA_ARGS__>( \
+        std::string&, const __VA_ARGS__&, const DaneJoe::StringifyConfig&);
+
+DANEJOE_STRINGIFY_FOR_EACH_PREBUILT_TYPE(DANEJOE_STRINGIFY_INSTANTIATE_PREBUILT)
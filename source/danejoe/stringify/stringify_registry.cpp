@@ -0,0 +1,243 @@
+#include <string_view>
+
+#include "danejoe/stringify/stringify_registry.hpp"
+#include "danejoe/stringify/stringify_prebuilt.hpp"
+
+/**
+ * @struct StringifyFormatterTable
+ * @brief 开放寻址的扁平哈希表，发布后只读
+ */
+struct DaneJoe::StringifyFormatterTable
+{
+    /**
+     * @struct Slot
+     * @brief 槽位
+     */
+    struct Slot
+    {
+        /// @brief 类型，空槽为nullptr
+        const std::type_info* type = nullptr;
+        /// @brief 格式化器
+        StringifyFormatter formatter;
+    };
+    /// @brief 槽位，数量为2的幂
+    std::vector<Slot> slots;
+    /// @brief 已占用的槽位数
+    std::size_t count = 0;
+    /**
+     * @brief 线性探测定位类型所在或应插入的槽位
+     * @param type 类型
+     * @return 槽位下标
+     */
+    std::size_t probe(const std::type_info& type) const
+    {
+        const std::size_t mask = slots.size() - 1;
+        std::size_t index = type.hash_code() & mask;
+        // 装载率不超过1/2，必然存在空槽
+        while (slots[index].type != nullptr && *slots[index].type != type)
+        {
+            index = (index + 1) & mask;
+        }
+        return index;
+    }
+};
+
+namespace
+{
+    using FormatterTable = DaneJoe::StringifyFormatterTable;
+    /// @brief 最小槽位数
+    constexpr std::size_t min_slot_count = 16;
+    /**
+     * @brief 以给定容量重建表
+     * @param source 原表，可为nullptr
+     * @param count 预计的类型数量
+     * @return 新表，包含原表的全部类型
+     */
+    std::shared_ptr<FormatterTable> rebuild_table(const FormatterTable* source, std::size_t count)
+    {
+        std::size_t slot_count = min_slot_count;
+        while (slot_count < count * 2)
+        {
+            slot_count *= 2;
+        }
+        auto table = std::make_shared<FormatterTable>();
+        table->slots.resize(slot_count);
+        if (source != nullptr)
+        {
+            for (const auto& slot : source->slots)
+            {
+                if (slot.type != nullptr)
+                {
+                    table->slots[table->probe(*slot.type)] = slot;
+                    ++table->count;
+                }
+            }
+        }
+        return table;
+    }
+    /**
+     * @brief 向尚未发布的表写入格式化器
+     * @param table 表
+     * @param type 类型
+     * @param formatter 格式化器
+     */
+    void insert_formatter(FormatterTable& table, const std::type_info& type, DaneJoe::StringifyFormatter formatter)
+    {
+        auto& slot = table.slots[table.probe(type)];
+        if (slot.type == nullptr)
+        {
+            slot.type = &type;
+            ++table.count;
+        }
+        slot.formatter = std::move(formatter);
+    }
+    /**
+     * @brief 生成按编译期分发输出类型T的格式化器
+     * @tparam T 类型
+     * @return 格式化器
+     */
+    template<class T>
+    DaneJoe::StringifyFormatter make_builtin_formatter()
+    {
+        DaneJoe::StringifyFormatter formatter;
+        formatter.format = [](DaneJoe::StringifyFormatOutput& out, const void* value,
+            const DaneJoe::StringifyConfig& config)
+            {
+                // std::string输出走预编译实例，其余输出经类型擦除的引用直接写入
+                if (std::string* text = out.get_string())
+                {
+                    DaneJoe::append_to_string(*text, *static_cast<const T*>(value), config);
+                }
+                else
+                {
+                    DaneJoe::append_to_string(out, *static_cast<const T*>(value), config);
+                }
+            };
+        formatter.get_any_value = [](const std::any& value) -> const void*
+            {
+                return std::any_cast<T>(&value);
+            };
+        return formatter;
+    }
+}
+
+#if defined(__cpp_lib_atomic_shared_ptr)
+std::atomic<std::shared_ptr<const FormatterTable>> DaneJoe::StringifyFormatterRegistry::m_table;
+#else
+std::shared_ptr<const FormatterTable> DaneJoe::StringifyFormatterRegistry::m_table;
+#endif
+std::mutex DaneJoe::StringifyFormatterRegistry::m_mutex;
+
+namespace
+{
+    /**
+     * @brief 原子加载当前表
+     * @param table 当前表
+     * @return 表的快照
+     */
+    template<class Table>
+    std::shared_ptr<const FormatterTable> load_table(const Table& table)
+    {
+#if defined(__cpp_lib_atomic_shared_ptr)
+        return table.load(std::memory_order_acquire);
+#else
+        return std::atomic_load_explicit(&table, std::memory_order_acquire);
+#endif
+    }
+}
+
+std::shared_ptr<const FormatterTable> DaneJoe::StringifyFormatterRegistry::get_table()
+{
+    std::shared_ptr<const FormatterTable> table = load_table(m_table);
+    if (table != nullptr)
+    {
+        return table;
+    }
+    std::lock_guard<std::mutex> lock(m_mutex);
+    table = load_table(m_table);
+    if (table != nullptr)
+    {
+        return table;
+    }
+    // 预注册类型使std::any中的常见值无需用户注册即可输出
+    auto builtin_table = rebuild_table(nullptr, 32);
+#define DANEJOE_STRINGIFY_REGISTER_BUILTIN(...) \
+    insert_formatter(*builtin_table, typeid(__VA_ARGS__), make_builtin_formatter<__VA_ARGS__>());
+    DANEJOE_STRINGIFY_FOR_EACH_PREBUILT_TYPE(DANEJOE_STRINGIFY_REGISTER_BUILTIN)
+    DANEJOE_STRINGIFY_REGISTER_BUILTIN(const char*)
+    DANEJOE_STRINGIFY_REGISTER_BUILTIN(std::string_view)
+#undef DANEJOE_STRINGIFY_REGISTER_BUILTIN
+    table = builtin_table;
+    publish(std::move(builtin_table));
+    return table;
+}
+
+std::shared_ptr<const FormatterTable> DaneJoe::StringifyFormatterRegistry::publish(
+    std::shared_ptr<const FormatterTable> table)
+{
+#if defined(__cpp_lib_atomic_shared_ptr)
+    return m_table.exchange(std::move(table), std::memory_order_acq_rel);
+#else
+    return std::atomic_exchange_explicit(&m_table, std::move(table), std::memory_order_acq_rel);
+#endif
+}
+
+std::shared_ptr<const DaneJoe::StringifyFormatter> DaneJoe::StringifyFormatterRegistry::find(
+    const std::type_info& type)
+{
+    std::shared_ptr<const FormatterTable> table = get_table();
+    const auto& slot = table->slots[table->probe(type)];
+    if (slot.type == nullptr)
+    {
+        return nullptr;
+    }
+    // 别名构造：格式化器与所在的表共享生命周期
+    const StringifyFormatter* formatter = &slot.formatter;
+    return std::shared_ptr<const StringifyFormatter>(std::move(table), formatter);
+}
+
+void DaneJoe::StringifyFormatterRegistry::set(const std::type_info& type, StringifyFormatter formatter)
+{
+    // 先确保预注册表已安装，get_table本身也会加锁
+    get_table();
+    std::shared_ptr<const FormatterTable> old_table;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        const auto current = load_table(m_table);
+        auto table = rebuild_table(current.get(), current->count + 1);
+        insert_formatter(*table, type, std::move(formatter));
+        old_table = publish(std::move(table));
+    }
+    // 旧表在锁外释放，仍在使用的读者持有各自的引用
+}
+
+bool DaneJoe::StringifyFormatterRegistry::remove(const std::type_info& type)
+{
+    // 先确保预注册表已安装，get_table本身也会加锁
+    get_table();
+    std::shared_ptr<const FormatterTable> old_table;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        const auto current = load_table(m_table);
+        if (current->slots[current->probe(type)].type == nullptr)
+        {
+            return false;
+        }
+        // 线性探测下直接清空槽位会截断探测链，因此跳过该类型重建
+        auto table = rebuild_table(nullptr, current->count);
+        for (const auto& slot : current->slots)
+        {
+            if (slot.type != nullptr && *slot.type != type)
+            {
+                insert_formatter(*table, *slot.type, slot.formatter);
+            }
+        }
+        old_table = publish(std::move(table));
+    }
+    return true;
+}
+
+std::size_t DaneJoe::StringifyFormatterRegistry::size()
+{
+    return get_table()->count;
+}
@@ -0,0 +1,278 @@
+#include <atomic>
+#include <mutex>
+
+#include "danejoe/stringify/stringify_stats.hpp"
+
+namespace
+{
+    /// @brief 分支数量
+    constexpr std::size_t branch_count = static_cast<std::size_t>(DaneJoe::StringifyBranch::Count);
+
+    /**
+     * @struct BranchCounters
+     * @brief 单个分支的线程计数器
+     */
+    struct BranchCounters
+    {
+        std::atomic<uint64_t> call_count{ 0 };
+        std::atomic<uint64_t> output_bytes{ 0 };
+        std::atomic<uint64_t> nanoseconds{ 0 };
+        std::atomic<uint64_t> growth_call_count{ 0 };
+    };
+
+    /**
+     * @struct ThreadCounters
+     * @brief 线程计数器，仅由所属线程写入，汇总时由其他线程读取
+     */
+    struct ThreadCounters
+    {
+        std::array<BranchCounters, branch_count> branches;
+        std::atomic<uint64_t> config_lock_count{ 0 };
+        std::atomic<uint64_t> config_lock_wait_count{ 0 };
+        std::atomic<uint64_t> config_lock_wait_nanoseconds{ 0 };
+        /// @brief 注册链表中的下一个线程
+        ThreadCounters* next = nullptr;
+    };
+
+    /**
+     * @struct StatsRegistry
+     * @brief 线程计数器注册表
+     */
+    struct StatsRegistry
+    {
+        std::mutex mutex;
+        /// @brief 存活线程链表
+        ThreadCounters* head = nullptr;
+        /// @brief 已退出线程的累计统计
+        DaneJoe::StringifyStats retired;
+    };
+
+    /**
+     * @brief 获取注册表
+     * @return 注册表
+     * @note 有意不析构，保证线程在静态析构之后退出时仍可安全注销
+     */
+    StatsRegistry& get_registry()
+    {
+        static StatsRegistry* registry = new StatsRegistry();
+        return *registry;
+    }
+
+    /**
+     * @brief 将线程计数器累加到快照
+     * @param counters 线程计数器
+     * @param stats 快照
+     */
+    void accumulate(const ThreadCounters& counters, DaneJoe::StringifyStats& stats)
+    {
+        for (std::size_t i = 0; i < branch_count; ++i)
+        {
+            const BranchCounters& source = counters.branches[i];
+            DaneJoe::StringifyBranchStats& target = stats.branches[i];
+            target.call_count += source.call_count.load(std::memory_order_relaxed);
+            target.output_bytes += source.output_bytes.load(std::memory_order_relaxed);
+            target.nanoseconds += source.nanoseconds.load(std::memory_order_relaxed);
+            target.growth_call_count += source.growth_call_count.load(std::memory_order_relaxed);
+        }
+        stats.config_lock_count += counters.config_lock_count.load(std::memory_order_relaxed);
+        stats.config_lock_wait_count += counters.config_lock_wait_count.load(std::memory_order_relaxed);
+        stats.config_lock_wait_nanoseconds += counters.config_lock_wait_nanoseconds.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief 清零线程计数器
+     * @param counters 线程计数器
+     */
+    void clear(ThreadCounters& counters)
+    {
+        for (BranchCounters& branch : counters.branches)
+        {
+            branch.call_count.store(0, std::memory_order_relaxed);
+            branch.output_bytes.store(0, std::memory_order_relaxed);
+            branch.nanoseconds.store(0, std::memory_order_relaxed);
+            branch.growth_call_count.store(0, std::memory_order_relaxed);
+        }
+        counters.config_lock_count.store(0, std::memory_order_relaxed);
+        counters.config_lock_wait_count.store(0, std::memory_order_relaxed);
+        counters.config_lock_wait_nanoseconds.store(0, std::memory_order_relaxed);
+    }
+
+    /**
+     * @class ThreadSlot
+     * @brief 线程计数器的注册与注销
+     */
+    class ThreadSlot
+    {
+    public:
+        ThreadSlot()
+        {
+            StatsRegistry& registry = get_registry();
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            m_counters.next = registry.head;
+            registry.head = &m_counters;
+        }
+        ~ThreadSlot()
+        {
+            StatsRegistry& registry = get_registry();
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            accumulate(m_counters, registry.retired);
+            for (ThreadCounters** node = &registry.head; *node != nullptr; node = &(*node)->next)
+            {
+                if (*node == &m_counters)
+                {
+                    *node = m_counters.next;
+                    break;
+                }
+            }
+        }
+        ThreadCounters& counters()
+        {
+            return m_counters;
+        }
+    private:
+        ThreadCounters m_counters;
+    };
+
+    /**
+     * @brief 获取当前线程的计数器，首次调用时注册
+     * @return 线程计数器，注册失败（加锁抛出）时为nullptr，下次调用时重试
+     */
+    ThreadCounters* get_thread_counters() noexcept
+    {
+        try
+        {
+            thread_local ThreadSlot slot;
+            return &slot.counters();
+        }
+        catch (...)
+        {
+            return nullptr;
+        }
+    }
+}
+
+const char* DaneJoe::get_stringify_branch_name(StringifyBranch branch) noexcept
+{
+    switch (branch)
+    {
+    case StringifyBranch::StdString:
+        return "from_std_string";
+    case StringifyBranch::StdStringView:
+        return "from_std_string_view";
+    case StringifyBranch::CString:
+        return "from_c_string";
+    case StringifyBranch::UnicodeString:
+        return "from_unicode_string";
+    case StringifyBranch::Enum:
+        return "from_enum";
+    case StringifyBranch::Char:
+        return "from_char";
+    case StringifyBranch::UnicodeChar:
+        return "from_unicode_char";
+    case StringifyBranch::Bool:
+        return "from_bool";
+    case StringifyBranch::BitSequence:
+        return "from_bit_sequence";
+    case StringifyBranch::CustomAppend:
+        return "from_stringify_append";
+    case StringifyBranch::MemberToString:
+        return "from_member_to_string";
+    case StringifyBranch::StdToString:
+        return "from_std_to_string";
+    case StringifyBranch::TimeDuration:
+        return "format_time_duration";
+    case StringifyBranch::TimePoint:
+        return "format_time_point";
+    case StringifyBranch::StdPair:
+        return "from_std_pair";
+    case StringifyBranch::StdOptional:
+        return "from_std_optional";
+    case StringifyBranch::StdVariant:
+        return "from_std_variant";
+    case StringifyBranch::StdTuple:
+        return "from_std_tuple";
+    case StringifyBranch::StdAny:
+        return "from_std_any";
+    case StringifyBranch::HasIterator:
+        return "from_has_iterator";
+    case StringifyBranch::CArray:
+        return "from_c_array";
+    case StringifyBranch::InputRange:
+        return "from_input_range";
+    case StringifyBranch::StreamOut:
+        return "from_stream_out";
+    case StringifyBranch::Fallback:
+        return "from_fallback";
+    case StringifyBranch::CapacitySize:
+        return "format_capacity_size";
+    case StringifyBranch::Count:
+    default:
+        return "";
+    }
+}
+
+DaneJoe::StringifyStats DaneJoe::stringify_stats()
+{
+    StatsRegistry& registry = get_registry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    StringifyStats stats = registry.retired;
+    for (const ThreadCounters* node = registry.head; node != nullptr; node = node->next)
+    {
+        accumulate(*node, stats);
+    }
+    return stats;
+}
+
+void DaneJoe::reset_stringify_stats()
+{
+    StatsRegistry& registry = get_registry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    registry.retired = StringifyStats();
+    for (ThreadCounters* node = registry.head; node != nullptr; node = node->next)
+    {
+        clear(*node);
+    }
+}
+
+void DaneJoe::register_stringify_stats_thread()
+{
+#if defined(DANEJOE_STRINGIFY_ENABLE_STATS)
+    get_thread_counters();
+#endif
+}
+
+void DaneJoe::record_stringify_branch(
+    StringifyBranch branch,
+    uint64_t output_bytes,
+    uint64_t nanoseconds,
+    bool is_grown) noexcept
+{
+    ThreadCounters* thread_counters = get_thread_counters();
+    if (thread_counters == nullptr)
+    {
+        return;
+    }
+    BranchCounters& counters = thread_counters->branches[static_cast<std::size_t>(branch)];
+    counters.call_count.fetch_add(1, std::memory_order_relaxed);
+    counters.output_bytes.fetch_add(output_bytes, std::memory_order_relaxed);
+    counters.nanoseconds.fetch_add(nanoseconds, std::memory_order_relaxed);
+    if (is_grown)
+    {
+        counters.growth_call_count.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void DaneJoe::record_stringify_config_lock(bool is_waited, uint64_t nanoseconds) noexcept
+{
+    ThreadCounters* counters = get_thread_counters();
+    if (counters == nullptr)
+    {
+        return;
+    }
+    counters->config_lock_count.fetch_add(1, std::memory_order_relaxed);
+    if (is_waited)
+    {
+        counters->config_lock_wait_count.fetch_add(1, std::memory_order_relaxed);
+        counters->config_lock_wait_nanoseconds.fetch_add(nanoseconds, std::memory_order_relaxed);
+    }
+}
@@ -0,0 +1,185 @@
+#include <new>
+#include <cstdlib>
+
+#include "allocation_counter.hpp"
+
+namespace
+{
+    /// @brief 当前线程是否计数
+    thread_local bool is_counting = false;
+    /// @brief 当前线程的统计
+    thread_local DaneJoe::AllocationCount thread_count;
+
+    /**
+     * @brief 分配内存并计数
+     * @param size 字节数
+     * @return 内存，失败时为nullptr
+     */
+    void* allocate(std::size_t size) noexcept
+    {
+        DaneJoe::record_allocation(size);
+        return std::malloc(size == 0 ? 1 : size);
+    }
+    /**
+     * @brief 按对齐分配内存并计数
+     * @param size 字节数
+     * @param alignment 对齐
+     * @return 内存，失败时为nullptr
+     */
+    void* allocate_aligned(std::size_t size, std::align_val_t alignment) noexcept
+    {
+        DaneJoe::record_allocation(size);
+        const auto align = static_cast<std::size_t>(alignment);
+#if defined(_MSC_VER)
+        return _aligned_malloc(size == 0 ? 1 : size, align);
+#else
+        // aligned_alloc要求大小为对齐的整数倍
+        return std::aligned_alloc(align, (size + align - 1) / align * align);
+#endif
+    }
+    /**
+     * @brief 释放按对齐分配的内存
+     * @param ptr 内存
+     */
+    void deallocate_aligned(void* ptr) noexcept
+    {
+#if defined(_MSC_VER)
+        _aligned_free(ptr);
+#else
+        std::free(ptr);
+#endif
+    }
+}
+
+void DaneJoe::record_allocation(std::size_t size) noexcept
+{
+    if (is_counting)
+    {
+        ++thread_count.count;
+        thread_count.bytes += size;
+    }
+}
+
+DaneJoe::AllocationCounterScope::AllocationCounterScope() noexcept
+{
+    thread_count = AllocationCount();
+    is_counting = true;
+}
+
+DaneJoe::AllocationCounterScope::~AllocationCounterScope()
+{
+    is_counting = false;
+}
+
+DaneJoe::AllocationCount DaneJoe::AllocationCounterScope::get_count() const noexcept
+{
+    return thread_count;
+}
+
+void* operator new(std::size_t size)
+{
+    if (void* ptr = allocate(size))
+    {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    return allocate(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return allocate(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    if (void* ptr = allocate_aligned(size, alignment))
+    {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment)
+{
+    return operator new(size, alignment);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    return allocate_aligned(size, alignment);
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    return allocate_aligned(size, alignment);
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t) noexcept
+{
+    deallocate_aligned(ptr);
+}
+
+void operator delete[](void* ptr, std::align_val_t) noexcept
+{
+    deallocate_aligned(ptr);
+}
+
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept
+{
+    deallocate_aligned(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept
+{
+    deallocate_aligned(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t, const std::nothrow_t&) noexcept
+{
+    deallocate_aligned(ptr);
+}
+
+void operator delete[](void* ptr, std::align_val_t, const std::nothrow_t&) noexcept
+{
+    deallocate_aligned(ptr);
+}
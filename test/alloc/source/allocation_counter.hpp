@@ -0,0 +1,62 @@
+/**
+ * @file allocation_counter.hpp
+ * @brief 统计全局operator new调用的计数器
+ * @author DaneJoe001
+ * @version 0.2.0
+ * @date 2026-10-18
+ * @details 替换的全局operator new在计数作用域内累计当前线程的分配次数与字节数，
+ *          作用域外不计数，避免测试框架自身的分配干扰结果。
+ * @note 替换只对静态链接进测试可执行文件的代码生效；以动态库形式构建时，
+ *       Windows上库内的分配不经过替换的operator new。
+ */
+#pragma once
+
+#include <cstddef>
+
+/**
+ * @namespace DaneJoe
+ * @brief DaneJoe 命名空间
+ */
+namespace DaneJoe
+{
+    /**
+     * @struct AllocationCount
+     * @brief 分配统计
+     */
+    struct AllocationCount
+    {
+        /// @brief 分配次数
+        std::size_t count = 0;
+        /// @brief 分配的字节数
+        std::size_t bytes = 0;
+    };
+    /**
+     * @brief 记录一次分配（由替换的operator new调用）
+     * @param size 字节数
+     */
+    void record_allocation(std::size_t size) noexcept;
+    /**
+     * @class AllocationCounterScope
+     * @brief 计数作用域，构造时清零并开始计数，析构时停止
+     * @note 只统计构造所在线程；不可嵌套
+     */
+    class AllocationCounterScope
+    {
+    public:
+        /**
+         * @brief 构造函数，开始计数
+         */
+        AllocationCounterScope() noexcept;
+        /**
+         * @brief 析构函数，停止计数
+         */
+        ~AllocationCounterScope();
+        AllocationCounterScope(const AllocationCounterScope&) = delete;
+        AllocationCounterScope& operator=(const AllocationCounterScope&) = delete;
+        /**
+         * @brief 获取当前统计
+         * @return 自构造以来的分配统计
+         */
+        AllocationCount get_count() const noexcept;
+    };
+}
@@ -0,0 +1,284 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <bitset>
+#include <charconv>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory_resource>
+#include <ostream>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "allocation_counter.hpp"
+#include "danejoe/stringify/stringify_column.hpp"
+#include "danejoe/stringify/stringify_constexpr.hpp"
+#include "danejoe/stringify/stringify_csv.hpp"
+#include "danejoe/stringify/stringify_deep_size.hpp"
+#include "danejoe/stringify/stringify_format.hpp"
+#include "danejoe/stringify/stringify_join.hpp"
+#include "danejoe/stringify/stringify_stats.hpp"
+#include "danejoe/stringify/stringify_to.hpp"
+#include "danejoe/stringify/stringify_to_string.hpp"
+
+namespace
+{
+
+/**
+ * @brief 测试用枚举
+ */
+enum class Color
+{
+    Red,
+    Green
+};
+
+/**
+ * @brief 仅支持operator<<的类型
+ */
+struct StreamPoint
+{
+    int x = 0;
+    int y = 0;
+};
+
+std::ostream& operator<<(std::ostream& os, const StreamPoint& point)
+{
+    return os << '<' << point.x << ',' << point.y << '>';
+}
+
+/**
+ * @brief 统计一次调用的分配
+ * @note 先预热一次，排除首次调用时配置、时区等的惰性初始化
+ */
+template<class Function>
+DaneJoe::AllocationCount count_allocations(Function&& function)
+{
+    function();
+    DaneJoe::AllocationCounterScope scope;
+    function();
+    return scope.get_count();
+}
+
+/**
+ * @brief 测试数据
+ */
+struct Values
+{
+    std::vector<int> small_vector = std::vector<int>(10, 7);
+    std::vector<int> large_vector = std::vector<int>(1000, 123456);
+    std::vector<int> huge_vector = std::vector<int>(10000, 123456);
+    std::map<int, std::string> map;
+    std::tuple<int, std::pair<std::string, double>, std::tuple<bool, char, std::optional<int>>> nested_tuple =
+        { 1, { "ab", 2.5 }, { true, 'c', 3 } };
+    std::chrono::system_clock::time_point time_point =
+        std::chrono::system_clock::time_point(std::chrono::seconds(1700000000));
+    Values()
+    {
+        for (int i = 0; i < 100; ++i)
+        {
+            map[i] = std::string(static_cast<std::size_t>(i % 20), 'x');
+        }
+    }
+};
+
+} // namespace
+
+TEST(AllocationBudgetTest, ToString_VectorGrowsResultOnly)
+{
+    const Values values;
+    std::string result;
+    const auto small = count_allocations([&] { result = DaneJoe::to_string(values.small_vector); });
+    EXPECT_LE(small.count, 1u);
+
+    const auto large = count_allocations([&] { result = DaneJoe::to_string(values.large_vector); });
+    // 结果字符串按倍数增长，分配次数为对数级，总字节数不超过最终长度的数倍
+    EXPECT_LE(large.count, 12u);
+    EXPECT_LE(large.bytes, 5 * result.size());
+
+    const auto huge = count_allocations([&] { result = DaneJoe::to_string(values.huge_vector); });
+    EXPECT_LE(huge.count, large.count + 4) << "per-element allocation reintroduced";
+}
+
+TEST(AllocationBudgetTest, ToString_MapNestedTupleAndScalars)
+{
+    const Values values;
+    std::string result;
+    const auto map = count_allocations([&] { result = DaneJoe::to_string(values.map); });
+    EXPECT_LE(map.count, 8u);
+    EXPECT_LE(map.bytes, 5 * result.size());
+
+    EXPECT_LE(count_allocations([&] { result = DaneJoe::to_string(values.nested_tuple); }).count, 1u);
+    EXPECT_LE(count_allocations([&] { result = DaneJoe::to_string(Color::Green); }).count, 1u);
+    EXPECT_LE(count_allocations([&] { result = DaneJoe::to_string(values.time_point); }).count, 1u);
+    EXPECT_LE(count_allocations([&] { result = DaneJoe::to_string(std::chrono::milliseconds(15)); }).count, 1u);
+    EXPECT_LE(count_allocations([&] { result = DaneJoe::to_string(3.14159); }).count, 1u);
+    EXPECT_LE(count_allocations([&]
+        {
+            result = DaneJoe::format_capacity_size(123456789, DaneJoe::StorageUnit::MegaByte, 2);
+        }).count, 1u);
+}
+
+TEST(AllocationBudgetTest, AppendToReservedBuffer_AllocatesNothing)
+{
+    const Values values;
+    const DaneJoe::StringifyConfig config;
+    std::string out;
+    out.reserve(1 << 16);
+    auto append_all = [&]
+        {
+            out.clear();
+            DaneJoe::append_to_string(out, values.large_vector, config);
+            DaneJoe::append_to_string(out, values.map, config);
+            DaneJoe::append_to_string(out, values.nested_tuple, config);
+            DaneJoe::append_to_string(out, Color::Red, config);
+            DaneJoe::append_to_string(out, values.time_point, config);
+            DaneJoe::append_to_string(out, std::chrono::microseconds(42), config);
+            DaneJoe::append_to_string(out, -1.5e-300, config);
+            DaneJoe::append_capacity_size(out, 123456789, DaneJoe::StorageUnit::GigaByte, 3, config);
+        };
+    const auto count = count_allocations(append_all);
+    EXPECT_EQ(count.count, 0u);
+    EXPECT_EQ(count.bytes, 0u);
+}
+
+TEST(AllocationBudgetTest, PmrOutput_TemporariesUseOutputResource)
+{
+    std::array<std::byte, 8192> arena_buffer{};
+    const std::vector<StreamPoint> points = { { 1, 2 }, { 3, 4 } };
+    const DaneJoe::StringifyConfig config;
+    const auto count = count_allocations([&]
+        {
+            std::pmr::monotonic_buffer_resource arena(arena_buffer.data(), arena_buffer.size(),
+                std::pmr::null_memory_resource());
+            std::pmr::string out(&arena);
+            DaneJoe::append_to_string(out, points, config);
+            DaneJoe::append_floating(out, 1e300, std::chars_format::fixed, 2);
+            DaneJoe::append_to_string(out, std::chrono::duration<long double>(1.5), config);
+        });
+    EXPECT_EQ(count.count, 0u);
+}
+
+TEST(AllocationBudgetTest, FixedBuffer_AllocatesNothing)
+{
+    const Values values;
+    DaneJoe::StringifyConfig config;
+    // 定长缓冲输出不分配内存，无序容器即使要求排序也按桶顺序输出
+    config.is_sort_unordered_container = true;
+    const std::unordered_map<int, int> table = { { 1, 2 }, { 3, 4 } };
+    const std::map<int, int> tree = { { 1, 2 }, { 3, 4 } };
+    const auto tuple = std::make_tuple(1, std::make_pair(std::string_view("ab"), 2), std::optional<int>(3));
+    char buffer[16384];
+    char* const last = buffer + sizeof(buffer);
+    const auto count = count_allocations([&]
+        {
+            DaneJoe::stringify_to(buffer, last, values.large_vector, config);
+            DaneJoe::stringify_to(buffer, last, tree, config);
+            DaneJoe::stringify_to(buffer, last, table, config);
+            DaneJoe::stringify_to(buffer, last, tuple, config);
+            DaneJoe::stringify_to(buffer, last, Color::Green, config);
+            DaneJoe::stringify_to(buffer, last, std::chrono::seconds(3), config);
+            DaneJoe::stringify_to(buffer, last, std::bitset<64>(0xF0F0), config);
+            DaneJoe::stringify_to(buffer, last, values.large_vector);
+            // 截断同样不分配
+            DaneJoe::stringify_to(buffer, buffer + 8, values.large_vector, config);
+            DaneJoe::format_capacity_size_to(buffer, last, 123456789, DaneJoe::StorageUnit::MegaByte, 2, config);
+            DaneJoe::format_capacity_size_to(buffer, last, 42, DaneJoe::StorageUnit::Byte);
+        });
+    EXPECT_EQ(count.count, 0u);
+}
+
+TEST(AllocationBudgetTest, StringifyTo_SupportedTypesNeverAllocate)
+{
+    char buffer[64];
+    char* const first = buffer;
+    char* const last = buffer + sizeof(buffer);
+    const std::vector<std::uint64_t> numbers = { 1, 22, 333, 4444, 55555, 666666 };
+    const std::map<int, bool> flags = { { 1, true }, { 2, false } };
+    const std::tuple<int, Color, std::optional<char>> tuple{ 7, Color::Green, std::nullopt };
+    const std::array<std::chrono::nanoseconds, 2> durations = { std::chrono::nanoseconds(5), std::chrono::nanoseconds(6) };
+    const std::pair<DaneJoe::StorageUnit, DaneJoe::FormatPosition> names{
+        DaneJoe::StorageUnit::KiloByte, DaneJoe::FormatPosition::CENTER };
+    const auto count = count_allocations([&]
+        {
+            DaneJoe::stringify_to(first, last, numbers);
+            DaneJoe::stringify_to(first, last, flags);
+            DaneJoe::stringify_to(first, last, tuple);
+            DaneJoe::stringify_to(first, last, durations);
+            DaneJoe::stringify_to(first, last, names);
+            DaneJoe::stringify_to(first, first + 3, numbers);
+            DaneJoe::format_capacity_size_to(first, last, 123456789, DaneJoe::StorageUnit::MegaByte, 3);
+        });
+    EXPECT_EQ(count.count, 0u);
+}
+
+TEST(AllocationBudgetTest, StringifyTo_FirstCallOnNewThread)
+{
+    const std::vector<int> numbers = { 1, 22, 333 };
+    DaneJoe::AllocationCount count;
+    // 不预热：新线程的首次调用同样不分配，启用统计时须先注册线程
+    std::thread worker([&]
+        {
+            DaneJoe::register_stringify_stats_thread();
+            char buffer[64];
+            DaneJoe::AllocationCounterScope scope;
+            DaneJoe::stringify_to(buffer, buffer + sizeof(buffer), numbers);
+            DaneJoe::stringify_to(buffer, buffer + sizeof(buffer), std::chrono::seconds(1));
+            count = scope.get_count();
+        });
+    worker.join();
+    EXPECT_EQ(count.count, 0u);
+}
+
+TEST(AllocationBudgetTest, NoexceptHelpers_AllocateNothing)
+{
+    const DaneJoe::StringifyConfig config;
+    const std::string text(256, 'a');
+    const auto count = count_allocations([&]
+        {
+            (void)DaneJoe::get_storage_unit_symbol(config.storage_symbol, DaneJoe::StorageUnit::KiloByte);
+            (void)DaneJoe::get_capacity_unit(123456789, config);
+            (void)DaneJoe::StringifyConfigManager::get_default_config();
+            (void)DaneJoe::StringifyConfigManager::get_config_version();
+            (void)DaneJoe::StringifyConfigManager::get_config_snapshot();
+            (void)DaneJoe::get_enum_name(Color::Green);
+            (void)DaneJoe::get_storage_unit_name(DaneJoe::StorageUnit::KiloByte);
+            (void)DaneJoe::get_format_position_name(DaneJoe::FormatPosition::CENTER);
+            (void)DaneJoe::has_csv_special_char(text.data(), text.size(), ',');
+            (void)DaneJoe::get_stringify_size_hint(123456789, config);
+            (void)DaneJoe::deep_size(std::vector<int>(0));
+        });
+    EXPECT_EQ(count.count, 0u);
+}
+
+TEST(AllocationBudgetTest, SingleAllocationUtilities)
+{
+    const Values values;
+    const std::string name = "worker";
+    std::string result;
+    // 字符串、整数、布尔与字符的长度精确可知，只分配结果
+    EXPECT_EQ(count_allocations([&] { result = DaneJoe::str_cat("id=", 42, ' ', name, " ok=", true); }).count, 1u);
+    EXPECT_EQ(count_allocations([&] { result = DaneJoe::join(values.large_vector, ", "); }).count, 1u);
+
+    // 整数列：首块按最大长度写入，之后按首块平均长度预留整列；偏移一次预留
+    std::string buffer;
+    std::vector<int32_t> offsets;
+    const auto column = count_allocations([&]
+        {
+            buffer.clear();
+            buffer.shrink_to_fit();
+            offsets.clear();
+            offsets.shrink_to_fit();
+            DaneJoe::stringify_column(std::span<const int>(values.huge_vector), buffer, offsets);
+        });
+    EXPECT_LE(column.count, 3u);
+}
@@ -0,0 +1,140 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <set>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+#include "danejoe/stringify/stringify_parse.hpp"
+#include "danejoe/stringify/stringify_to_string.hpp"
+
+namespace
+{
+
+enum class Color
+{
+    Red = 1,
+    Green = 2
+};
+
+struct StringifyConfigGuard
+{
+    DaneJoe::StringifyConfig old_config;
+
+    explicit StringifyConfigGuard(const DaneJoe::StringifyConfig& new_config)
+        : old_config(DaneJoe::StringifyConfigManager::get_config())
+    {
+        DaneJoe::StringifyConfigManager::set_config(new_config);
+    }
+
+    ~StringifyConfigGuard()
+    {
+        DaneJoe::StringifyConfigManager::set_config(old_config);
+    }
+};
+
+template<class T>
+void expect_round_trip(const T& value)
+{
+    const std::string text = DaneJoe::to_string(value);
+    const auto result = DaneJoe::from_string<T>(text);
+    ASSERT_TRUE(result) << text << " @" << result.offset;
+    EXPECT_EQ(result.value, value) << text;
+    EXPECT_EQ(result.offset, text.size());
+}
+
+} // namespace
+
+TEST(FromStringTest, Scalars_RoundTrip)
+{
+    expect_round_trip(42);
+    expect_round_trip(-7L);
+    expect_round_trip(static_cast<uint8_t>(200));
+    expect_round_trip(static_cast<int16_t>(-300));
+    expect_round_trip(1.5);
+    expect_round_trip(true);
+    expect_round_trip(false);
+    expect_round_trip('x');
+    expect_round_trip(Color::Green);
+    expect_round_trip(std::chrono::milliseconds(250));
+    expect_round_trip(std::chrono::nanoseconds(-3));
+}
+
+TEST(FromStringTest, Composites_RoundTrip)
+{
+    expect_round_trip(std::vector<int>{ 1, -2, 3 });
+    expect_round_trip(std::vector<int>{});
+    expect_round_trip(std::array<int, 3>{ 4, 5, 6 });
+    expect_round_trip(std::set<int>{ 3, 1, 2 });
+    expect_round_trip(std::map<std::string, int>{ { "a", 1 }, { "bc", 2 } });
+    expect_round_trip(std::pair<int, bool>(1, true));
+    expect_round_trip(std::make_tuple(1, std::string("two"), 3.25));
+    expect_round_trip(std::vector<std::optional<int>>{ 1, std::nullopt, 3 });
+    expect_round_trip(std::vector<std::vector<std::string>>{ { "a", "b" }, {}, { "c" } });
+    expect_round_trip(std::map<int, std::vector<std::pair<Color, bool>>>{
+        { 1, { { Color::Red, true } } }, { 2, {} } });
+}
+
+TEST(FromStringTest, StringView_PointsIntoInput)
+{
+    const std::string text = "[ab, cd]";
+    std::vector<std::string_view> value;
+    ASSERT_TRUE(DaneJoe::from_string(text, value));
+    ASSERT_EQ(value.size(), 2u);
+    EXPECT_EQ(value[0], "ab");
+    EXPECT_EQ(value[1], "cd");
+    EXPECT_EQ(value[0].data(), text.data() + 1);
+}
+
+TEST(FromStringTest, Errors_ReportOffset)
+{
+    auto bad_number = DaneJoe::from_string<std::vector<int>>("[1, x, 3]");
+    EXPECT_EQ(bad_number.error, DaneJoe::FromStringError::InvalidNumber);
+    EXPECT_EQ(bad_number.offset, 4u);
+
+    auto out_of_range = DaneJoe::from_string<uint16_t>("70000");
+    EXPECT_EQ(out_of_range.error, DaneJoe::FromStringError::NumberOutOfRange);
+    EXPECT_EQ(out_of_range.offset, 0u);
+
+    auto missing_end = DaneJoe::from_string<std::vector<int>>("[1, 2");
+    EXPECT_EQ(missing_end.error, DaneJoe::FromStringError::UnexpectedEnd);
+    EXPECT_EQ(missing_end.offset, 5u);
+
+    auto bad_separator = DaneJoe::from_string<std::pair<int, int>>("{1; 2}");
+    EXPECT_EQ(bad_separator.error, DaneJoe::FromStringError::ExpectedSymbol);
+    EXPECT_EQ(bad_separator.offset, 2u);
+
+    auto trailing = DaneJoe::from_string<int>("12abc");
+    EXPECT_EQ(trailing.error, DaneJoe::FromStringError::TrailingCharacters);
+    EXPECT_EQ(trailing.offset, 2u);
+
+    auto bad_bool = DaneJoe::from_string<bool>("yes");
+    EXPECT_EQ(bad_bool.error, DaneJoe::FromStringError::InvalidBool);
+
+    auto bad_unit = DaneJoe::from_string<std::chrono::seconds>("5ms");
+    EXPECT_EQ(bad_unit.error, DaneJoe::FromStringError::ExpectedSymbol);
+    EXPECT_EQ(bad_unit.offset, 1u);
+
+    auto array_overflow = DaneJoe::from_string<std::array<int, 2>>("[1, 2, 3]");
+    EXPECT_EQ(array_overflow.error, DaneJoe::FromStringError::ElementCountMismatch);
+    EXPECT_EQ(array_overflow.offset, 7u);
+}
+
+TEST(FromStringTest, UsesActiveConfigSymbols)
+{
+    DaneJoe::StringifyConfig config;
+    config.container_symbol = { "<", ">", ";", "" };
+    config.bool_symbol = { "yes", "no" };
+    config.null_value_symbol = "nil";
+    StringifyConfigGuard guard(config);
+
+    const std::vector<std::optional<bool>> value = { true, std::nullopt, false };
+    EXPECT_EQ(DaneJoe::to_string(value), "<yes;nil;no>");
+    expect_round_trip(value);
+}
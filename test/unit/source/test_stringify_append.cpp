@@ -0,0 +1,135 @@
+#include <gtest/gtest.h>
+
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "danejoe/stringify/stringify_capture.hpp"
+#include "danejoe/stringify/stringify_to.hpp"
+#include "danejoe/stringify/stringify_to_string.hpp"
+#include "danejoe/stringify/stringify_traversal.hpp"
+
+namespace Geometry
+{
+
+/// 仅提供自定义追加函数
+struct Point
+{
+    int x;
+    int y;
+};
+
+template<class Out>
+void stringify_append(DaneJoe::StringifyWriter<Out>& writer, const Point& point)
+{
+    writer.push_back('(');
+    writer.write(point.x);
+    writer.append(", ");
+    writer.write(point.y);
+    writer.push_back(')');
+}
+
+/// 同时提供三种钩子，自定义追加函数优先
+struct Tagged
+{
+    int id;
+    std::string to_string() const
+    {
+        return "member";
+    }
+};
+
+inline std::ostream& operator<<(std::ostream& os, const Tagged&)
+{
+    return os << "stream";
+}
+
+template<class Out>
+void stringify_append(DaneJoe::StringifyWriter<Out>& writer, const Tagged& tagged)
+{
+    writer.append("tagged#");
+    writer.write(tagged.id);
+}
+
+/// 枚举也可覆盖内置输出
+enum class Axis
+{
+    X,
+    Y
+};
+
+template<class Out>
+void stringify_append(DaneJoe::StringifyWriter<Out>& writer, Axis axis)
+{
+    writer.append(axis == Axis::X ? "x-axis" : "y-axis");
+}
+
+/// 只支持std::string输出的非模板重载
+struct Label
+{
+    std::string text;
+};
+
+inline void stringify_append(DaneJoe::StringifyWriter<std::string>& writer, const Label& label)
+{
+    writer.append(label.text);
+}
+
+} // namespace Geometry
+
+TEST(StringifyAppendTest, Trait_DetectsCustomizationPoint)
+{
+    EXPECT_TRUE((DaneJoe::has_stringify_append<Geometry::Point>::value));
+    EXPECT_TRUE((DaneJoe::has_stringify_append<Geometry::Point, DaneJoe::FixedBufferWriter>::value));
+    EXPECT_TRUE((DaneJoe::has_stringify_append<Geometry::Label>::value));
+    EXPECT_FALSE((DaneJoe::has_stringify_append<Geometry::Label, DaneJoe::FixedBufferWriter>::value));
+    EXPECT_FALSE((DaneJoe::has_stringify_append<int>::value));
+    EXPECT_FALSE((DaneJoe::has_stringify_append<std::string>::value));
+}
+
+TEST(StringifyAppendTest, CustomAppend_TakesPriority)
+{
+    EXPECT_EQ(DaneJoe::to_string(Geometry::Point{ 1, -2 }), "(1, -2)");
+    EXPECT_EQ(DaneJoe::to_string(Geometry::Tagged{ 7 }), "tagged#7");
+    EXPECT_EQ(DaneJoe::to_string(Geometry::Axis::Y), "y-axis");
+    EXPECT_EQ(DaneJoe::from_stringify_append(Geometry::Label{ "name" }), "name");
+    EXPECT_EQ(DaneJoe::to_string(std::vector<Geometry::Point>{ { 1, 2 }, { 3, 4 } }), "[(1, 2), (3, 4)]");
+}
+
+TEST(StringifyAppendTest, Writer_PassesConfig)
+{
+    DaneJoe::StringifyConfig config;
+    config.integer_base = DaneJoe::IntegerBase::Hexadecimal;
+    config.is_show_integer_prefix = true;
+    std::string result;
+    DaneJoe::append_to_string(result, Geometry::Point{ 255, 16 }, config);
+    EXPECT_EQ(result, "(0xff, 0x10)");
+
+    std::string iterative;
+    DaneJoe::append_to_string_iterative(iterative, std::vector<Geometry::Point>{ { 1, 2 } }, config);
+    EXPECT_EQ(iterative, "[(0x1, 0x2)]");
+}
+
+TEST(StringifyAppendTest, FixedBuffer_WritesWithoutAllocation)
+{
+    EXPECT_TRUE(DaneJoe::is_fixed_stringifiable<Geometry::Point>::value);
+    EXPECT_FALSE(DaneJoe::is_fixed_stringifiable<Geometry::Label>::value);
+    char buffer[32];
+    auto result = DaneJoe::stringify_to(buffer, buffer + sizeof(buffer), std::vector<Geometry::Point>{ { 5, 6 } });
+    EXPECT_FALSE(result.truncated);
+    EXPECT_EQ(std::string_view(buffer, static_cast<std::size_t>(result.ptr - buffer)), "[(5, 6)]");
+}
+
+TEST(StringifyAppendTest, Capture_RendersAtCaptureTime)
+{
+    DaneJoe::StringifyCapture capture;
+    ASSERT_TRUE(capture.capture(Geometry::Tagged{ 3 }, " ", Geometry::Axis::X));
+    std::vector<std::string> lines;
+    capture.drain([&](std::string_view text)
+        {
+            lines.emplace_back(text);
+        });
+    ASSERT_EQ(lines.size(), 1u);
+    EXPECT_EQ(lines[0], "tagged#3 x-axis");
+}
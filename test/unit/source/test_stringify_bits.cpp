@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+
+#include <bitset>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "danejoe/stringify/stringify_to_string.hpp"
+#include "danejoe/stringify/stringify_to.hpp"
+#include "danejoe/stringify/stringify_traversal.hpp"
+
+namespace
+{
+
+/**
+ * @brief 以指定格式输出
+ */
+template<class T>
+std::string render(const T& value, DaneJoe::BitFormat format,
+    const std::string& group_symbol = "", std::size_t group_size = 8, int max_count = -1)
+{
+    DaneJoe::StringifyConfig config;
+    config.bit_format = format;
+    config.bit_group_symbol = group_symbol;
+    config.bit_group_size = group_size;
+    config.max_stringify_element_count = max_count;
+    std::string out;
+    DaneJoe::append_to_string(out, value, config);
+    return out;
+}
+
+} // namespace
+
+TEST(StringifyBitsTest, VectorBool_DefaultElements)
+{
+    const std::vector<bool> bits = { true, false, true };
+    EXPECT_EQ(DaneJoe::to_string(bits), "[true, false, true]");
+    EXPECT_EQ(render(bits, DaneJoe::BitFormat::Element, "", 8, 2), "[true, false, ...]");
+    EXPECT_EQ(DaneJoe::to_string(std::vector<bool>{}), "[]");
+}
+
+TEST(StringifyBitsTest, VectorBool_BinaryAndHexadecimal)
+{
+    const std::vector<bool> bits = { true, false, true, true, false, false, false, false, true };
+    EXPECT_EQ(render(bits, DaneJoe::BitFormat::Binary), "101100001");
+    // 每4位一个数字，第一位为最高位；末尾不足4位时在后面补0
+    EXPECT_EQ(render(bits, DaneJoe::BitFormat::Hexadecimal), "b08");
+    EXPECT_EQ(render(bits, DaneJoe::BitFormat::Binary, "_", 4), "1011_0000_1");
+    EXPECT_EQ(render(bits, DaneJoe::BitFormat::Binary, "", 8, 4), "1011...");
+}
+
+TEST(StringifyBitsTest, Bitset_MatchesStreamOutput)
+{
+    const std::bitset<10> bits(0x2F5);
+    EXPECT_EQ(DaneJoe::to_string(bits), bits.to_string());
+    EXPECT_EQ(render(bits, DaneJoe::BitFormat::Binary), "1011110101");
+    // 与整数的十六进制输出一致
+    EXPECT_EQ(render(bits, DaneJoe::BitFormat::Hexadecimal), "2f5");
+    // 与整数一样从低位开始分组
+    EXPECT_EQ(render(bits, DaneJoe::BitFormat::Binary, "_", 4), "10_1111_0101");
+    EXPECT_EQ(render(std::bitset<0>(), DaneJoe::BitFormat::Binary), "");
+}
+
+TEST(StringifyBitsTest, Bitset_LargeMatchesToString)
+{
+    std::bitset<1000> bits;
+    std::mt19937 engine(20261018);
+    for (std::size_t i = 0; i < bits.size(); ++i)
+    {
+        bits[i] = engine() & 1;
+    }
+    EXPECT_EQ(render(bits, DaneJoe::BitFormat::Binary), bits.to_string());
+}
+
+TEST(StringifyBitsTest, BitSpan_ReadsWordsLeastSignificantFirst)
+{
+    const uint64_t words[] = { 0x00000000000000F1ULL, 0x1ULL };
+    const DaneJoe::BitSpan<> bits(words, 66);
+    const std::string binary = render(bits, DaneJoe::BitFormat::Binary);
+    EXPECT_EQ(binary, "10001111" + std::string(56, '0') + "10");
+    EXPECT_EQ(render(bits, DaneJoe::BitFormat::Hexadecimal), "8f" + std::string(14, '0') + "8");
+    EXPECT_EQ(render(bits, DaneJoe::BitFormat::Element, "", 8, 5), "[true, false, false, false, true, ...]");
+
+    const uint8_t bytes[] = { 0x0F, 0xA0 };
+    EXPECT_EQ(render(DaneJoe::BitSpan<uint8_t>(bytes, 16), DaneJoe::BitFormat::Binary, " ", 8),
+        "11110000 00000101");
+}
+
+TEST(StringifyBitsTest, VectorBool_MatchesBitSpanAcrossChunks)
+{
+    std::mt19937_64 engine(20261018);
+    std::vector<uint64_t> words(40);
+    for (auto& word : words)
+    {
+        word = engine();
+    }
+    const std::size_t bit_count = words.size() * 64 - 13;
+    std::vector<bool> bits(bit_count);
+    std::string expected;
+    for (std::size_t i = 0; i < bit_count; ++i)
+    {
+        bits[i] = (words[i / 64] >> (i % 64)) & 1;
+        expected.push_back(bits[i] ? '1' : '0');
+    }
+    const DaneJoe::BitSpan<> span(words.data(), bit_count);
+    EXPECT_EQ(render(bits, DaneJoe::BitFormat::Binary), expected);
+    EXPECT_EQ(render(span, DaneJoe::BitFormat::Binary), expected);
+    EXPECT_EQ(render(bits, DaneJoe::BitFormat::Hexadecimal), render(span, DaneJoe::BitFormat::Hexadecimal));
+}
+
+TEST(StringifyBitsTest, NestedAndFixedBuffer)
+{
+    DaneJoe::StringifyConfig config;
+    config.bit_format = DaneJoe::BitFormat::Binary;
+    const std::vector<std::vector<bool>> rows = { { true, false }, { false, true } };
+    std::string out;
+    DaneJoe::append_to_string(out, rows, config);
+    EXPECT_EQ(out, "[10, 01]");
+    EXPECT_EQ(DaneJoe::to_string_iterative(rows), "[[true, false], [false, true]]");
+
+    static_assert(DaneJoe::is_fixed_stringifiable<std::bitset<8>>::value);
+    char buffer[16];
+    const auto result = DaneJoe::stringify_to(buffer, buffer + sizeof(buffer), std::bitset<8>(0x5A), config);
+    EXPECT_FALSE(result.truncated);
+    EXPECT_EQ(std::string(buffer, result.ptr), "01011010");
+}
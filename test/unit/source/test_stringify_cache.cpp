@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "danejoe/stringify/stringify_cache.hpp"
+
+namespace
+{
+
+TEST(StringifyCacheTest, SameVersion_ReturnsSharedBuffer)
+{
+    DaneJoe::StringifyCache cache;
+    const std::map<std::string, int> routes = { {"a", 1}, {"b", 2} };
+
+    const auto first = cache.get(routes, 1);
+    const auto second = cache.get(routes, 1);
+
+    EXPECT_EQ(*first, "[{a: 1}, {b: 2}]");
+    EXPECT_EQ(first.get(), second.get());
+    const DaneJoe::StringifyCacheStats stats = cache.get_stats();
+    EXPECT_EQ(stats.hit_count, 1u);
+    EXPECT_EQ(stats.miss_count, 1u);
+}
+
+TEST(StringifyCacheTest, NewVersion_Rerenders)
+{
+    DaneJoe::StringifyCache cache;
+    std::vector<int> flags = { 1 };
+
+    const auto first = cache.get(flags, 1);
+    flags.push_back(2);
+    const auto second = cache.get(flags, 2);
+
+    EXPECT_EQ(*first, "[1]");
+    EXPECT_EQ(*second, "[1, 2]");
+    EXPECT_EQ(cache.get_stats().entry_count, 1u);
+}
+
+TEST(StringifyCacheTest, SetConfig_InvalidatesEntries)
+{
+    DaneJoe::StringifyCache cache;
+    const std::vector<int> v = { 1, 2 };
+    const DaneJoe::StringifyConfig old_config = DaneJoe::StringifyConfigManager::get_config();
+
+    const auto first = cache.get(v, 1);
+    DaneJoe::StringifyConfig config = old_config;
+    config.container_symbol.space_maker = "";
+    DaneJoe::StringifyConfigManager::set_config(config);
+    const auto second = cache.get(v, 1);
+    DaneJoe::StringifyConfigManager::set_config(old_config);
+
+    EXPECT_EQ(*first, "[1, 2]");
+    EXPECT_EQ(*second, "[1,2]");
+    EXPECT_EQ(cache.get_stats().hit_count, 0u);
+}
+
+TEST(StringifyCacheTest, MemoryBudget_EvictsLeastRecentlyUsed)
+{
+    const std::vector<int> a(100, 1);
+    const std::vector<int> b(100, 2);
+    const std::vector<int> c(100, 3);
+    DaneJoe::StringifyCache probe;
+    probe.get(a, 1);
+    // 预算只容纳两个条目
+    DaneJoe::StringifyCache cache(probe.get_stats().memory_usage * 5 / 2);
+
+    cache.get(a, 1);
+    cache.get(b, 1);
+    cache.get(a, 1);
+    cache.get(c, 1);
+
+    const DaneJoe::StringifyCacheStats stats = cache.get_stats();
+    EXPECT_LE(stats.memory_usage, stats.memory_budget);
+    EXPECT_EQ(stats.eviction_count, 1u);
+    EXPECT_EQ(stats.entry_count, 2u);
+    cache.get(a, 1);
+    EXPECT_EQ(cache.get_stats().hit_count, 2u);
+}
+
+} // namespace
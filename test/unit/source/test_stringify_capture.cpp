@@ -0,0 +1,228 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <variant>
+#include <vector>
+
+#include "danejoe/stringify/stringify_capture.hpp"
+#include "danejoe/stringify/stringify_to_string.hpp"
+
+namespace
+{
+
+enum class Side : unsigned char
+{
+    Buy = 1,
+    Sell = 2
+};
+
+struct Order
+{
+    std::string to_string() const
+    {
+        return "Order#7";
+    }
+};
+
+std::vector<std::string> drain_all(DaneJoe::StringifyCapture& capture)
+{
+    std::vector<std::string> lines;
+    capture.drain([&](std::string_view text)
+        {
+            lines.emplace_back(text);
+        });
+    return lines;
+}
+
+template<class T>
+void expect_same_as_to_string(const T& value)
+{
+    DaneJoe::StringifyCapture capture(4096);
+    ASSERT_TRUE(capture.capture(value));
+    const auto lines = drain_all(capture);
+    ASSERT_EQ(lines.size(), 1u);
+    EXPECT_EQ(lines[0], DaneJoe::to_string(value));
+}
+
+} // namespace
+
+TEST(StringifyCaptureTest, Render_MatchesToString)
+{
+    expect_same_as_to_string(42);
+    expect_same_as_to_string(static_cast<int8_t>(-5));
+    expect_same_as_to_string(static_cast<unsigned short>(65535));
+    expect_same_as_to_string(18446744073709551615ull);
+    expect_same_as_to_string(3.25);
+    expect_same_as_to_string(1.5f);
+    expect_same_as_to_string('c');
+    expect_same_as_to_string(true);
+    expect_same_as_to_string(std::string("text"));
+    expect_same_as_to_string(std::string_view("view"));
+    expect_same_as_to_string(L"wide");
+    expect_same_as_to_string(u"utf16");
+    expect_same_as_to_string(U"utf32");
+    expect_same_as_to_string(u8"utf8");
+    wchar_t wide_buffer[8] = L"array";
+    expect_same_as_to_string(wide_buffer);
+    expect_same_as_to_string(Side::Sell);
+    expect_same_as_to_string(DaneJoe::StorageUnit::KiloByte);
+    expect_same_as_to_string(Order());
+    expect_same_as_to_string(std::chrono::microseconds(12));
+    expect_same_as_to_string(std::chrono::duration<double>(1.5));
+    expect_same_as_to_string(std::chrono::minutes(3));
+    expect_same_as_to_string(std::chrono::system_clock::now());
+    expect_same_as_to_string(std::make_pair(1, std::string("one")));
+    expect_same_as_to_string(std::make_tuple(1, 'x', false));
+    expect_same_as_to_string(std::optional<int>());
+    expect_same_as_to_string(std::variant<int, std::string>("alt"));
+    expect_same_as_to_string(std::map<int, std::vector<double>>{ { 1, { 0.5 } }, { 2, {} } });
+    const int array[3] = { 7, 8, 9 };
+    expect_same_as_to_string(array);
+}
+
+TEST(StringifyCaptureTest, Render_AppliesElementLimit)
+{
+    DaneJoe::StringifyConfig config;
+    config.max_stringify_element_count = 2;
+    const DaneJoe::StringifyConfig old_config = DaneJoe::StringifyConfigManager::get_config();
+    DaneJoe::StringifyConfigManager::set_config(config);
+    expect_same_as_to_string(std::vector<std::vector<int>>{ { 1, 2, 3 }, { 4 }, { 5 } });
+    DaneJoe::StringifyConfigManager::set_config(old_config);
+}
+
+TEST(StringifyCaptureTest, MultipleArguments_AreConcatenated)
+{
+    DaneJoe::StringifyCapture capture;
+    ASSERT_TRUE(capture.capture("px=", 101.5, " qty=", 3, " side=", 'B'));
+    const auto lines = drain_all(capture);
+    ASSERT_EQ(lines.size(), 1u);
+    EXPECT_EQ(lines[0], "px=101.5 qty=3 side=B");
+}
+
+TEST(StringifyCaptureTest, ShortLivedCaptures_EachSeesOwnRecords)
+{
+    // 同一线程依次使用大量短期会话，线程缓存随之清理
+    for (int i = 0; i < 1000; ++i)
+    {
+        DaneJoe::StringifyCapture capture(256);
+        ASSERT_TRUE(capture.capture(i));
+        const auto lines = drain_all(capture);
+        ASSERT_EQ(lines.size(), 1u);
+        EXPECT_EQ(lines[0], std::to_string(i));
+    }
+}
+
+TEST(StringifyCaptureTest, ExitedThreads_RingsReleasedAfterDrain)
+{
+    // 长期存活的会话经历大量短期线程，已退出线程的环形缓冲在取空后释放
+    DaneJoe::StringifyCapture capture(256);
+    std::size_t total = 0;
+    for (int i = 0; i < 64; ++i)
+    {
+        std::thread([&capture, i]()
+            {
+                EXPECT_TRUE(capture.capture(i));
+            }).join();
+        total += drain_all(capture).size();
+        EXPECT_EQ(capture.get_thread_ring_count(), 0u);
+    }
+    EXPECT_EQ(total, 64u);
+    // 存活线程的环形缓冲保留
+    ASSERT_TRUE(capture.capture(1));
+    EXPECT_EQ(drain_all(capture).size(), 1u);
+    EXPECT_EQ(capture.get_thread_ring_count(), 1u);
+    EXPECT_EQ(capture.get_decode_failure_count(), 0u);
+}
+
+TEST(StringifyCaptureTest, FullRing_DropsRecords)
+{
+    DaneJoe::StringifyCapture capture(64);
+    std::size_t accepted = 0;
+    for (int i = 0; i < 100; ++i)
+    {
+        accepted += capture.capture(i) ? 1 : 0;
+    }
+    EXPECT_GT(accepted, 0u);
+    EXPECT_LT(accepted, 100u);
+    EXPECT_EQ(capture.get_dropped_count(), 100u - accepted);
+    EXPECT_EQ(drain_all(capture).size(), accepted);
+    // 取出后空间重新可用
+    EXPECT_TRUE(capture.capture(1));
+}
+
+TEST(StringifyCaptureTest, ManyThreads_AllRecordsDrained)
+{
+    constexpr int thread_count = 4;
+    constexpr int record_count = 10000;
+    DaneJoe::StringifyCapture capture(1 << 16);
+    std::mutex mutex;
+    std::vector<std::string> lines;
+    capture.start_background([&](std::string_view text)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            lines.emplace_back(text);
+        }, std::chrono::milliseconds(1));
+    std::vector<std::thread> threads;
+    for (int t = 0; t < thread_count; ++t)
+    {
+        threads.emplace_back([&capture, t]()
+            {
+                for (int i = 0; i < record_count; ++i)
+                {
+                    while (!capture.capture(t, ':', i))
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    capture.stop_background();
+    ASSERT_EQ(lines.size(), static_cast<std::size_t>(thread_count * record_count));
+    std::array<int, thread_count> next_index{};
+    for (const std::string& line : lines)
+    {
+        // 同一线程的记录保持捕获顺序
+        const std::size_t colon = line.find(':');
+        const int t = std::stoi(line.substr(0, colon));
+        EXPECT_EQ(std::stoi(line.substr(colon + 1)), next_index[t]);
+        ++next_index[t];
+    }
+}
+
+TEST(StringifyCaptureTest, BinaryFrames_DecodeOffline)
+{
+    DaneJoe::StringifyCapture capture;
+    capture.capture(std::vector<int>{ 1, 2 });
+    capture.capture("done");
+    std::string file;
+    EXPECT_EQ(capture.drain_binary([&](std::string_view frame)
+        {
+            file.append(frame);
+        }), 2u);
+
+    std::vector<std::string> lines;
+    const auto config = DaneJoe::StringifyConfigManager::get_config_snapshot();
+    EXPECT_TRUE(DaneJoe::decode_capture_frames(file, [&](std::string_view text)
+        {
+            lines.emplace_back(text);
+        }, *config));
+    ASSERT_EQ(lines.size(), 2u);
+    EXPECT_EQ(lines[0], "[1, 2]");
+    EXPECT_EQ(lines[1], "done");
+
+    file.pop_back();
+    EXPECT_FALSE(DaneJoe::decode_capture_frames(file, [](std::string_view) {}, *config));
+}
@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "danejoe/stringify/stringify_column.hpp"
+#include "danejoe/stringify/stringify_to_string.hpp"
+
+namespace
+{
+
+/**
+ * @brief 校验列中每个值与逐个调用append_to_string的结果一致
+ */
+template<class T, class Offset>
+void expect_column_matches(const std::vector<T>& values, const std::string& buffer,
+    const std::vector<Offset>& offsets, const DaneJoe::StringifyConfig& config)
+{
+    ASSERT_EQ(offsets.size(), values.size() + 1);
+    EXPECT_EQ(static_cast<std::size_t>(offsets.back()), buffer.size());
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+        std::string expected;
+        DaneJoe::append_to_string(expected, values[i], config);
+        const auto begin = static_cast<std::size_t>(offsets[i]);
+        const auto end = static_cast<std::size_t>(offsets[i + 1]);
+        EXPECT_EQ(std::string_view(buffer).substr(begin, end - begin), expected) << i;
+    }
+}
+
+} // namespace
+
+TEST(StringifyColumnTest, Integers_MatchPerValue)
+{
+    std::mt19937_64 engine(20261018);
+    std::vector<int64_t> values = { 0, -1, std::numeric_limits<int64_t>::min(), std::numeric_limits<int64_t>::max() };
+    for (int i = 0; i < 10000; ++i)
+    {
+        values.push_back(static_cast<int64_t>(engine() >> (engine() % 64)));
+    }
+    const DaneJoe::StringifyConfig config;
+    std::string buffer;
+    std::vector<int64_t> offsets;
+    DaneJoe::stringify_column(std::span<const int64_t>(values), buffer, offsets, config);
+    expect_column_matches(values, buffer, offsets, config);
+}
+
+TEST(StringifyColumnTest, IntegerConfig_AppliedOncePerBatch)
+{
+    DaneJoe::StringifyConfig config;
+    config.integer_base = DaneJoe::IntegerBase::Hexadecimal;
+    config.is_show_integer_prefix = true;
+    config.integer_width = 4;
+    config.integer_group_symbol = "_";
+    config.integer_group_size = 2;
+    std::vector<int> values;
+    for (int i = -5000; i < 5000; i += 7)
+    {
+        values.push_back(i * 977);
+    }
+    std::string buffer;
+    std::vector<uint32_t> offsets;
+    DaneJoe::stringify_column(std::span<const int>(values), buffer, offsets, config);
+    expect_column_matches(values, buffer, offsets, config);
+}
+
+TEST(StringifyColumnTest, GenericTypes_UseSameDispatch)
+{
+    const DaneJoe::StringifyConfig config;
+    const std::vector<double> doubles = { 0.1, -2.5, 1e300, 3 };
+    std::string buffer;
+    std::vector<int32_t> offsets;
+    DaneJoe::stringify_column(std::span<const double>(doubles), buffer, offsets, config);
+    expect_column_matches(doubles, buffer, offsets, config);
+
+    std::vector<std::string> strings;
+    for (int i = 0; i < 100; ++i)
+    {
+        strings.push_back(std::string(static_cast<std::size_t>(i % 7), 'a' + i % 26));
+    }
+    std::string text_buffer;
+    std::vector<int32_t> text_offsets;
+    DaneJoe::stringify_column(std::span<const std::string>(strings), text_buffer, text_offsets, config);
+    expect_column_matches(strings, text_buffer, text_offsets, config);
+
+    // char按字符输出，不走整数路径
+    const std::vector<char> chars = { 'x', 'y' };
+    std::string char_buffer;
+    std::vector<int32_t> char_offsets;
+    DaneJoe::stringify_column(std::span<const char>(chars), char_buffer, char_offsets, config);
+    EXPECT_EQ(char_buffer, "xy");
+}
+
+TEST(StringifyColumnTest, Batches_AppendToSameBuffer)
+{
+    const std::vector<int> first = { 1, 22 };
+    const std::vector<int> second = { 333 };
+    std::string buffer;
+    std::vector<int32_t> offsets;
+    DaneJoe::stringify_column(std::span<const int>(first), buffer, offsets);
+    DaneJoe::stringify_column(std::span<const int>(second), buffer, offsets);
+    DaneJoe::stringify_column(std::span<const int>(), buffer, offsets);
+    EXPECT_EQ(buffer, "122333");
+    EXPECT_EQ(offsets, (std::vector<int32_t>{ 0, 1, 3, 6 }));
+}
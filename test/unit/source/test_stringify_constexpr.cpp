@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <utility>
+
+#include "danejoe/stringify/stringify_constexpr.hpp"
+#include "danejoe/stringify/stringify_format.hpp"
+#include "danejoe/stringify/stringify_to_string.hpp"
+
+namespace
+{
+
+enum class Color : uint8_t
+{
+    Red,
+    Green = 5
+};
+
+enum Plain : int
+{
+    PlainFirst = -2,
+    PlainSecond
+};
+
+/// 未指定底层类型，编译期枚举名不支持
+enum Unfixed
+{
+    UnfixedFirst
+};
+
+// 以下均在编译期求值
+constexpr auto integer_text = DaneJoe::to_fixed_string<-1234567>();
+static_assert(integer_text == std::string_view("-1234567"));
+static_assert(integer_text.size() == 8);
+static_assert(DaneJoe::to_fixed_string<0>() == std::string_view("0"));
+static_assert(DaneJoe::to_fixed_string<INT64_MIN>() == std::string_view("-9223372036854775808"));
+static_assert(DaneJoe::to_fixed_string<true>() == std::string_view("true"));
+static_assert(DaneJoe::to_fixed_string<'x'>() == std::string_view("x"));
+static_assert(DaneJoe::to_fixed_string<Color::Green>() == std::string_view("Color::Green"));
+static_assert(DaneJoe::to_fixed_string<static_cast<Color>(3)>() == std::string_view("Color(3)"));
+static_assert(DaneJoe::to_fixed_string<PlainFirst>() == std::string_view("Plain::PlainFirst"));
+static_assert(DaneJoe::has_fixed_underlying_type<Color>::value);
+static_assert(DaneJoe::has_fixed_underlying_type<Plain>::value);
+static_assert(!DaneJoe::has_fixed_underlying_type<Unfixed>::value);
+static_assert(DaneJoe::to_fixed_string<DaneJoe::StorageUnit::KiloByte>() ==
+    std::string_view("StorageUnit::KiloByte"));
+static_assert(DANEJOE_FIXED_STRING("label") == std::string_view("label"));
+static_assert(DANEJOE_FIXED_STRING(std::array<int, 3>{ 1, -2, 3 }) == std::string_view("[1, -2, 3]"));
+static_assert(DANEJOE_FIXED_STRING(std::pair<int, bool>{ 1, false }) == std::string_view("{1: false}"));
+static_assert(DANEJOE_FIXED_STRING(std::tuple<const char*, int, char>{ "id", 7, 'c' }) ==
+    std::string_view("(id, 7, c)"));
+static_assert(DANEJOE_FIXED_STRING(std::tuple<>{}) == std::string_view("()"));
+
+/// 编译期生成的标签表，视图指向静态存储
+constexpr std::array<std::string_view, 3> position_labels = {
+    DaneJoe::fixed_string_v<DaneJoe::FormatPosition::LEFT>,
+    DaneJoe::fixed_string_v<DaneJoe::FormatPosition::CENTER>,
+    DaneJoe::fixed_string_v<DaneJoe::FormatPosition::RIGHT> };
+
+} // namespace
+
+TEST(StringifyConstexprTest, MatchesRuntimeToString)
+{
+    EXPECT_EQ(integer_text.view(), DaneJoe::to_string(-1234567));
+    EXPECT_EQ(std::string(DANEJOE_FIXED_STRING(std::array<std::pair<int, bool>, 2>{ { { 1, true }, { 2, false } } })),
+        DaneJoe::to_string(std::array<std::pair<int, bool>, 2>{ { { 1, true }, { 2, false } } }));
+    const auto tuple_text = DANEJOE_FIXED_STRING(std::tuple<std::string_view, int64_t, bool>{ "a", -9, true });
+    EXPECT_EQ(tuple_text.view(), DaneJoe::to_string(std::tuple<std::string_view, int64_t, bool>{ "a", -9, true }));
+    EXPECT_STREQ(tuple_text.c_str(), "(a, -9, true)");
+}
+
+TEST(StringifyConstexprTest, EnumLabels_MatchDebugNames)
+{
+    EXPECT_EQ(position_labels[0], DaneJoe::to_string(DaneJoe::FormatPosition::LEFT));
+    EXPECT_EQ(position_labels[1], DaneJoe::to_string(DaneJoe::FormatPosition::CENTER));
+    EXPECT_EQ(position_labels[2], DaneJoe::to_string(DaneJoe::FormatPosition::RIGHT));
+    constexpr auto unit = DaneJoe::to_fixed_string<DaneJoe::StorageUnit::PetaByte>();
+    EXPECT_EQ(unit.view(), DaneJoe::to_string(DaneJoe::StorageUnit::PetaByte));
+}
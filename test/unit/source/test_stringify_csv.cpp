@@ -0,0 +1,161 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "danejoe/stringify/stringify_csv.hpp"
+#include "danejoe/stringify/stringify_to_string.hpp"
+
+namespace
+{
+
+/**
+ * @brief 使用默认配置输出，行结束符为LF
+ */
+template<class Rows>
+std::string to_csv(const Rows& rows, char delimiter = ',')
+{
+    DaneJoe::StringifyCsvOptions options;
+    options.delimiter = delimiter;
+    options.line_terminator = "\n";
+    std::string out;
+    DaneJoe::stringify_csv(rows, out, options, DaneJoe::StringifyConfig());
+    return out;
+}
+
+/**
+ * @brief 聚合体行
+ */
+struct Trade
+{
+    std::string symbol;
+    int quantity = 0;
+    double price = 0.0;
+};
+
+/**
+ * @brief 写入时总是抛出异常的输出端
+ */
+struct ThrowingSink
+{
+    void append(const char*, std::size_t)
+    {
+        throw std::runtime_error("sink failed");
+    }
+};
+
+} // namespace
+
+TEST(StringifyCsvTest, Tuples_OneCellPerElement)
+{
+    const std::vector<std::tuple<int, std::string, double>> rows = { { 1, "a", 1.5 }, { 2, "b", -2.0 } };
+    EXPECT_EQ(to_csv(rows), "1,a,1.5\n2,b,-2\n");
+}
+
+TEST(StringifyCsvTest, Pairs_AndDefaultCrLf)
+{
+    const std::vector<std::pair<std::string, int>> rows = { { "x", 1 }, { "y", 2 } };
+    EXPECT_EQ(DaneJoe::stringify_csv(rows), "x,1\r\ny,2\r\n");
+}
+
+TEST(StringifyCsvTest, Quoting_Rfc4180)
+{
+    const std::vector<std::tuple<std::string, std::string>> rows = {
+        { "plain", "a,b" },
+        { "say \"hi\"", "line1\nline2" },
+        { "carriage\r", "a long cell without specials" },
+    };
+    EXPECT_EQ(to_csv(rows),
+        "plain,\"a,b\"\n"
+        "\"say \"\"hi\"\"\",\"line1\nline2\"\n"
+        "\"carriage\r\",a long cell without specials\n");
+}
+
+TEST(StringifyCsvTest, Quoting_SpecialsPastFirstWord)
+{
+    const std::string text = "0123456789abcdef\"0123456789";
+    const std::vector<std::array<std::string, 1>> rows = { { text } };
+    EXPECT_EQ(to_csv(rows), "\"0123456789abcdef\"\"0123456789\"\n");
+}
+
+TEST(StringifyCsvTest, Tsv_QuotesOnlyTabs)
+{
+    const std::vector<std::tuple<std::string, std::string>> rows = { { "a,b", "c\td" } };
+    EXPECT_EQ(to_csv(rows, '\t'), "a,b\t\"c\td\"\n");
+}
+
+TEST(StringifyCsvTest, StringRows_SingleCell)
+{
+    EXPECT_EQ(to_csv(std::vector<std::string_view>{ "a,b", "cd" }), "\"a,b\"\ncd\n");
+    EXPECT_EQ(to_csv(std::vector<std::u16string>{ u"a,b", u"cd" }), "\"a,b\"\ncd\n");
+    EXPECT_EQ(to_csv(std::vector<std::wstring_view>{ L"wide" }), "wide\n");
+    EXPECT_EQ(to_csv(std::vector<const wchar_t*>{ L"x,y" }), "\"x,y\"\n");
+}
+
+TEST(StringifyCsvTest, NestedValues_RenderedAndQuoted)
+{
+    const std::vector<std::tuple<int, std::vector<int>, std::optional<int>>> rows = { { 1, { 2, 3 }, std::nullopt } };
+    EXPECT_EQ(to_csv(rows), "1,\"[2, 3]\",<null>\n");
+}
+
+TEST(StringifyCsvTest, Aggregates_OneCellPerMember)
+{
+    const std::vector<Trade> rows = { { "ABC", 10, 1.25 }, { "X,Y", 5, 2.0 } };
+    EXPECT_EQ(to_csv(rows), "ABC,10,1.25\n\"X,Y\",5,2\n");
+    static_assert(DaneJoe::get_aggregate_field_count<Trade>() == 3);
+}
+
+TEST(StringifyCsvTest, Writer_HeaderRangesAndAlwaysQuote)
+{
+    DaneJoe::StringifyCsvOptions options;
+    options.line_terminator = "\n";
+    options.is_always_quote = true;
+    std::string out;
+    {
+        DaneJoe::StringifyCsvWriter<std::string> writer(out, options, DaneJoe::StringifyConfig());
+        writer.write_row({ "id", "values" });
+        writer.write_row(std::vector<int>{ 1, 2 });
+        EXPECT_EQ(writer.get_row_count(), 2u);
+    }
+    EXPECT_EQ(out, "\"id\",\"values\"\n\"1\",\"2\"\n");
+}
+
+TEST(StringifyCsvTest, Stream_FlushesAtBufferSize)
+{
+    DaneJoe::StringifyCsvOptions options;
+    options.buffer_size = 16;
+    std::ostringstream stream;
+    std::vector<std::tuple<int, int>> rows;
+    std::string expected;
+    for (int i = 0; i < 1000; ++i)
+    {
+        rows.emplace_back(i, -i);
+        expected += std::to_string(i) + "," + std::to_string(-i) + "\r\n";
+    }
+    DaneJoe::StringifyCsvWriter<std::ostream> writer(stream, options, DaneJoe::StringifyConfig());
+    writer.write_rows(rows);
+    // 缓冲中至多保留不足阈值的内容
+    EXPECT_GE(stream.str().size() + options.buffer_size, expected.size());
+    writer.flush();
+    EXPECT_EQ(stream.str(), expected);
+}
+
+TEST(StringifyCsvTest, Writer_DestructorSwallowsSinkErrors)
+{
+    ThrowingSink sink;
+    {
+        DaneJoe::StringifyCsvWriter<ThrowingSink> writer(sink, DaneJoe::StringifyCsvOptions(), DaneJoe::StringifyConfig());
+        writer.write_row(std::tuple<int, int>{ 1, 2 });
+        // 显式flush时异常正常传播，缓冲保留
+        EXPECT_THROW(writer.flush(), std::runtime_error);
+        EXPECT_EQ(writer.get_row_count(), 1u);
+    }
+    // 析构时再次写入失败，异常不逃出析构函数
+}
@@ -0,0 +1,142 @@
+#include <gtest/gtest.h>
+
+#include <deque>
+#include <list>
+#include <map>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "danejoe/stringify/stringify_deep_size.hpp"
+
+namespace
+{
+
+/// 超出任何实现短字符串缓冲的长度
+constexpr std::size_t long_length = 100;
+
+/**
+ * @brief 按行拆分报告
+ */
+std::vector<std::string> split_lines(const std::string& text)
+{
+    std::vector<std::string> lines;
+    std::size_t begin = 0;
+    for (std::size_t end = text.find('\n'); end != std::string::npos; end = text.find('\n', begin))
+    {
+        lines.push_back(text.substr(begin, end - begin));
+        begin = end + 1;
+    }
+    lines.push_back(text.substr(begin));
+    return lines;
+}
+
+} // namespace
+
+TEST(StringifyDeepSizeTest, Scalars_OnlyInline)
+{
+    const auto size = DaneJoe::deep_size(42);
+    EXPECT_EQ(size.inline_size, sizeof(int));
+    EXPECT_EQ(size.heap_size, 0u);
+    EXPECT_EQ(DaneJoe::deep_size(std::make_pair(1, 2.0)).heap_size, 0u);
+}
+
+TEST(StringifyDeepSizeTest, String_ShortStringOptimizationAware)
+{
+    EXPECT_EQ(DaneJoe::deep_size(std::string("abc")).heap_size, 0u);
+    std::string text(long_length, 'x');
+    text.reserve(long_length * 2);
+    const auto size = DaneJoe::deep_size(text);
+    EXPECT_EQ(size.heap_size, text.capacity() + 1);
+    EXPECT_EQ(size.slack_size, text.capacity() - text.size());
+    EXPECT_EQ(DaneJoe::deep_size(std::u32string(long_length, U'x')).heap_size,
+        (std::u32string(long_length, U'x').capacity() + 1) * sizeof(char32_t));
+}
+
+TEST(StringifyDeepSizeTest, Vector_CapacityAndSlack)
+{
+    std::vector<int> values(10);
+    values.reserve(100);
+    const auto size = DaneJoe::deep_size(values);
+    EXPECT_EQ(size.inline_size, sizeof(values));
+    EXPECT_EQ(size.heap_size, 100 * sizeof(int));
+    EXPECT_EQ(size.slack_size, 90 * sizeof(int));
+    EXPECT_EQ(size.node_overhead_size, 0u);
+
+    std::vector<std::string> strings(2);
+    strings[1].assign(long_length, 'y');
+    EXPECT_EQ(DaneJoe::deep_size(strings).heap_size,
+        strings.capacity() * sizeof(std::string) + strings[1].capacity() + 1);
+}
+
+TEST(StringifyDeepSizeTest, NodeContainers_CountNodeOverhead)
+{
+    std::map<int, int> tree;
+    std::list<int> list;
+    std::unordered_map<int, int> table;
+    for (int i = 0; i < 100; ++i)
+    {
+        tree[i] = i;
+        list.push_back(i);
+        table[i] = i;
+    }
+    for (const auto& size : { DaneJoe::deep_size(tree), DaneJoe::deep_size(list), DaneJoe::deep_size(table) })
+    {
+        EXPECT_GT(size.node_overhead_size, 0u);
+        EXPECT_EQ(size.slack_size, 0u);
+    }
+    EXPECT_EQ(DaneJoe::deep_size(tree).heap_size - DaneJoe::deep_size(tree).node_overhead_size,
+        100 * sizeof(std::pair<const int, int>));
+    // 桶数组计入节点开销
+    EXPECT_GE(DaneJoe::deep_size(table).node_overhead_size, table.bucket_count() * sizeof(void*));
+    EXPECT_GT(DaneJoe::deep_size(std::deque<int>(1000)).heap_size, 1000 * sizeof(int));
+}
+
+TEST(StringifyDeepSizeTest, Wrappers_AndViews)
+{
+    const std::string text(long_length, 'z');
+    const std::size_t text_heap = DaneJoe::deep_size(text).heap_size;
+    EXPECT_EQ(DaneJoe::deep_size(std::optional<std::string>(text)).heap_size, text_heap);
+    EXPECT_EQ(DaneJoe::deep_size(std::optional<std::string>()).heap_size, 0u);
+    EXPECT_EQ(DaneJoe::deep_size(std::variant<int, std::string>(text)).heap_size, text_heap);
+    EXPECT_EQ(DaneJoe::deep_size(std::make_tuple(1, text, text)).heap_size, 2 * text_heap);
+    // 非拥有的视图不计堆内存
+    EXPECT_EQ(DaneJoe::deep_size(std::string_view(text)).heap_size, 0u);
+    const std::vector<int> values(100);
+    EXPECT_EQ(DaneJoe::deep_size(std::span<const int>(values)).heap_size, 0u);
+}
+
+TEST(StringifyDeepSizeTest, Report_SortedAndBounded)
+{
+    std::map<std::string, std::vector<int>> value;
+    value["small"] = std::vector<int>(10);
+    value["large"] = std::vector<int>(1000);
+    value["medium"] = std::vector<int>(100);
+    DaneJoe::DeepSizeOptions options;
+    options.max_entry_count = 3;
+    const DaneJoe::StringifyConfig config;
+    const auto lines = split_lines(DaneJoe::format_deep_size(value, options, config));
+    ASSERT_EQ(lines.size(), 5u);
+    EXPECT_EQ(lines[0].rfind("total: ", 0), 0u);
+    EXPECT_EQ(lines[1].rfind("$: ", 0), 0u);
+    EXPECT_EQ(lines[2], "$[large]: 3.91 KB (slack: 0 B, node overhead: 0 B)");
+    EXPECT_EQ(lines[3].rfind("$[medium]: 400 B", 0), 0u);
+    EXPECT_EQ(lines[4], "...");
+
+    options.max_entry_count = 0;
+    EXPECT_EQ(split_lines(DaneJoe::format_deep_size(value, options, config)).size(), 1u);
+}
+
+TEST(StringifyDeepSizeTest, CapacityUnit_LargestUnitAtLeastOne)
+{
+    const DaneJoe::StringifyConfig config;
+    EXPECT_EQ(DaneJoe::get_capacity_unit(1023, config), DaneJoe::StorageUnit::Byte);
+    EXPECT_EQ(DaneJoe::get_capacity_unit(1024, config), DaneJoe::StorageUnit::KiloByte);
+    EXPECT_EQ(DaneJoe::get_capacity_unit(3u << 20, config), DaneJoe::StorageUnit::MegaByte);
+}
@@ -0,0 +1,173 @@
+#include <gtest/gtest.h>
+
+#include <list>
+#include <map>
+#include <numeric>
+#include <optional>
+#include <set>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "danejoe/stringify/stringify_diff.hpp"
+#include "danejoe/stringify/stringify_to_string.hpp"
+
+namespace
+{
+
+/**
+ * @brief 使用默认配置比较，不输出上下文
+ */
+template<class T>
+std::string diff(const T& a, const T& b, std::size_t context_count = 0)
+{
+    DaneJoe::StringifyDiffOptions options;
+    options.context_count = context_count;
+    return DaneJoe::stringify_diff(a, b, options, DaneJoe::StringifyConfig());
+}
+
+/**
+ * @brief 不支持operator==的类型，按输出比较
+ */
+struct Point
+{
+    int x = 0;
+    int y = 0;
+    std::string to_string() const
+    {
+        return "(" + std::to_string(x) + ", " + std::to_string(y) + ")";
+    }
+};
+
+} // namespace
+
+TEST(StringifyDiffTest, Equal_Empty)
+{
+    EXPECT_EQ(diff(1, 1), "");
+    EXPECT_EQ(diff(std::vector<int>{ 1, 2, 3 }, std::vector<int>{ 1, 2, 3 }), "");
+    EXPECT_EQ(diff(std::string("abc"), std::string("abc")), "");
+}
+
+TEST(StringifyDiffTest, Leaf_Change)
+{
+    EXPECT_EQ(diff(1, 2), "~ $: 1 -> 2\n");
+    EXPECT_EQ(diff(std::string("abc"), std::string("abd")), "~ $: abc -> abd\n");
+    EXPECT_EQ(diff(Point{ 1, 2 }, Point{ 1, 3 }), "~ $: (1, 2) -> (1, 3)\n");
+}
+
+TEST(StringifyDiffTest, CString_NullAndContent)
+{
+    const char* null_text = nullptr;
+    const char* text = "x";
+    const std::string copy = "x";
+    EXPECT_EQ(diff(null_text, null_text), "");
+    EXPECT_EQ(diff(null_text, text), "~ $: <null> -> x\n");
+    EXPECT_EQ(diff(text, null_text), "~ $: x -> <null>\n");
+    EXPECT_EQ(diff(text, copy.c_str()), "");
+    const char16_t* wide_text = u"ab";
+    const std::u16string wide_copy = u"ab";
+    const char16_t* null_wide_text = nullptr;
+    EXPECT_EQ(diff(wide_text, wide_copy.c_str()), "");
+    EXPECT_EQ(diff(wide_text, null_wide_text), "~ $: ab -> <null>\n");
+}
+
+TEST(StringifyDiffTest, Sequence_ChangeInsertDelete)
+{
+    EXPECT_EQ(diff(std::vector<int>{ 1, 2, 3, 4 }, std::vector<int>{ 1, 5, 3, 4 }), "~ $[1]: 2 -> 5\n");
+    EXPECT_EQ(diff(std::vector<int>{ 1, 2, 3 }, std::vector<int>{ 1, 2, 9, 3 }), "+ $[2]: 9\n");
+    EXPECT_EQ(diff(std::vector<int>{ 1, 2, 3 }, std::vector<int>{ 1, 3 }), "- $[1]: 2\n");
+    EXPECT_EQ(diff(std::vector<int>{ 1, 2, 3 }, std::vector<int>{}), "- $[0]: 1\n- $[1]: 2\n- $[2]: 3\n");
+}
+
+TEST(StringifyDiffTest, Sequence_Context)
+{
+    const std::vector<int> a = { 0, 1, 2, 3, 4, 5, 6, 7 };
+    std::vector<int> b = a;
+    b[2] = 20;
+    b[6] = 60;
+    EXPECT_EQ(diff(a, b, 1),
+        "  $[1]: 1\n~ $[2]: 2 -> 20\n  $[3]: 3\n"
+        "  $[5]: 5\n~ $[6]: 6 -> 60\n  $[7]: 7\n");
+    b[4] = 40;
+    // 相邻差异之间的上下文不重复输出
+    EXPECT_EQ(diff(a, b, 1),
+        "  $[1]: 1\n~ $[2]: 2 -> 20\n  $[3]: 3\n~ $[4]: 4 -> 40\n"
+        "  $[5]: 5\n~ $[6]: 6 -> 60\n  $[7]: 7\n");
+}
+
+TEST(StringifyDiffTest, Sequence_NestedPath)
+{
+    const std::vector<std::pair<std::string, std::vector<int>>> a = { { "a", { 1, 2 } }, { "b", { 3 } } };
+    auto b = a;
+    b[1].second.push_back(4);
+    b[0].first = "c";
+    EXPECT_EQ(diff(a, b), "~ $[0].first: a -> c\n+ $[1].second[1]: 4\n");
+}
+
+TEST(StringifyDiffTest, LargeVector_FewDifferences)
+{
+    std::vector<int> a(1000000);
+    std::iota(a.begin(), a.end(), 0);
+    std::vector<int> b = a;
+    b[10] = -1;
+    b.erase(b.begin() + 500000);
+    b.insert(b.begin() + 900000, 7);
+    EXPECT_EQ(diff(a, b), "~ $[10]: 10 -> -1\n- $[500000]: 500000\n+ $[900000]: 7\n");
+}
+
+TEST(StringifyDiffTest, Sequence_FallsBackToIndexBeyondEditDistance)
+{
+    const std::vector<int> a = { 1, 2, 3, 4 };
+    const std::vector<int> b = { 5, 6, 7 };
+    DaneJoe::StringifyDiffOptions options;
+    options.context_count = 0;
+    options.max_edit_distance = 2;
+    EXPECT_EQ(DaneJoe::stringify_diff(a, b, options, DaneJoe::StringifyConfig()),
+        "~ $[0]: 1 -> 5\n~ $[1]: 2 -> 6\n~ $[2]: 3 -> 7\n- $[3]: 4\n");
+}
+
+TEST(StringifyDiffTest, List_ComparedByIndex)
+{
+    EXPECT_EQ(diff(std::list<int>{ 1, 2, 3 }, std::list<int>{ 1, 4, 3, 5 }), "~ $[1]: 2 -> 4\n+ $[3]: 5\n");
+}
+
+TEST(StringifyDiffTest, Map_ByKey)
+{
+    const std::map<std::string, int> a = { { "a", 1 }, { "b", 2 }, { "c", 3 } };
+    const std::map<std::string, int> b = { { "a", 1 }, { "b", 20 }, { "d", 4 } };
+    EXPECT_EQ(diff(a, b), "~ $[b]: 2 -> 20\n- $[c]: 3\n+ $[d]: 4\n");
+
+    const std::unordered_map<int, int> c = { { 1, 1 }, { 2, 2 } };
+    const std::unordered_map<int, int> d = { { 1, 10 }, { 2, 2 } };
+    EXPECT_EQ(diff(c, d), "~ $[1]: 1 -> 10\n");
+}
+
+TEST(StringifyDiffTest, Set_Members)
+{
+    EXPECT_EQ(diff(std::set<int>{ 1, 2, 3 }, std::set<int>{ 2, 3, 4 }), "- $: 1\n+ $: 4\n");
+}
+
+TEST(StringifyDiffTest, OptionalVariantTuple)
+{
+    EXPECT_EQ(diff(std::optional<int>(1), std::optional<int>()), "~ $: 1 -> <null>\n");
+    EXPECT_EQ(diff(std::optional<int>(1), std::optional<int>(2)), "~ $: 1 -> 2\n");
+    using Variant = std::variant<int, std::string>;
+    EXPECT_EQ(diff(Variant(1), Variant(std::string("x"))), "~ $: 1 -> x\n");
+    EXPECT_EQ(diff(Variant(1), Variant(2)), "~ $: 1 -> 2\n");
+    EXPECT_EQ(diff(std::make_tuple(1, std::string("a"), 3.5), std::make_tuple(1, std::string("b"), 3.5)),
+        "~ $.1: a -> b\n");
+}
+
+TEST(StringifyDiffTest, MaxDifferenceCount_Truncates)
+{
+    std::vector<int> a(100, 0);
+    std::vector<int> b(100, 1);
+    DaneJoe::StringifyDiffOptions options;
+    options.max_difference_count = 2;
+    options.max_edit_distance = 0;
+    EXPECT_EQ(DaneJoe::stringify_diff(a, b, options, DaneJoe::StringifyConfig()),
+        "~ $[0]: 0 -> 1\n~ $[1]: 0 -> 1\n...\n");
+}
@@ -0,0 +1,96 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "danejoe/stringify/stringify_format.hpp"
+#include "danejoe/stringify/stringify_to_string.hpp"
+
+namespace
+{
+
+std::string render(double value, DaneJoe::FloatFormat format, int precision = -1)
+{
+    DaneJoe::StringifyConfig config;
+    config.float_format = format;
+    config.float_precision = precision;
+    std::string result;
+    DaneJoe::append_to_string(result, value, config);
+    return result;
+}
+
+} // namespace
+
+TEST(StringifyFloatingTest, Default_IsShortestRoundTrip)
+{
+    EXPECT_EQ(DaneJoe::to_string(0.1), "0.1");
+    EXPECT_EQ(DaneJoe::to_string(1e-9), "1e-09");
+    EXPECT_EQ(DaneJoe::to_string(1e300), "1e+300");
+    EXPECT_EQ(DaneJoe::to_string(2.0), "2");
+    EXPECT_EQ(DaneJoe::to_string(-0.0), "-0");
+    EXPECT_EQ(DaneJoe::to_string(1.5f), "1.5");
+    EXPECT_EQ(DaneJoe::to_string(std::numeric_limits<double>::infinity()), "inf");
+    EXPECT_EQ(DaneJoe::from_std_to_string(0.25), "0.25");
+}
+
+TEST(StringifyFloatingTest, Shortest_RoundTripsRandomBits)
+{
+    std::mt19937_64 engine(20261018);
+    for (int i = 0; i < 10000; ++i)
+    {
+        const uint64_t bits = engine();
+        double value;
+        std::memcpy(&value, &bits, sizeof(value));
+        if (!std::isfinite(value))
+        {
+            continue;
+        }
+        const std::string text = DaneJoe::to_string(value);
+        // strtod可正确解析次正规数
+        EXPECT_EQ(std::strtod(text.c_str(), nullptr), value) << text;
+    }
+}
+
+TEST(StringifyFloatingTest, Config_SelectsFormatAndPrecision)
+{
+    using DaneJoe::FloatFormat;
+    EXPECT_EQ(render(1.5, FloatFormat::Fixed, 6), "1.500000");
+    EXPECT_EQ(render(1.5, FloatFormat::Fixed), "1.5");
+    EXPECT_EQ(render(1234.5, FloatFormat::Scientific, 2), "1.23e+03");
+    EXPECT_EQ(render(1234.5, FloatFormat::Scientific), "1.2345e+03");
+    EXPECT_EQ(render(1234.5, FloatFormat::General, 3), "1.23e+03");
+    EXPECT_EQ(render(0.5, FloatFormat::General, 6), "0.5");
+    // Shortest忽略精度
+    EXPECT_EQ(render(0.1, FloatFormat::Shortest, 2), "0.1");
+    // 定点表示超出栈缓冲时仍完整输出
+    const std::string huge = render(1e300, FloatFormat::Fixed, 2);
+    EXPECT_EQ(huge.size(), 304u);
+    EXPECT_EQ(huge.substr(0, 2), "10");
+    EXPECT_EQ(huge.substr(huge.size() - 3), ".00");
+}
+
+TEST(StringifyFloatingTest, DurationAndContainers_FollowConfig)
+{
+    // 单位符号取决于时长类型，此处只校验计数部分
+    EXPECT_EQ(DaneJoe::to_string(std::chrono::duration<double>(1.25)).compare(0, 4, "1.25"), 0);
+    EXPECT_EQ(DaneJoe::to_string(std::vector<double>{ 0.1, 3.0 }), "[0.1, 3]");
+
+    DaneJoe::StringifyConfig config;
+    config.float_format = DaneJoe::FloatFormat::Fixed;
+    config.float_precision = 2;
+    std::string result;
+    DaneJoe::append_to_string(result, std::chrono::duration<double, std::milli>(2.5), config);
+    EXPECT_EQ(result.compare(0, 4, "2.50"), 0);
+}
+
+TEST(StringifyFloatingTest, CapacitySize_UsesSameEngine)
+{
+    EXPECT_EQ(DaneJoe::format_capacity_size(1536, DaneJoe::StorageUnit::KiloByte, 2), "1.50 KB");
+}
@@ -19,3 +19,11 @@ TEST(StringifyFormatTest, FormatCapacitySize_Bytes)
     const std::string result = DaneJoe::format_capacity_size(12, DaneJoe::StorageUnit::Byte);
     EXPECT_NE(result.find("12"), std::string::npos);
 }
+
+TEST(StringifyFormatTest, FormatStringList_IndentAndIndex)
+{
+    const std::vector<std::string> list = { "alpha", "beta" };
+    EXPECT_EQ(DaneJoe::format_string_list(2, ". ", list, true, 9), "  9. alpha\n  10. beta");
+    EXPECT_EQ(DaneJoe::format_string_list(0, "- ", list), "- alpha\n- beta");
+    EXPECT_EQ(DaneJoe::format_string_list(4, "- ", {}), "");
+}
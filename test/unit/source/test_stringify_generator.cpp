@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <string>
+#include <vector>
+#include <stdexcept>
+#include <utility>
+
+#include "danejoe/stringify/stringify_generator.hpp"
+#include "danejoe/stringify/stringify_to_string.hpp"
+
+#if defined(DANEJOE_STRINGIFY_HAS_GENERATOR)
+
+namespace
+{
+
+/**
+ * @brief 渲染时抛出异常的类型
+ */
+struct Throwing
+{
+    std::string to_string() const
+    {
+        throw std::runtime_error("render failed");
+    }
+};
+
+/// 是否接受该值类别的对象
+template<class T>
+concept AcceptsChunks = requires(T&& value)
+{
+    DaneJoe::stringify_chunks(std::forward<T>(value));
+};
+
+/// 是否接受该值类别的对象（指定配置）
+template<class T>
+concept AcceptsChunksWithConfig = requires(T&& value, const DaneJoe::StringifyConfig& config)
+{
+    DaneJoe::stringify_chunks(std::forward<T>(value), 64, config);
+};
+
+// 临时对象会在首次取块前销毁，须在编译期拒绝
+static_assert(AcceptsChunks<const std::vector<int>&>);
+static_assert(!AcceptsChunks<std::vector<int>>);
+static_assert(AcceptsChunksWithConfig<const std::vector<int>&>);
+static_assert(!AcceptsChunksWithConfig<std::vector<int>>);
+
+} // namespace
+
+TEST(StringifyGeneratorTest, Chunks_ConcatenateToIterativeOutput)
+{
+    std::map<int, std::vector<std::string>> value;
+    for (int i = 0; i < 200; ++i)
+    {
+        value[i] = { std::to_string(i), std::string(static_cast<std::size_t>(i % 7), 'x') };
+    }
+    const std::string expected = DaneJoe::to_string_iterative(value);
+    const DaneJoe::StringifyConfig config = DaneJoe::StringifyConfigManager::get_config();
+    for (std::size_t chunk_size : { 1, 7, 64, 100000 })
+    {
+        std::string out;
+        std::size_t chunk_count = 0;
+        for (std::string_view chunk : DaneJoe::stringify_chunks(value, chunk_size, config))
+        {
+            ++chunk_count;
+            ASSERT_LE(chunk.size(), chunk_size);
+            ASSERT_FALSE(chunk.empty());
+            out += chunk;
+        }
+        EXPECT_EQ(out, expected);
+        EXPECT_EQ(chunk_count, (expected.size() + chunk_size - 1) / chunk_size);
+    }
+}
+
+TEST(StringifyGeneratorTest, LargeLeaf_SplitAcrossChunks)
+{
+    const std::vector<std::string> value = { std::string(1000, 'a'), "b" };
+    std::string out;
+    std::size_t chunk_count = 0;
+    for (std::string_view chunk : DaneJoe::stringify_chunks(value, 256))
+    {
+        EXPECT_LE(chunk.size(), 256u);
+        out += chunk;
+        ++chunk_count;
+    }
+    EXPECT_EQ(out, DaneJoe::to_string(value));
+    EXPECT_EQ(chunk_count, 4u);
+}
+
+TEST(StringifyGeneratorTest, Next_PullsOneChunkAtATime)
+{
+    const std::vector<int> value = { 10, 20, 30 };
+    auto generator = DaneJoe::stringify_chunks(value, 4);
+    ASSERT_TRUE(generator.next());
+    EXPECT_EQ(generator.get_chunk(), "[10,");
+    std::string out(generator.get_chunk());
+    while (generator.next())
+    {
+        out += generator.get_chunk();
+    }
+    EXPECT_EQ(out, "[10, 20, 30]");
+    EXPECT_FALSE(generator.next());
+}
+
+TEST(StringifyGeneratorTest, EarlyDestruction_ReleasesTraversal)
+{
+    const std::vector<int> value(1000, 1);
+    auto generator = DaneJoe::stringify_chunks(value, 8);
+    ASSERT_TRUE(generator.next());
+    EXPECT_EQ(generator.get_chunk().size(), 8u);
+}
+
+TEST(StringifyGeneratorTest, Exception_PropagatesToCaller)
+{
+    const std::vector<Throwing> value(1);
+    auto generator = DaneJoe::stringify_chunks(value, 16);
+    EXPECT_THROW(generator.next(), std::runtime_error);
+}
+
+#endif
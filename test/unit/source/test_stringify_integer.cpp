@@ -0,0 +1,173 @@
+#include <gtest/gtest.h>
+
+#include <charconv>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "danejoe/stringify/stringify_capture.hpp"
+#include "danejoe/stringify/stringify_parse.hpp"
+#include "danejoe/stringify/stringify_to_string.hpp"
+
+namespace
+{
+
+template<class T>
+std::string render(T value, const DaneJoe::StringifyConfig& config)
+{
+    std::string result;
+    DaneJoe::append_to_string(result, value, config);
+    return result;
+}
+
+DaneJoe::StringifyConfig make_config(DaneJoe::IntegerBase base, bool is_show_prefix = false,
+    std::size_t width = 0, std::string group_symbol = "", std::size_t group_size = 3)
+{
+    DaneJoe::StringifyConfig config;
+    config.integer_base = base;
+    config.is_show_integer_prefix = is_show_prefix;
+    config.integer_width = width;
+    config.integer_group_symbol = std::move(group_symbol);
+    config.integer_group_size = group_size;
+    return config;
+}
+
+template<class T>
+void expect_decimal_matches_std(std::mt19937_64& engine)
+{
+    EXPECT_EQ(DaneJoe::to_string(std::numeric_limits<T>::min()), std::to_string(std::numeric_limits<T>::min()));
+    EXPECT_EQ(DaneJoe::to_string(std::numeric_limits<T>::max()), std::to_string(std::numeric_limits<T>::max()));
+    for (int i = 0; i < 1000; ++i)
+    {
+        // 随机截断位数，覆盖不同长度
+        const auto value = static_cast<T>(engine() >> (engine() % 64));
+        EXPECT_EQ(DaneJoe::to_string(value), std::to_string(value));
+    }
+}
+
+} // namespace
+
+TEST(StringifyIntegerTest, Decimal_MatchesStdToString)
+{
+    std::mt19937_64 engine(20261018);
+    expect_decimal_matches_std<short>(engine);
+    expect_decimal_matches_std<int>(engine);
+    expect_decimal_matches_std<unsigned int>(engine);
+    expect_decimal_matches_std<long long>(engine);
+    expect_decimal_matches_std<unsigned long long>(engine);
+    EXPECT_EQ(DaneJoe::to_string(0), "0");
+}
+
+TEST(StringifyIntegerTest, Radix_WithPrefix)
+{
+    using DaneJoe::IntegerBase;
+    EXPECT_EQ(render(255, make_config(IntegerBase::Hexadecimal)), "ff");
+    EXPECT_EQ(render(255, make_config(IntegerBase::Hexadecimal, true)), "0xff");
+    EXPECT_EQ(render(-255, make_config(IntegerBase::Hexadecimal, true)), "-0xff");
+    EXPECT_EQ(render(0xDEADBEEFu, make_config(IntegerBase::Hexadecimal)), "deadbeef");
+    EXPECT_EQ(render(5, make_config(IntegerBase::Binary, true)), "0b101");
+    EXPECT_EQ(render(0, make_config(IntegerBase::Binary)), "0");
+    EXPECT_EQ(render(UINT64_MAX, make_config(IntegerBase::Binary)), std::string(64, '1'));
+    EXPECT_EQ(render(8, make_config(IntegerBase::Octal, true)), "010");
+    EXPECT_EQ(render(0, make_config(IntegerBase::Octal, true)), "0");
+    EXPECT_EQ(render(INT64_MIN, make_config(IntegerBase::Octal)), "-1000000000000000000000");
+    EXPECT_EQ(render(INT64_MIN, make_config(IntegerBase::Hexadecimal)), "-8000000000000000");
+}
+
+TEST(StringifyIntegerTest, Radix_MatchesToChars)
+{
+    std::mt19937_64 engine(7);
+    const DaneJoe::IntegerBase bases[] = {
+        DaneJoe::IntegerBase::Binary, DaneJoe::IntegerBase::Octal, DaneJoe::IntegerBase::Hexadecimal };
+    for (DaneJoe::IntegerBase base : bases)
+    {
+        const auto config = make_config(base);
+        for (int i = 0; i < 1000; ++i)
+        {
+            const auto value = static_cast<int64_t>(engine() >> (engine() % 64));
+            char buffer[72];
+            auto result = std::to_chars(buffer, buffer + sizeof(buffer), value,
+                static_cast<int>(DaneJoe::get_integer_radix(base)));
+            EXPECT_EQ(render(value, config), std::string_view(buffer, static_cast<std::size_t>(result.ptr - buffer)));
+        }
+    }
+}
+
+TEST(StringifyIntegerTest, PaddingAndGrouping)
+{
+    using DaneJoe::IntegerBase;
+    EXPECT_EQ(render(42, make_config(IntegerBase::Decimal, false, 5)), "00042");
+    EXPECT_EQ(render(-42, make_config(IntegerBase::Decimal, false, 5)), "-00042");
+    EXPECT_EQ(render(0xAB, make_config(IntegerBase::Hexadecimal, true, 8)), "0x000000ab");
+    EXPECT_EQ(render(1234567, make_config(IntegerBase::Decimal, false, 0, ",")), "1,234,567");
+    EXPECT_EQ(render(123, make_config(IntegerBase::Decimal, false, 0, ",")), "123");
+    EXPECT_EQ(render(-1234, make_config(IntegerBase::Decimal, false, 0, "'")), "-1'234");
+    EXPECT_EQ(render(0xDEADBEEFu, make_config(IntegerBase::Hexadecimal, true, 0, "_", 4)), "0xdead_beef");
+    EXPECT_EQ(render(5, make_config(IntegerBase::Binary, false, 8, " ", 4)), "0000 0101");
+    EXPECT_EQ(render(42, make_config(IntegerBase::Decimal, false, 7, ",")), "0,000,042");
+    // 分组位数为0时不分组
+    EXPECT_EQ(render(1234567, make_config(IntegerBase::Decimal, false, 0, ",", 0)), "1234567");
+}
+
+TEST(StringifyIntegerTest, NestedValues_FollowConfig)
+{
+    const auto config = make_config(DaneJoe::IntegerBase::Decimal, false, 0, ",");
+    EXPECT_EQ(render(std::vector<int>{ 1000, 2 }, config), "[1,000, 2]");
+    EXPECT_EQ(render(std::chrono::milliseconds(1500), config), "1,500ms");
+}
+
+#if defined(DANEJOE_STRINGIFY_HAS_INT128)
+TEST(StringifyIntegerTest, Int128_Supported)
+{
+    const unsigned __int128 max_value = ~static_cast<unsigned __int128>(0);
+    const __int128 min_value = static_cast<__int128>(max_value >> 1) * -1 - 1;
+    EXPECT_EQ(DaneJoe::to_string(max_value), "340282366920938463463374607431768211455");
+    EXPECT_EQ(DaneJoe::to_string(min_value), "-170141183460469231731687303715884105728");
+    EXPECT_EQ(DaneJoe::to_string(static_cast<__int128>(-7)), "-7");
+    // 跨10^19段边界时中间段补零
+    const unsigned __int128 boundary = static_cast<unsigned __int128>(UINT64_MAX) + 1;
+    EXPECT_EQ(DaneJoe::to_string(boundary * 10), "184467440737095516160");
+    EXPECT_EQ(DaneJoe::to_string(static_cast<unsigned __int128>(10000000000000000000ull) * 10000000000000000000ull),
+        "100000000000000000000000000000000000000");
+    EXPECT_EQ(render(max_value, make_config(DaneJoe::IntegerBase::Hexadecimal, true)),
+        "0x" + std::string(32, 'f'));
+    EXPECT_EQ(DaneJoe::to_string(std::vector<__int128>{ 1, -2 }), "[1, -2]");
+
+    DaneJoe::StringifyCapture capture;
+    ASSERT_TRUE(capture.capture(max_value));
+    capture.drain([&](std::string_view text)
+        {
+            EXPECT_EQ(text, DaneJoe::to_string(max_value));
+        });
+
+    auto parsed = DaneJoe::from_string<unsigned __int128>("340282366920938463463374607431768211455");
+    ASSERT_TRUE(parsed);
+    EXPECT_TRUE(parsed.value == max_value);
+    EXPECT_EQ(DaneJoe::from_string<unsigned __int128>("340282366920938463463374607431768211456").error,
+        DaneJoe::FromStringError::NumberOutOfRange);
+}
+#endif
+
+TEST(StringifyIntegerTest, FromString_RoundTripsConfig)
+{
+    const auto config = make_config(DaneJoe::IntegerBase::Hexadecimal, true, 4, "_", 4);
+    const std::vector<int> values = { 0, -1, 0x7fffffff, -0x12345, 0xABCDE };
+    const std::string text = render(values, config);
+    EXPECT_EQ(text, "[0x0000, -0x0001, 0x7fff_ffff, -0x1_2345, 0xa_bcde]");
+    std::vector<int> parsed;
+    ASSERT_TRUE(DaneJoe::from_string(text, parsed, config));
+    EXPECT_EQ(parsed, values);
+
+    const auto grouped = make_config(DaneJoe::IntegerBase::Decimal, false, 0, ",");
+    std::vector<long long> numbers;
+    ASSERT_TRUE(DaneJoe::from_string("[1,234,567, -8, 9,000]", numbers, grouped));
+    EXPECT_EQ(numbers, (std::vector<long long>{ 1234567, -8, 9000 }));
+
+    int8_t narrow = 0;
+    EXPECT_EQ(DaneJoe::from_string("0x80", narrow, make_config(DaneJoe::IntegerBase::Hexadecimal, true)).error,
+        DaneJoe::FromStringError::NumberOutOfRange);
+}
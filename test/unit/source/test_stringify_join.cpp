@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <list>
+#include <memory_resource>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "danejoe/stringify/stringify_join.hpp"
+#include "danejoe/stringify/stringify_to_string.hpp"
+
+namespace
+{
+
+/**
+ * @brief 统计分配次数的内存资源
+ */
+class CountingResource : public std::pmr::memory_resource
+{
+public:
+    std::size_t allocation_count = 0;
+private:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override
+    {
+        ++allocation_count;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+    void do_deallocate(void* ptr, std::size_t bytes, std::size_t alignment) override
+    {
+        std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+    }
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+    {
+        return this == &other;
+    }
+};
+
+} // namespace
+
+TEST(StringifyJoinTest, StrCat_MatchesToStringConcatenation)
+{
+    const std::string name = "worker";
+    const std::string_view state = "idle";
+    EXPECT_EQ(DaneJoe::str_cat("id=", 42, ' ', name, " state=", state, " ok=", true, " load=", 0.5),
+        "id=42 worker state=idle ok=true load=0.5");
+    EXPECT_EQ(DaneJoe::str_cat(std::vector<int>{ 1, 2 }, std::optional<int>()), "[1, 2]<null>");
+    EXPECT_EQ(DaneJoe::str_cat(), "");
+}
+
+TEST(StringifyJoinTest, StrCat_AllocatesOnce)
+{
+    CountingResource resource;
+    std::pmr::string out(&resource);
+    const DaneJoe::StringifyConfig config;
+    const std::string path = "/var/log/service/worker.log";
+    DaneJoe::append_str_cat(out, config, "open ", path, " fd=", 17, " size=", std::uint64_t(1) << 40,
+        " mode=", 'r', " retry=", -3, " cached=", false);
+    EXPECT_EQ(out, "open /var/log/service/worker.log fd=17 size=1099511627776 mode=r retry=-3 cached=false");
+    EXPECT_EQ(resource.allocation_count, 1u);
+}
+
+TEST(StringifyJoinTest, IntegerSizeHint_ExactForDecimal)
+{
+    const DaneJoe::StringifyConfig config;
+    for (std::int64_t value : { std::int64_t(0), std::int64_t(9), std::int64_t(10), std::int64_t(-99),
+        std::int64_t(1000000), std::numeric_limits<std::int64_t>::min(), std::numeric_limits<std::int64_t>::max() })
+    {
+        EXPECT_EQ(DaneJoe::get_stringify_size_hint(value, config), DaneJoe::to_string(value).size()) << value;
+    }
+    EXPECT_EQ(DaneJoe::get_stringify_size_hint(std::numeric_limits<std::uint64_t>::max(), config), 20u);
+
+    DaneJoe::StringifyConfig hex = config;
+    hex.integer_base = DaneJoe::IntegerBase::Hexadecimal;
+    hex.is_show_integer_prefix = true;
+    std::string out;
+    DaneJoe::append_to_string(out, -255, hex);
+    EXPECT_GE(DaneJoe::get_stringify_size_hint(-255, hex), out.size());
+}
+
+TEST(StringifyJoinTest, UnicodeSizeHint_PerCodeUnitBound)
+{
+    const DaneJoe::StringifyConfig config;
+    EXPECT_EQ(DaneJoe::get_stringify_size_hint(std::u8string(100, u8'a'), config), 100u);
+    EXPECT_EQ(DaneJoe::get_stringify_size_hint(std::u16string(10, u'a'), config), 30u);
+    EXPECT_EQ(DaneJoe::get_stringify_size_hint(std::u32string(10, U'a'), config), 40u);
+    const std::u16string wide = u"\u4e2d\u6587";
+    EXPECT_GE(DaneJoe::get_stringify_size_hint(wide, config), DaneJoe::to_string(wide).size());
+}
+
+TEST(StringifyJoinTest, Join_WithSeparator)
+{
+    EXPECT_EQ(DaneJoe::join(std::vector<int>{ 1, 2, 3 }, ", "), "1, 2, 3");
+    EXPECT_EQ(DaneJoe::join(std::list<std::string>{ "a", "b" }, "/"), "a/b");
+    EXPECT_EQ(DaneJoe::join(std::vector<std::vector<int>>{ { 1 }, { 2, 3 } }, ";"), "[1];[2, 3]");
+    EXPECT_EQ(DaneJoe::join(std::vector<int>{}, ","), "");
+    const char* words[] = { "x", "y" };
+    EXPECT_EQ(DaneJoe::join(words, ""), "xy");
+}
+
+TEST(StringifyJoinTest, Join_AllocatesOnce)
+{
+    CountingResource resource;
+    std::pmr::string out(&resource);
+    std::vector<int> values;
+    for (int i = -500; i < 500; ++i)
+    {
+        values.push_back(i * 37);
+    }
+    DaneJoe::append_join(out, values, ",", DaneJoe::StringifyConfig());
+    EXPECT_EQ(resource.allocation_count, 1u);
+    EXPECT_EQ(out.size(), out.capacity());
+}
@@ -0,0 +1,77 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <ranges>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+#include "danejoe/stringify/stringify_capture.hpp"
+#include "danejoe/stringify/stringify_to.hpp"
+#include "danejoe/stringify/stringify_to_string.hpp"
+
+TEST(StringifyRangesTest, ConstIterableViews)
+{
+    const std::vector<int> values = { 1, 2, 3, 4 };
+    EXPECT_EQ(DaneJoe::to_string(std::views::iota(0, 3)), "[0, 1, 2]");
+    EXPECT_EQ(DaneJoe::to_string(values | std::views::transform([](int value) { return value * 10; })),
+        "[10, 20, 30, 40]");
+    EXPECT_EQ(DaneJoe::to_string(values | std::views::reverse | std::views::take(2)), "[4, 3]");
+    const std::map<std::string, int> map = { { "a", 1 }, { "b", 2 } };
+    EXPECT_EQ(DaneJoe::to_string(map | std::views::keys), "[a, b]");
+    // 嵌套在其它类型中
+    EXPECT_EQ(DaneJoe::to_string(std::make_tuple(1, std::views::iota(5, 7))), "(1, [5, 6])");
+}
+
+TEST(StringifyRangesTest, NonConstIterableViews)
+{
+    const std::vector<int> values = { 1, 2, 3, 4, 5, 6 };
+    auto even = values | std::views::filter([](int value) { return value % 2 == 0; });
+    EXPECT_EQ(DaneJoe::to_string(even), "[2, 4, 6]");
+    // 经const引用时复制视图本身
+    const auto& const_even = even;
+    EXPECT_EQ(DaneJoe::to_string(std::vector<decltype(even)>{ const_even }), "[[2, 4, 6]]");
+    EXPECT_EQ(DaneJoe::from_input_range(values | std::views::drop_while([](int value) { return value < 5; })),
+        "[5, 6]");
+}
+
+TEST(StringifyRangesTest, SinglePassRange_RenderedOnce)
+{
+    std::istringstream stream("7 8 9");
+    auto numbers = std::views::istream<int>(stream);
+    EXPECT_EQ(DaneJoe::to_string(numbers), "[7, 8, 9]");
+}
+
+TEST(StringifyRangesTest, ElementLimit_StopsInfiniteRange)
+{
+    DaneJoe::StringifyConfig config;
+    config.max_stringify_element_count = 3;
+    std::string result;
+    DaneJoe::append_to_string(result, std::views::iota(0), config);
+    EXPECT_EQ(result, "[0, 1, 2, ...]");
+    std::string sized;
+    DaneJoe::append_to_string(sized, std::views::iota(0, 1000000), config);
+    EXPECT_EQ(sized, "[0, 1, 2, ...]");
+}
+
+TEST(StringifyRangesTest, FixedBufferAndCapture)
+{
+    const std::vector<int> values = { 1, 2, 3 };
+    auto squares = values | std::views::transform([](int value) { return value * value; });
+    EXPECT_TRUE(DaneJoe::is_fixed_stringifiable<decltype(squares)>::value);
+    char buffer[32];
+    auto result = DaneJoe::stringify_to(buffer, buffer + sizeof(buffer), squares);
+    EXPECT_EQ(std::string_view(buffer, static_cast<std::size_t>(result.ptr - buffer)), "[1, 4, 9]");
+
+    DaneJoe::StringifyCapture capture;
+    ASSERT_TRUE(capture.capture(squares));
+    std::vector<std::string> lines;
+    capture.drain([&](std::string_view text)
+        {
+            lines.emplace_back(text);
+        });
+    ASSERT_EQ(lines.size(), 1u);
+    EXPECT_EQ(lines[0], "[1, 4, 9]");
+}
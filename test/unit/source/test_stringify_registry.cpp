@@ -0,0 +1,210 @@
+#include <gtest/gtest.h>
+
+#include <any>
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include "danejoe/stringify/stringify_capture.hpp"
+#include "danejoe/stringify/stringify_registry.hpp"
+#include "danejoe/stringify/stringify_to_string.hpp"
+#include "danejoe/stringify/stringify_traversal.hpp"
+
+namespace
+{
+
+/// 模拟插件类型：无to_string成员，也无operator<<
+struct PluginPoint
+{
+    int x;
+    int y;
+};
+
+/// 仅在单个用例中注册的类型
+struct PluginHandle
+{
+    int id;
+};
+
+/// 从未注册的类型
+struct Opaque
+{
+};
+
+/// 注册PluginPoint并在析构时注销
+class PluginPointRegistration
+{
+public:
+    PluginPointRegistration()
+    {
+        DaneJoe::register_formatter<PluginPoint>([](std::string& out, const PluginPoint& point,
+            const DaneJoe::StringifyConfig& config)
+            {
+                out += "(";
+                DaneJoe::append_to_string(out, point.x, config);
+                out += ", ";
+                DaneJoe::append_to_string(out, point.y, config);
+                out += ")";
+            });
+    }
+    ~PluginPointRegistration()
+    {
+        DaneJoe::unregister_formatter<PluginPoint>();
+    }
+};
+
+} // namespace
+
+TEST(StringifyRegistryTest, RegisteredType_UsedBeforeFallback)
+{
+    const std::string place_holder = DaneJoe::StringifyConfigManager::get_config().unsupported_type_place_holder;
+    EXPECT_EQ(DaneJoe::to_string(PluginPoint{ 1, 2 }), place_holder);
+    {
+        PluginPointRegistration registration;
+        EXPECT_TRUE(DaneJoe::has_formatter<PluginPoint>());
+        EXPECT_EQ(DaneJoe::to_string(PluginPoint{ 1, 2 }), "(1, 2)");
+        EXPECT_EQ(DaneJoe::from_fallback(PluginPoint{ 3, 4 }), "(3, 4)");
+        EXPECT_EQ(DaneJoe::to_string(std::vector<PluginPoint>{ { 1, 2 }, { -3, 4 } }), "[(1, 2), (-3, 4)]");
+        // 格式化器收到调用方的配置
+        DaneJoe::StringifyConfig config;
+        config.integer_base = DaneJoe::IntegerBase::Hexadecimal;
+        std::string result;
+        DaneJoe::append_to_string(result, PluginPoint{ 10, 255 }, config);
+        EXPECT_EQ(result, "(a, ff)");
+        std::string iterative;
+        DaneJoe::append_to_string_iterative(iterative, std::vector<PluginPoint>{ { 5, 6 } }, config);
+        EXPECT_EQ(iterative, "[(5, 6)]");
+    }
+    EXPECT_FALSE(DaneJoe::has_formatter<PluginPoint>());
+    EXPECT_EQ(DaneJoe::to_string(PluginPoint{ 1, 2 }), place_holder);
+}
+
+TEST(StringifyRegistryTest, StringFunction_AndReplace)
+{
+    DaneJoe::register_formatter<PluginHandle>([](const PluginHandle& handle)
+        {
+            return "handle#" + std::to_string(handle.id);
+        });
+    EXPECT_EQ(DaneJoe::to_string(PluginHandle{ 7 }), "handle#7");
+    const std::size_t size = DaneJoe::StringifyFormatterRegistry::size();
+    DaneJoe::register_formatter<PluginHandle>([](const PluginHandle& handle)
+        {
+            return "h" + std::to_string(handle.id);
+        });
+    EXPECT_EQ(DaneJoe::StringifyFormatterRegistry::size(), size);
+    EXPECT_EQ(DaneJoe::to_string(PluginHandle{ 7 }), "h7");
+    EXPECT_TRUE(DaneJoe::unregister_formatter<PluginHandle>());
+    EXPECT_FALSE(DaneJoe::unregister_formatter<PluginHandle>());
+    EXPECT_EQ(DaneJoe::StringifyFormatterRegistry::size(), size - 1);
+}
+
+TEST(StringifyRegistryTest, StdAny_RendersContainedValue)
+{
+    const auto& config = DaneJoe::StringifyConfigManager::get_config();
+    EXPECT_EQ(DaneJoe::to_string(std::any(42)), "42");
+    EXPECT_EQ(DaneJoe::to_string(std::any(std::string("text"))), "text");
+    EXPECT_EQ(DaneJoe::to_string(std::any(std::vector<int>{ 1, 2 })), "[1, 2]");
+    EXPECT_EQ(DaneJoe::to_string(std::any(1.5)), "1.5");
+    EXPECT_EQ(DaneJoe::to_string(std::any()), config.null_value_symbol);
+    EXPECT_EQ(DaneJoe::to_string(std::any(Opaque{})), config.unsupported_type_place_holder);
+    EXPECT_EQ(DaneJoe::from_std_any(std::any(true)), DaneJoe::to_string(true));
+
+    PluginPointRegistration registration;
+    const std::vector<std::any> values = { 1, std::string("a"), PluginPoint{ 8, 9 }, std::any() };
+    EXPECT_EQ(DaneJoe::to_string(values), "[1, a, (8, 9), " + config.null_value_symbol + "]");
+}
+
+TEST(StringifyRegistryTest, Capture_RendersAtCaptureTime)
+{
+    PluginPointRegistration registration;
+    DaneJoe::StringifyCapture capture;
+    ASSERT_TRUE(capture.capture(PluginPoint{ 1, 2 }, " ", std::any(3)));
+    std::vector<std::string> lines;
+    capture.drain([&](std::string_view text)
+        {
+            lines.emplace_back(text);
+        });
+    ASSERT_EQ(lines.size(), 1u);
+    EXPECT_EQ(lines[0], "(1, 2) 3");
+}
+
+TEST(StringifyRegistryTest, ConcurrentLookup_DuringRegistration)
+{
+    PluginPointRegistration registration;
+    std::vector<std::thread> readers;
+    for (int i = 0; i < 4; ++i)
+    {
+        readers.emplace_back([]()
+            {
+                for (int j = 0; j < 2000; ++j)
+                {
+                    EXPECT_EQ(DaneJoe::to_string(PluginPoint{ j, j }),
+                        "(" + std::to_string(j) + ", " + std::to_string(j) + ")");
+                }
+            });
+    }
+    for (int i = 0; i < 50; ++i)
+    {
+        DaneJoe::register_formatter<PluginHandle>([](const PluginHandle& handle)
+            {
+                return std::to_string(handle.id);
+            });
+        DaneJoe::unregister_formatter<PluginHandle>();
+    }
+    for (auto& reader : readers)
+    {
+        reader.join();
+    }
+}
+
+TEST(StringifyRegistryTest, ReplacedTables_AreReclaimed)
+{
+    DaneJoe::register_formatter<PluginHandle>([](const PluginHandle& handle)
+        {
+            return "old#" + std::to_string(handle.id);
+        });
+    std::shared_ptr<const DaneJoe::StringifyFormatter> held = DaneJoe::StringifyFormatterRegistry::find(typeid(PluginHandle));
+    ASSERT_NE(held, nullptr);
+    const std::weak_ptr<const DaneJoe::StringifyFormatter> observer = held;
+    for (int i = 0; i < 100; ++i)
+    {
+        DaneJoe::register_formatter<PluginHandle>([](const PluginHandle& handle)
+            {
+                return "new#" + std::to_string(handle.id);
+            });
+    }
+    // 持有者仍可使用旧格式化器，释放后旧表被回收
+    const PluginHandle handle{ 1 };
+    std::string out;
+    DaneJoe::append_formatted(out, *held, &handle, DaneJoe::StringifyConfig());
+    EXPECT_EQ(out, "old#1");
+    EXPECT_FALSE(observer.expired());
+    held.reset();
+    EXPECT_TRUE(observer.expired());
+    EXPECT_EQ(DaneJoe::to_string(PluginHandle{ 2 }), "new#2");
+    EXPECT_TRUE(DaneJoe::unregister_formatter<PluginHandle>());
+}
+
+TEST(StringifyRegistryTest, NonStringOutput_WrittenDirectly)
+{
+    DaneJoe::register_formatter<PluginHandle>([](auto& out, const PluginHandle& handle,
+        const DaneJoe::StringifyConfig& config)
+        {
+            out += "handle#";
+            DaneJoe::append_to_string(out, handle.id, config);
+        });
+    PluginPointRegistration registration;
+    std::array<std::byte, 1024> buffer{};
+    std::pmr::monotonic_buffer_resource resource(buffer.data(), buffer.size(), std::pmr::null_memory_resource());
+    const std::pmr::string result = DaneJoe::to_string(
+        std::make_tuple(PluginHandle{ 3 }, PluginPoint{ 4, 5 }, std::any(6)), &resource);
+    EXPECT_EQ(result, "(handle#3, (4, 5), 6)");
+    EXPECT_EQ(DaneJoe::to_string(PluginHandle{ 7 }), "handle#7");
+    EXPECT_TRUE(DaneJoe::unregister_formatter<PluginHandle>());
+}
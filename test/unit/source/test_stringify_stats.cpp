@@ -0,0 +1,85 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "danejoe/stringify/stringify_append.hpp"
+#include "danejoe/stringify/stringify_stats.hpp"
+#include "danejoe/stringify/stringify_to_string.hpp"
+
+namespace
+{
+
+TEST(StringifyStatsTest, BranchName_MatchesDispatchFunction)
+{
+    EXPECT_STREQ(DaneJoe::get_stringify_branch_name(DaneJoe::StringifyBranch::HasIterator), "from_has_iterator");
+    EXPECT_STREQ(DaneJoe::get_stringify_branch_name(DaneJoe::StringifyBranch::TimePoint), "format_time_point");
+}
+
+#if defined(DANEJOE_STRINGIFY_ENABLE_STATS)
+
+TEST(StringifyStatsTest, Enabled_CountsCallsAndBytesPerBranch)
+{
+    DaneJoe::reset_stringify_stats();
+    const std::vector<int> v = { 1, 22, 333 };
+
+    const std::string result = DaneJoe::to_string(v);
+
+    const DaneJoe::StringifyStats stats = DaneJoe::stringify_stats();
+    EXPECT_EQ(stats[DaneJoe::StringifyBranch::HasIterator].call_count, 1u);
+    EXPECT_EQ(stats[DaneJoe::StringifyBranch::HasIterator].output_bytes, result.size());
+    EXPECT_EQ(stats[DaneJoe::StringifyBranch::StdToString].call_count, 3u);
+    EXPECT_EQ(stats[DaneJoe::StringifyBranch::StdToString].output_bytes, 6u);
+    EXPECT_GE(stats.config_lock_count, 1u);
+}
+
+TEST(StringifyStatsTest, Enabled_CountsGrowthOncePerCall)
+{
+    DaneJoe::reset_stringify_stats();
+    const std::vector<int> v(1000, 123456);
+    const DaneJoe::StringifyConfig config = DaneJoe::StringifyConfigManager::get_config();
+
+    // 未预留的输出在一次调用内多次扩容，只计1次
+    std::string grown;
+    DaneJoe::append_to_string(grown, v, config);
+    EXPECT_EQ(DaneJoe::stringify_stats()[DaneJoe::StringifyBranch::HasIterator].growth_call_count, 1u);
+
+    // 预留足够容量时不计
+    std::string reserved;
+    reserved.reserve(grown.size() * 2);
+    DaneJoe::append_to_string(reserved, v, config);
+    const DaneJoe::StringifyStats stats = DaneJoe::stringify_stats();
+    EXPECT_EQ(stats[DaneJoe::StringifyBranch::HasIterator].call_count, 2u);
+    EXPECT_EQ(stats[DaneJoe::StringifyBranch::HasIterator].growth_call_count, 1u);
+}
+
+TEST(StringifyStatsTest, Enabled_AggregatesExitedThreads)
+{
+    DaneJoe::reset_stringify_stats();
+
+    std::thread worker([]
+        {
+            DaneJoe::to_string(true);
+        });
+    worker.join();
+    DaneJoe::to_string(false);
+
+    EXPECT_EQ(DaneJoe::stringify_stats()[DaneJoe::StringifyBranch::Bool].call_count, 2u);
+}
+
+#else
+
+TEST(StringifyStatsTest, Disabled_RecordsNothing)
+{
+    static_assert(!DaneJoe::is_stringify_stats_enabled());
+    DaneJoe::to_string(std::vector<int>{ 1, 2 });
+
+    const DaneJoe::StringifyStats stats = DaneJoe::stringify_stats();
+    EXPECT_EQ(stats[DaneJoe::StringifyBranch::HasIterator].call_count, 0u);
+    EXPECT_EQ(stats.config_lock_count, 0u);
+}
+
+#endif
+
+} // namespace
@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <numeric>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "danejoe/stringify/stringify_strided.hpp"
+#include "danejoe/stringify/stringify_to_string.hpp"
+#include "danejoe/stringify/stringify_to.hpp"
+#include "danejoe/stringify/stringify_traversal.hpp"
+
+TEST(StringifyStridedTest, Matrix_RowMajor)
+{
+    const std::array<int, 6> values = { 1, 2, 3, 4, 5, 6 };
+    const auto view = DaneJoe::make_strided_view(values.data(), 2, 3);
+    EXPECT_EQ(DaneJoe::to_string(view), "[[1, 2, 3], [4, 5, 6]]");
+}
+
+TEST(StringifyStridedTest, Tensor_ThreeDimensions)
+{
+    std::vector<int> values(8);
+    std::iota(values.begin(), values.end(), 0);
+    const auto view = DaneJoe::make_strided_view(values.data(), 2, 2, 2);
+    EXPECT_EQ(DaneJoe::to_string(view), "[[[0, 1], [2, 3]], [[4, 5], [6, 7]]]");
+}
+
+TEST(StringifyStridedTest, Transposed_ReadsColumns)
+{
+    const std::array<int, 6> values = { 1, 2, 3, 4, 5, 6 };
+    const auto view = DaneJoe::make_strided_view(values.data(), 2, 3).get_transposed();
+    EXPECT_EQ(DaneJoe::to_string(view), "[[1, 4], [2, 5], [3, 6]]");
+}
+
+TEST(StringifyStridedTest, CustomStrides_SubMatrixAndReversed)
+{
+    std::vector<int> values(16);
+    std::iota(values.begin(), values.end(), 0);
+    // 4x4矩阵中从(1, 1)开始的2x2子块
+    const DaneJoe::StridedView<int, 2> block(values.data() + 5, { 2, 2 }, { 4, 1 });
+    EXPECT_EQ(DaneJoe::to_string(block), "[[5, 6], [9, 10]]");
+    // 负步长按逆序读取
+    const DaneJoe::StridedView<int, 1> reversed(values.data() + 3, { 4 }, { -1 });
+    EXPECT_EQ(DaneJoe::to_string(reversed), "[3, 2, 1, 0]");
+}
+
+TEST(StringifyStridedTest, LargeMatrix_BoundedPreview)
+{
+    constexpr std::size_t size = 4096;
+    std::vector<int> values(size * size);
+    std::iota(values.begin(), values.end(), 0);
+    const auto view = DaneJoe::make_strided_view(values.data(), size, size);
+
+    DaneJoe::StringifyConfig config;
+    config.max_stringify_dimension_element_count = { 2, 3 };
+    std::string out;
+    DaneJoe::append_to_string(out, view, config);
+    EXPECT_EQ(out, "[[0, 1, 2, ...], [4096, 4097, 4098, ...], ...]");
+}
+
+TEST(StringifyStridedTest, DimensionLimit_FallsBackToElementCount)
+{
+    std::vector<int> values(9);
+    std::iota(values.begin(), values.end(), 0);
+    const auto view = DaneJoe::make_strided_view(values.data(), 3, 3);
+
+    DaneJoe::StringifyConfig config;
+    config.max_stringify_element_count = 2;
+    config.max_stringify_dimension_element_count = { -1 };
+    std::string out;
+    DaneJoe::append_to_string(out, view, config);
+    EXPECT_EQ(out, "[[0, 1, ...], [3, 4, ...], ...]");
+
+    config.max_stringify_dimension_element_count = { 0 };
+    out.clear();
+    DaneJoe::append_to_string(out, view, config);
+    EXPECT_EQ(out, "[...]");
+}
+
+TEST(StringifyStridedTest, Span_RendersAsContainer)
+{
+    const std::vector<int> values = { 1, 2, 3 };
+    EXPECT_EQ(DaneJoe::to_string(std::span<const int>(values)), "[1, 2, 3]");
+}
+
+TEST(StringifyStridedTest, FixedBufferAndIterative_MatchToString)
+{
+    const std::array<double, 4> values = { 0.5, 1.5, 2.5, 3.5 };
+    const auto view = DaneJoe::make_strided_view(values.data(), 2, 2);
+    const std::string expected = DaneJoe::to_string(view);
+    EXPECT_EQ(expected, "[[0.5, 1.5], [2.5, 3.5]]");
+
+    char buffer[64];
+    const auto result = DaneJoe::stringify_to(buffer, buffer + sizeof(buffer), view);
+    EXPECT_FALSE(result.truncated);
+    EXPECT_EQ(std::string(buffer, result.ptr), expected);
+    EXPECT_EQ(DaneJoe::to_string_iterative(view), expected);
+
+    const std::vector<DaneJoe::StridedView<double, 2>> views = { view, view.get_transposed() };
+    EXPECT_EQ(DaneJoe::to_string(views), "[[[0.5, 1.5], [2.5, 3.5]], [[0.5, 2.5], [1.5, 3.5]]]");
+}
@@ -0,0 +1,85 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <chrono>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "danejoe/stringify/stringify_to.hpp"
+#include "danejoe/stringify/stringify_to_string.hpp"
+
+namespace
+{
+
+std::string_view view_of(const std::array<char, 64>& buffer, const DaneJoe::StringifyToResult& result)
+{
+    return std::string_view(buffer.data(), static_cast<std::size_t>(result.ptr - buffer.data()));
+}
+
+TEST(StringifyToTest, IntegerAndBool_MatchToString)
+{
+    std::array<char, 64> buffer{};
+
+    auto result = DaneJoe::stringify_to(buffer.data(), buffer.data() + buffer.size(), -42);
+    EXPECT_FALSE(result.truncated);
+    EXPECT_EQ(view_of(buffer, result), "-42");
+
+    result = DaneJoe::stringify_to(buffer.data(), buffer.data() + buffer.size(), true);
+    EXPECT_EQ(view_of(buffer, result), "true");
+}
+
+TEST(StringifyToTest, ContainerOfDurations_MatchesToString)
+{
+    std::array<char, 64> buffer{};
+    const std::vector<std::chrono::milliseconds> v = { std::chrono::milliseconds(1), std::chrono::milliseconds(20) };
+
+    const auto result = DaneJoe::stringify_to(buffer.data(), buffer.data() + buffer.size(), v);
+
+    EXPECT_EQ(view_of(buffer, result), "[1ms, 20ms]");
+}
+
+TEST(StringifyToTest, Truncation_EndsWithEllipsis)
+{
+    std::array<char, 64> buffer{};
+    const std::vector<int> v = { 100, 200, 300, 400 };
+
+    const auto result = DaneJoe::stringify_to(buffer.data(), buffer.data() + 10, v);
+
+    EXPECT_TRUE(result.truncated);
+    EXPECT_EQ(view_of(buffer, result), "[100, 2...");
+}
+
+TEST(StringifyToTest, CapacitySize_MatchesFormatCapacitySize)
+{
+    std::array<char, 64> buffer{};
+
+    const auto result = DaneJoe::format_capacity_size_to(
+        buffer.data(), buffer.data() + buffer.size(), 1536, DaneJoe::StorageUnit::KiloByte, 2);
+
+    EXPECT_EQ(view_of(buffer, result), "1.50 KB");
+}
+
+TEST(StringifyToTest, FixedStringifiable_ExcludesAllocatingTypes)
+{
+    EXPECT_TRUE((DaneJoe::is_fixed_stringifiable<std::vector<std::pair<int, bool>>>::value));
+    EXPECT_FALSE(DaneJoe::is_fixed_stringifiable<double>::value);
+    EXPECT_FALSE(DaneJoe::is_fixed_stringifiable<std::chrono::system_clock::time_point>::value);
+    EXPECT_TRUE(DaneJoe::is_fixed_stringifiable<DaneJoe::StorageUnit>::value);
+    EXPECT_TRUE(DaneJoe::is_fixed_stringifiable<DaneJoe::FormatPosition>::value);
+}
+
+TEST(StringifyToTest, StorageUnitAndPosition_MatchToString)
+{
+    std::array<char, 64> buffer{};
+    const std::pair<DaneJoe::StorageUnit, DaneJoe::FormatPosition> value{
+        DaneJoe::StorageUnit::KiloByte, DaneJoe::FormatPosition::CENTER };
+
+    const auto result = DaneJoe::stringify_to(buffer.data(), buffer.data() + buffer.size(), value);
+
+    EXPECT_FALSE(result.truncated);
+    EXPECT_EQ(view_of(buffer, result), DaneJoe::to_string(value));
+}
+
+} // namespace
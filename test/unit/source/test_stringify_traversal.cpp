@@ -0,0 +1,130 @@
+#include <gtest/gtest.h>
+
+#include <map>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <variant>
+#include <vector>
+
+#include "danejoe/stringify/stringify_to_string.hpp"
+#include "danejoe/stringify/stringify_traversal.hpp"
+
+namespace
+{
+
+struct StringifyConfigGuard
+{
+    DaneJoe::StringifyConfig old_config;
+
+    explicit StringifyConfigGuard(const DaneJoe::StringifyConfig& new_config)
+        : old_config(DaneJoe::StringifyConfigManager::get_config())
+    {
+        DaneJoe::StringifyConfigManager::set_config(new_config);
+    }
+
+    ~StringifyConfigGuard()
+    {
+        DaneJoe::StringifyConfigManager::set_config(old_config);
+    }
+};
+
+/// 自引用的树，嵌套深度只取决于数据
+struct Tree
+{
+    using iterator = std::vector<Tree>::const_iterator;
+    using const_iterator = std::vector<Tree>::const_iterator;
+
+    std::vector<Tree> children;
+
+    Tree() = default;
+    Tree(Tree&&) = default;
+    /// 逐层拆开子树，避免析构本身递归过深
+    ~Tree()
+    {
+        std::vector<Tree> pending = std::move(children);
+        while (!pending.empty())
+        {
+            std::vector<Tree> next = std::move(pending.back().children);
+            pending.pop_back();
+            for (Tree& child : next)
+            {
+                pending.push_back(std::move(child));
+            }
+        }
+    }
+
+    const_iterator begin() const
+    {
+        return children.begin();
+    }
+    const_iterator end() const
+    {
+        return children.end();
+    }
+};
+
+TEST(StringifyTraversalTest, NestedValue_MatchesRecursiveEngine)
+{
+    using Value = std::variant<int, std::string, std::vector<std::optional<int>>>;
+    const std::map<std::string, std::vector<std::pair<Value, std::tuple<bool, char>>>> v = {
+        {"a", {{1, {true, 'x'}}, {std::string("s"), {false, 'y'}}}},
+        {"b", {{std::vector<std::optional<int>>{1, std::nullopt}, {true, 'z'}}}},
+        {"c", {}} };
+
+    EXPECT_EQ(DaneJoe::to_string_iterative(v), DaneJoe::to_string(v));
+}
+
+TEST(StringifyTraversalTest, DeepTree_DoesNotRecurse)
+{
+    constexpr std::size_t depth = 50000;
+    Tree root;
+    Tree* node = &root;
+    for (std::size_t i = 1; i < depth; ++i)
+    {
+        node->children.emplace_back();
+        node = &node->children.back();
+    }
+
+    const std::string result = DaneJoe::to_string_iterative(root);
+
+    EXPECT_EQ(result, std::string(depth, '[') + std::string(depth, ']'));
+}
+
+TEST(StringifyTraversalTest, MaxDepth_ReplacesDeeperLevelsWithEllipsis)
+{
+    DaneJoe::StringifyConfig config = DaneJoe::StringifyConfigManager::get_config();
+    config.max_depth = 1;
+    StringifyConfigGuard guard(config);
+
+    const std::vector<std::vector<int>> v = { {1, 2}, {3} };
+    EXPECT_EQ(DaneJoe::to_string_iterative(v), "[..., ...]");
+}
+
+TEST(StringifyTraversalTest, MaxElementCount_AppliesToBothEngines)
+{
+    DaneJoe::StringifyConfig config = DaneJoe::StringifyConfigManager::get_config();
+    config.max_stringify_element_count = 2;
+    StringifyConfigGuard guard(config);
+
+    const std::vector<int> v = { 1, 2, 3, 4 };
+    EXPECT_EQ(DaneJoe::to_string_iterative(v), "[1, 2, ...]");
+    EXPECT_EQ(DaneJoe::to_string(v), "[1, 2, ...]");
+}
+
+TEST(StringifyTraversalTest, BudgetedRun_ResumesWhereItStopped)
+{
+    const std::vector<int> v = { 10, 20, 30, 40, 50 };
+    const DaneJoe::StringifyConfig config = DaneJoe::StringifyConfigManager::get_config();
+    DaneJoe::StringifyTraversal<std::string> traversal(v, config);
+    std::string out;
+
+    EXPECT_FALSE(traversal.run(out, 4));
+    EXPECT_LT(out.size(), DaneJoe::to_string(v).size());
+    while (!traversal.run(out, 4))
+    {
+    }
+    EXPECT_EQ(out, DaneJoe::to_string(v));
+}
+
+} // namespace
@@ -0,0 +1,182 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+#include "danejoe/stringify/stringify_to.hpp"
+#include "danejoe/stringify/stringify_to_string.hpp"
+#include "danejoe/stringify/stringify_traversal.hpp"
+
+namespace
+{
+
+/// 逐码点的参考实现，用于校验块处理的边界
+std::string reference_utf8(const std::u32string& text)
+{
+    std::string result;
+    for (char32_t code_point : text)
+    {
+        if ((code_point >= 0xD800 && code_point <= 0xDFFF) || code_point > 0x10FFFF)
+        {
+            code_point = 0xFFFD;
+        }
+        if (code_point < 0x80)
+        {
+            result.push_back(static_cast<char>(code_point));
+        }
+        else if (code_point < 0x800)
+        {
+            result.push_back(static_cast<char>(0xC0 | (code_point >> 6)));
+            result.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+        }
+        else if (code_point < 0x10000)
+        {
+            result.push_back(static_cast<char>(0xE0 | (code_point >> 12)));
+            result.push_back(static_cast<char>(0x80 | ((code_point >> 6) & 0x3F)));
+            result.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+        }
+        else
+        {
+            result.push_back(static_cast<char>(0xF0 | (code_point >> 18)));
+            result.push_back(static_cast<char>(0x80 | ((code_point >> 12) & 0x3F)));
+            result.push_back(static_cast<char>(0x80 | ((code_point >> 6) & 0x3F)));
+            result.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+        }
+    }
+    return result;
+}
+
+std::u16string to_utf16(const std::u32string& text)
+{
+    std::u16string result;
+    for (char32_t code_point : text)
+    {
+        if (code_point >= 0x10000)
+        {
+            code_point -= 0x10000;
+            result.push_back(static_cast<char16_t>(0xD800 + (code_point >> 10)));
+            result.push_back(static_cast<char16_t>(0xDC00 + (code_point & 0x3FF)));
+        }
+        else
+        {
+            result.push_back(static_cast<char16_t>(code_point));
+        }
+    }
+    return result;
+}
+
+std::u8string to_u8(const std::string& text)
+{
+    return std::u8string(text.begin(), text.end());
+}
+
+const std::string replacement = "\xEF\xBF\xBD";
+
+} // namespace
+
+TEST(StringifyUnicodeTest, StringTypes_RenderAsUtf8)
+{
+    EXPECT_EQ(DaneJoe::to_string(std::u16string(u"hi")), "hi");
+    EXPECT_EQ(DaneJoe::to_string(std::wstring(L"héllo")), "h\xC3\xA9llo");
+    EXPECT_EQ(DaneJoe::to_string(std::u32string(U"\U0001F600!")), "\xF0\x9F\x98\x80!");
+    EXPECT_EQ(DaneJoe::to_string(std::u8string(u8"中文")), "\xE4\xB8\xAD\xE6\x96\x87");
+    EXPECT_EQ(DaneJoe::to_string(std::u16string_view(u"été")), "\xC3\xA9t\xC3\xA9");
+    EXPECT_EQ(DaneJoe::to_string(std::wstring_view(L"view")), "view");
+}
+
+TEST(StringifyUnicodeTest, Scalars_RenderAsUtf8)
+{
+    EXPECT_EQ(DaneJoe::to_string(u'é'), "\xC3\xA9");
+    EXPECT_EQ(DaneJoe::to_string(U'\U0001F600'), "\xF0\x9F\x98\x80");
+    EXPECT_EQ(DaneJoe::to_string(L'w'), "w");
+    EXPECT_EQ(DaneJoe::to_string(u8'a'), "a");
+    EXPECT_EQ(DaneJoe::to_string(static_cast<char16_t>(0xD800)), replacement);
+}
+
+TEST(StringifyUnicodeTest, CStrings_RenderAsUtf8)
+{
+    const wchar_t* text = L"wide";
+    const char16_t* null_text = nullptr;
+    EXPECT_EQ(DaneJoe::to_string(text), "wide");
+    EXPECT_EQ(DaneJoe::to_string(null_text), "<null>");
+}
+
+TEST(StringifyUnicodeTest, LiteralsAndArrays_RenderAsUtf8)
+{
+    EXPECT_EQ(DaneJoe::to_string(L"wide"), "wide");
+    EXPECT_EQ(DaneJoe::to_string(u"\u00e9t\u00e9"), "\xC3\xA9t\xC3\xA9");
+    EXPECT_EQ(DaneJoe::to_string(U"\U0001F600"), "\xF0\x9F\x98\x80");
+    EXPECT_EQ(DaneJoe::to_string(u8"\u4e2d"), "\xE4\xB8\xAD");
+    wchar_t buffer[8] = L"array";
+    EXPECT_EQ(DaneJoe::to_string(buffer), "array");
+    const wchar_t const_buffer[] = L"const";
+    EXPECT_EQ(DaneJoe::to_string(const_buffer), "const");
+    EXPECT_EQ(DaneJoe::to_string(std::make_tuple(L"a", u"b")), "(a, b)");
+    std::string out;
+    DaneJoe::append_to_string(out, buffer, DaneJoe::StringifyConfig());
+    EXPECT_EQ(out, "array");
+    EXPECT_EQ(DaneJoe::to_string_iterative(std::vector<const char16_t*>{ u"x", nullptr }), "[x, <null>]");
+    char fixed[16];
+    const auto result = DaneJoe::stringify_to(fixed, fixed + sizeof(fixed), U"fixed");
+    EXPECT_EQ(std::string_view(fixed, static_cast<std::size_t>(result.ptr - fixed)), "fixed");
+}
+
+TEST(StringifyUnicodeTest, InvalidSequences_AreReplaced)
+{
+    EXPECT_EQ(DaneJoe::to_string(std::u16string{ 0xD800, u'x' }), replacement + "x");
+    EXPECT_EQ(DaneJoe::to_string(std::u16string{ u'x', 0xDC00 }), "x" + replacement);
+    EXPECT_EQ(DaneJoe::to_string(std::u32string{ 0x110000, 0xDFFF }), replacement + replacement);
+    EXPECT_EQ(DaneJoe::to_string(to_u8("a\xFF" "b")), "a" + replacement + "b");
+    EXPECT_EQ(DaneJoe::to_string(to_u8("\xC0\x80")), replacement + replacement);
+    EXPECT_EQ(DaneJoe::to_string(to_u8("\xE4\xB8")), replacement);
+    EXPECT_EQ(DaneJoe::to_string(to_u8("\xED\xA0\x80")), replacement);
+}
+
+TEST(StringifyUnicodeTest, BlockBoundaries_MatchReference)
+{
+    std::mt19937 engine(20261018);
+    const std::array<char32_t, 6> samples = { U'a', U'Z', 0xE9, 0x4E2D, 0x1F600, 0xD800 };
+    std::uniform_int_distribution<std::size_t> pick(0, samples.size() - 1);
+    std::uniform_int_distribution<int> ascii_run(0, 40);
+    for (int round = 0; round < 200; ++round)
+    {
+        std::u32string text;
+        for (int segment = 0; segment < 6; ++segment)
+        {
+            text.append(static_cast<std::size_t>(ascii_run(engine)), U'a' + static_cast<char32_t>(segment));
+            text.push_back(samples[pick(engine)]);
+        }
+        const std::string expected = reference_utf8(text);
+        EXPECT_EQ(DaneJoe::to_string(text), expected);
+
+        std::u32string valid = text;
+        for (char32_t& code_point : valid)
+        {
+            if (code_point == 0xD800)
+            {
+                code_point = 0xFFFD;
+            }
+        }
+        EXPECT_EQ(DaneJoe::to_string(to_utf16(valid)), reference_utf8(valid));
+        const std::string utf8 = reference_utf8(valid);
+        EXPECT_EQ(DaneJoe::to_string(to_u8(utf8)), utf8);
+    }
+}
+
+TEST(StringifyUnicodeTest, NestedAndFixedBuffer)
+{
+    const std::vector<std::u16string> names = { u"ab", u"é" };
+    EXPECT_EQ(DaneJoe::to_string(names), "[ab, \xC3\xA9]");
+    EXPECT_EQ(DaneJoe::to_string_iterative(names), "[ab, \xC3\xA9]");
+
+    static_assert(DaneJoe::is_fixed_stringifiable<std::u16string_view>::value);
+    char buffer[16];
+    auto result = DaneJoe::stringify_to(buffer, buffer + sizeof(buffer), std::u16string_view(u"wide"));
+    EXPECT_FALSE(result.truncated);
+    EXPECT_EQ(std::string_view(buffer, static_cast<std::size_t>(result.ptr - buffer)), "wide");
+}
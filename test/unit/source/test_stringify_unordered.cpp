@@ -0,0 +1,156 @@
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <set>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "danejoe/stringify/stringify_capture.hpp"
+#include "danejoe/stringify/stringify_to_string.hpp"
+#include "danejoe/stringify/stringify_traversal.hpp"
+
+namespace
+{
+
+/// 无operator<的键，只能按哈希值排序
+struct Point
+{
+    int x;
+    int y;
+    bool operator==(const Point& other) const
+    {
+        return x == other.x && y == other.y;
+    }
+    std::string to_string() const
+    {
+        return std::to_string(x) + "/" + std::to_string(y);
+    }
+};
+
+/// 故意制造冲突的哈希
+struct CollidingHash
+{
+    std::size_t operator()(const Point& point) const
+    {
+        return static_cast<std::size_t>(point.x % 2);
+    }
+};
+
+DaneJoe::StringifyConfig make_sorted_config()
+{
+    DaneJoe::StringifyConfig config;
+    config.is_sort_unordered_container = true;
+    return config;
+}
+
+template<class T>
+std::string render(const T& value, const DaneJoe::StringifyConfig& config)
+{
+    std::string result;
+    DaneJoe::append_to_string(result, value, config);
+    return result;
+}
+
+/// 按配置恢复全局配置
+class GlobalConfigGuard
+{
+public:
+    explicit GlobalConfigGuard(const DaneJoe::StringifyConfig& config)
+        : m_old_config(DaneJoe::StringifyConfigManager::get_config())
+    {
+        DaneJoe::StringifyConfigManager::set_config(config);
+    }
+    ~GlobalConfigGuard()
+    {
+        DaneJoe::StringifyConfigManager::set_config(m_old_config);
+    }
+private:
+    DaneJoe::StringifyConfig m_old_config;
+};
+
+} // namespace
+
+TEST(StringifyUnorderedTest, SortedMap_MatchesStdMap)
+{
+    const auto config = make_sorted_config();
+    std::unordered_map<int, std::string> unordered;
+    std::map<int, std::string> ordered;
+    for (int i = 0; i < 200; ++i)
+    {
+        const int key = (i * 7919) % 1000 - 500;
+        unordered[key] = std::to_string(i);
+        ordered[key] = std::to_string(i);
+    }
+    EXPECT_EQ(render(unordered, config), render(ordered, config));
+
+    std::unordered_map<std::string, std::vector<int>> nested = { { "b", { 2 } }, { "a", { 1 } }, { "c", {} } };
+    EXPECT_EQ(render(nested, config), "[{a: [1]}, {b: [2]}, {c: []}]");
+}
+
+TEST(StringifyUnorderedTest, SortedSet_MatchesStdSet)
+{
+    const auto config = make_sorted_config();
+    const std::unordered_set<std::string> unordered = { "pear", "apple", "fig", "kiwi" };
+    const std::set<std::string> ordered(unordered.begin(), unordered.end());
+    EXPECT_EQ(render(unordered, config), render(ordered, config));
+
+    const std::unordered_multiset<int> multi = { 3, 1, 3, 2 };
+    EXPECT_EQ(render(multi, config), "[1, 2, 3, 3]");
+    const std::unordered_multimap<int, int> multi_map = { { 1, 9 }, { 1, 4 }, { 0, 7 } };
+    EXPECT_EQ(render(multi_map, config), "[{0: 7}, {1: 4}, {1: 9}]");
+}
+
+TEST(StringifyUnorderedTest, SameState_SameOutput)
+{
+    const auto config = make_sorted_config();
+    std::unordered_map<Point, int, CollidingHash> first;
+    std::unordered_map<Point, int, CollidingHash> second(64);
+    for (int i = 0; i < 20; ++i)
+    {
+        first[{ i, -i }] = i;
+        second[{ 19 - i, i - 19 }] = 19 - i;
+    }
+    EXPECT_EQ(render(first, config), render(second, config));
+}
+
+TEST(StringifyUnorderedTest, ElementLimit_KeepsSmallestKeys)
+{
+    auto config = make_sorted_config();
+    config.max_stringify_element_count = 3;
+    std::unordered_set<int> values;
+    for (int i = 100; i > 0; --i)
+    {
+        values.insert(i);
+    }
+    EXPECT_EQ(render(values, config), "[1, 2, 3, ...]");
+}
+
+TEST(StringifyUnorderedTest, IterativeAndCapture_MatchRecursive)
+{
+    const auto config = make_sorted_config();
+    const std::unordered_map<int, std::unordered_set<int>> value = {
+        { 3, { 9, 8 } }, { 1, { 5, 4, 6 } }, { 2, {} } };
+    const std::string expected = "[{1: [4, 5, 6]}, {2: []}, {3: [8, 9]}]";
+    EXPECT_EQ(render(value, config), expected);
+
+    std::string iterative;
+    DaneJoe::append_to_string_iterative(iterative, value, config);
+    EXPECT_EQ(iterative, expected);
+
+    GlobalConfigGuard guard(config);
+    EXPECT_EQ(DaneJoe::to_string(value), expected);
+    DaneJoe::StringifyCapture capture;
+    ASSERT_TRUE(capture.capture(value));
+    std::vector<std::string> lines;
+    capture.drain([&](std::string_view text)
+        {
+            lines.emplace_back(text);
+        });
+    ASSERT_EQ(lines.size(), 1u);
+    EXPECT_EQ(lines[0], expected);
+}
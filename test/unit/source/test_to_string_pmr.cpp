@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <map>
+#include <ostream>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+#include "danejoe/stringify/stringify_format.hpp"
+#include "danejoe/stringify/stringify_to_string.hpp"
+
+namespace
+{
+
+/// 上游为null_memory_resource，超出栈缓冲即抛出std::bad_alloc
+struct ArenaFixture
+{
+    std::array<std::byte, 4096> buffer{};
+    std::pmr::monotonic_buffer_resource resource{
+        buffer.data(), buffer.size(), std::pmr::null_memory_resource() };
+};
+
+/// 仅支持operator<<的类型
+struct StreamPoint
+{
+    int x = 0;
+    int y = 0;
+};
+
+std::ostream& operator<<(std::ostream& os, const StreamPoint& point)
+{
+    return os << '<' << point.x << ',' << point.y << '>';
+}
+
+TEST(ToStringPmrTest, Container_MatchesStdString)
+{
+    ArenaFixture arena;
+    const std::map<int, std::vector<std::string>> v = { {1, {"a", "b"}}, {2, {}} };
+
+    const std::pmr::string result = DaneJoe::to_string(v, &arena.resource);
+
+    EXPECT_EQ(std::string_view(result), DaneJoe::to_string(v));
+    EXPECT_EQ(result.get_allocator().resource(), &arena.resource);
+}
+
+TEST(ToStringPmrTest, TupleAndDuration_UseArena)
+{
+    ArenaFixture arena;
+    const auto v = std::make_tuple(1, std::chrono::milliseconds(5), true);
+
+    const std::pmr::string result = DaneJoe::to_string(v, &arena.resource);
+
+    EXPECT_EQ(result, "(1, 5ms, true)");
+}
+
+TEST(ToStringPmrTest, AllocatorOverload_ReturnsPmrString)
+{
+    ArenaFixture arena;
+    std::pmr::polymorphic_allocator<char> allocator(&arena.resource);
+    const std::vector<double> v = { 1.5, 2.0 };
+
+    const std::pmr::string result = DaneJoe::to_string(v, allocator);
+
+    EXPECT_EQ(result, "[1.5, 2]");
+}
+
+TEST(ToStringPmrTest, PmrStringValue_IsText)
+{
+    ArenaFixture arena;
+    const std::pmr::string value("hello", &arena.resource);
+
+    EXPECT_EQ(DaneJoe::to_string(value), "hello");
+}
+
+TEST(ToStringPmrTest, FormatCapacitySize_UsesArena)
+{
+    ArenaFixture arena;
+
+    const std::pmr::string result = DaneJoe::format_capacity_size(
+        1536, DaneJoe::StorageUnit::KiloByte, 1, &arena.resource);
+
+    EXPECT_EQ(std::string_view(result), DaneJoe::format_capacity_size(1536, DaneJoe::StorageUnit::KiloByte, 1));
+    EXPECT_EQ(result, "1.5 KB");
+}
+
+TEST(ToStringPmrTest, StreamOutAndHugeFixedFloat_WriteIntoOutput)
+{
+    ArenaFixture arena;
+    const std::pmr::string point = DaneJoe::to_string(std::vector<StreamPoint>{ { 1, 2 }, { 3, 4 } }, &arena.resource);
+    EXPECT_EQ(point, "[<1,2>, <3,4>]");
+
+    std::pmr::string out(&arena.resource);
+    DaneJoe::append_floating(out, 1e300, std::chars_format::fixed, 2);
+    EXPECT_EQ(out.size(), 301u + 3u);
+    EXPECT_EQ(out.substr(0, 2), "10");
+    EXPECT_EQ(out.substr(out.size() - 3), ".00");
+}
+
+} // namespace
@@ -0,0 +1,42 @@
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <string_view>
+
+#include "danejoe/stringify/stringify_capture.hpp"
+
+/**
+ * @brief 离线解码StringifyCapture::drain_binary写出的记录文件，每条记录输出一行
+ * @note 用法：danejoe_stringify_capture_decode <文件>，省略文件时读取标准输入
+ */
+int main(int argc, char* argv[])
+{
+    std::string data;
+    if (argc > 1)
+    {
+        std::ifstream file(argv[1], std::ios::binary);
+        if (!file)
+        {
+            std::cerr << "cannot open " << argv[1] << std::endl;
+            return 1;
+        }
+        data.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+    else
+    {
+        data.assign(std::istreambuf_iterator<char>(std::cin), std::istreambuf_iterator<char>());
+    }
+    bool is_ok = DaneJoe::decode_capture_frames(data, [](std::string_view text)
+        {
+            std::fwrite(text.data(), 1, text.size(), stdout);
+            std::fputc('\n', stdout);
+        }, *DaneJoe::StringifyConfigManager::get_config_snapshot());
+    if (!is_ok)
+    {
+        std::cerr << "malformed capture data" << std::endl;
+        return 1;
+    }
+    return 0;
+}